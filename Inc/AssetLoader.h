@@ -0,0 +1,122 @@
+/*!
+@file	  AssetLoader.h
+@date     17/10/2026
+@brief    This header file contains the asset loader and the cache every image, sprite sheet, sound and font of
+		  the game is got from. While the splash screen fades in, a thread reads the files the game needs and decodes the images into
+		  pixels, and the main thread turns what is ready into CProcessing assets a few milliseconds a frame, so the
+		  splash screen never stops drawing and the menu has everything when it opens. There are 12 functions,
+
+		  StartAssetLoader - Starts the thread loading the game's assets.
+		  UpdateAssetLoader - Turns what the thread loaded into assets, for a few milliseconds.
+		  FinishAssetLoader - Waits for the thread and turns everything left into assets now.
+		  IsAssetLoaderDone - Checks if every asset is ready.
+		  GetAssetLoaderProgress - Returns how much of the loading is done.
+		  GetAssetImage - Returns the image of a file.
+		  GetAssetSheet - Returns the sprite sheet of numbered frame files.
+		  GetAssetSound - Returns the sound of a file.
+		  GetAssetSoundLength - Returns how long the sound of a file is.
+		  GetAssetFont - Returns the font of a file.
+		  ReportTimeToInteractive - Records and prints how long the game took to get to the menu.
+		  GetTimeToInteractive - Returns what ReportTimeToInteractive recorded.
+
+		  Assets are loaded once and kept until the game closes, the same file always gives the same asset, so they
+		  must not be freed by the states using them. A file the thread has not loaded yet is loaded straight away
+		  when it is asked for.
+
+		  A sprite sheet is the frames of an animation packed into one image, drawn with CP_Image_DrawSubImage and
+		  the part of the image in its frame table, so the animation is one image instead of one for every frame.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#pragma once // Only include this header file once
+
+#include <cprocessing.h>
+
+#define MAX_ASSETS 64					// Files kept in the cache, more are loaded every time they are asked for
+#define ASSET_FRAME_BUDGET 0.004		// Seconds a frame UpdateAssetLoader spends turning loaded files into assets
+
+/*______________________________________________________________
+@brief Where a frame is in its sprite sheet's image, in pixels, for CP_Image_DrawSubImage.
+*/
+typedef struct SpriteFrame {
+	float u0, v0, u1, v1;
+} SpriteFrame;
+
+/*______________________________________________________________
+@brief Every frame of an animation in one image. The frames are all frame_width by frame_height, the table is made
+	   with the sheet in one allocation.
+*/
+typedef struct SpriteSheet {
+	CP_Image image;
+	int frame_count;
+	int frame_width;
+	int frame_height;
+	SpriteFrame frames[];
+} SpriteSheet;
+
+/*______________________________________________________________
+@brief Starts the thread reading and decoding the files of the game, and the clock ReportTimeToInteractive reads.
+	   Needs to be called once, when the game starts.
+*/
+void StartAssetLoader(void);
+
+/*______________________________________________________________
+@brief Turns the files the thread has loaded into assets, in the order they were loaded, until ASSET_FRAME_BUDGET is
+	   used up (at least one a call). Needs to be called every frame until IsAssetLoaderDone.
+*/
+void UpdateAssetLoader(void);
+
+/*______________________________________________________________
+@brief Waits for the thread to load everything and turns all of it into assets, for when they are needed now.
+*/
+void FinishAssetLoader(void);
+
+/*______________________________________________________________
+@brief Returns TRUE once every file the thread loads is an asset and the thread is done.
+*/
+_Bool IsAssetLoaderDone(void);
+
+/*______________________________________________________________
+@brief Returns how much of the loading is done, 0 to 1, counting the files read and the assets made.
+*/
+float GetAssetLoaderProgress(void);
+
+/*______________________________________________________________
+@brief Returns the image of the png file at path, NULL if it could not be loaded.
+*/
+CP_Image GetAssetImage(char const* path);
+
+/*______________________________________________________________
+@brief Returns the sprite sheet of the png files path_format gives for the frames 0 to frame_count - 1 (like
+	   "Assets/Anim/Frame_%02d.png"), all the same size. NULL if a frame could not be loaded or the cache is full. The
+	   sheet is kept by path_format, with the frame count it was first loaded with.
+*/
+SpriteSheet const* GetAssetSheet(char const* path_format, int frame_count);
+
+/*______________________________________________________________
+@brief Returns the sound of the wav file at path, NULL if it could not be loaded.
+*/
+CP_Sound GetAssetSound(char const* path);
+
+/*______________________________________________________________
+@brief Returns how many seconds the sound of the wav file at path plays for, 0 if it is not known.
+*/
+float GetAssetSoundLength(char const* path);
+
+/*______________________________________________________________
+@brief Returns the font of the ttf file at path.
+*/
+CP_Font GetAssetFont(char const* path);
+
+/*______________________________________________________________
+@brief Records how long it has been since StartAssetLoader, the first time it is called, and prints it to the
+	   debugger output with how long the loading took. Called when the menu first updates, as that is when the player
+	   can first do something.
+*/
+void ReportTimeToInteractive(void);
+
+/*______________________________________________________________
+@brief Returns the milliseconds from StartAssetLoader to ReportTimeToInteractive, -1 if it was not reported yet.
+*/
+double GetTimeToInteractive(void);
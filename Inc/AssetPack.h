@@ -0,0 +1,82 @@
+/*!
+@file	  AssetPack.h
+@date     17/10/2026
+@brief    This header file contains the asset pack, every asset file of the game put into one file by the asset packer
+		  (Tools/AssetPacker) when the game is built. The pack is mapped into memory when the game starts and read
+		  ahead in one go, so a file in it is a pointer into the mapping instead of a file to open and read. There are
+		  4 functions,
+
+		  OpenAssetPack - Maps a pack into memory.
+		  CloseAssetPack - Unmaps the pack.
+		  FindPackedAsset - Returns where a file is in the pack.
+		  AssetPackHash - Returns the hash of a path, the index is looked up with.
+
+		  Only one pack is open at a time. Files not in the pack, or every file if there is no pack, are read from
+		  the Assets folder as before. CProcessing only loads sounds and fonts from a file, so those are still
+		  shipped loose, the pack has their bytes for what the game reads itself.
+
+		  Pack layout, all numbers little endian:
+		  AssetPackHeader | AssetPackEntry[bucket_count] | paths, each ending with '\0' | blobs
+		  The entries are a hash table with linear probing, bucket_count is a power of two. Every blob starts on a
+		  multiple of ASSET_PACK_ALIGNMENT.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#pragma once // Only include this header file once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define ASSET_PACK_PATH "Assets.pak"		// Next to the game, made by the build
+#define ASSET_PACK_MAGIC 0x4B415041u		// "APAK"
+#define ASSET_PACK_VERSION 1u
+#define ASSET_PACK_ALIGNMENT 64				// Blobs start on a cache line
+#define ASSET_PACK_EMPTY 0xFFFFFFFFu		// The path of a bucket with no file
+
+/*______________________________________________________________
+@brief The start of a pack.
+*/
+typedef struct AssetPackHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t pack_size;			// Of the whole file
+	uint32_t file_count;
+	uint32_t bucket_count;		// Entries after the header
+	uint32_t paths_offset;
+	uint32_t paths_size;
+	uint32_t reserved;
+} AssetPackHeader;
+
+/*______________________________________________________________
+@brief A bucket of the index.
+*/
+typedef struct AssetPackEntry {
+	uint32_t hash;				// AssetPackHash of the path
+	uint32_t path;				// From paths_offset, ASSET_PACK_EMPTY if the bucket has no file
+	uint32_t offset;			// Of the blob, from the start of the pack
+	uint32_t size;
+} AssetPackEntry;
+
+/*______________________________________________________________
+@brief Maps the pack at path into memory, closing the one open, and starts reading all of it in. Returns FALSE and
+	   leaves no pack open if it is not there or is not a pack of this version.
+*/
+_Bool OpenAssetPack(char const* path);
+
+/*______________________________________________________________
+@brief Unmaps the pack, everything FindPackedAsset returned cannot be used anymore.
+*/
+void CloseAssetPack(void);
+
+/*______________________________________________________________
+@brief Returns the bytes of the file at path ("Assets/Heart.png") in the pack and sets size, NULL if no pack is open or
+	   the file is not in it. The bytes stay until the pack is closed and must not be written. Safe to call from any
+	   thread while the pack is open.
+*/
+unsigned char const* FindPackedAsset(char const* path, size_t* size);
+
+/*______________________________________________________________
+@brief Returns the 32 bit FNV-1a hash of path, with '\' counted as '/'.
+*/
+uint32_t AssetPackHash(char const* path);
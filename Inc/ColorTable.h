@@ -60,3 +60,5 @@ ________________________________________________________________________________
 #define ENEMY_MOVEMENT CP_Color_Create(227, 23, 23, 120)
 
 #define TUTORIAL_COLOR CP_Color_Create(222, 206, 62, 255)
+#define HINT_COLOR CP_Color_Create(222, 206, 62, 255)
+#define HINT_FILL_COLOR CP_Color_Create(222, 206, 62, 60)
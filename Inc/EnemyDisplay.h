@@ -11,14 +11,14 @@
 		  RenderEnemyMovement - Renders the enemy movement arrows and shades destination cell
 		  DisplayEnemyInfo - Renders the floating information box on enemy hover
 
-		  FreeEnemyDisplayIcon - Frees the attack icons used for enemy attack stat displaying
+		  FreeEnemyDisplayIcon - Lets go of the attack icons used for enemy attack stat displaying
 
 @license  Copyright  2022 DigiPen, All rights reserved.
 ________________________________________________________________________________________________________*/
 
 #pragma once // Only include this header file once
 
-#include "CProcessing.h" // For CP_Color & CP_Vector
+#include "cprocessing.h" // For CP_Color & CP_Vector
 #include "EnemyStats.h" // For enemy type enum
 
 /*______________________________________________________________
@@ -80,6 +80,6 @@ void RenderEnemyMovement(float pos_x, float pos_y, int movement);
 void DisplayEnemyInfo(void);
 
 /*______________________________________________________________
-@brief Frees the attack icons used for enemy attack stat displaying
+@brief Lets go of the attack icons used for enemy attack stat displaying, they are kept by the asset loader
 */
 void FreeEnemyDisplayIcon(void);
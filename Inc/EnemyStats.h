@@ -11,47 +11,14 @@ ________________________________________________________________________________
 
 #pragma once // Only include this header file once
 
-#define ENEMYPOOL 10
+#include <cprocessing.h>
+#include "SimCore.h" // For EnemyInfo and ZombieType, the enemy stats themselves live in SimCore.c
 
-typedef enum ZombieType{
-    ZOMBIE,
-    LEAPER,
-    TANK,
-    BREAKER,
-    GRAVE,
-	WALL,
-	ZOMBIE_TYPE_LENGTH
-} ZombieType;
-
-typedef struct EnemyInfo{
-	//Position 
-	int x;
-	int y;
-	//Cost to spawn
-	int Cost;
-	//Movement of tiles per turn
-	int MovementSpeed;
-	int damage;
-	//Health
-	int Health;
-	int MaxHealth;
-	//For the time being, it's the "sprite"
-	char* CharSprite;
-	CP_Color Color;
-	ZombieType type;
-	_Bool moveCooldown;	//IUsed for grave spawn cooldowns
-	//Helps check if the enemy needs to be rendered or not
-	_Bool isAlive;
-
-} EnemyInfo;
-
-void CreateEnemy(int cost, int speed, int health,int damage, const char* sprite,ZombieType type,CP_Color color);
 void InitEnemyPool(void);
-void MoveEnemy(EnemyInfo* enemy);
-void DrawEnemy(EnemyInfo* enemy);
+void DrawEnemy(int x, int y, int health, ZombieType type);
+CP_Color GetEnemyColor(ZombieType type);
 
 //Helper functions
 int GetEnemyCount(void);
 EnemyInfo* GetEnemyPrefab(int index);
-EnemyInfo* GetRandomEnemyPrefab(void);
 void SendDamage(int x, int y,int damage);
\ No newline at end of file
@@ -3,15 +3,18 @@
 @author	  Ang Jiawei Jarrett (a.jiaweijarrett@digipen.edu)
 @date     17/11/2022
 @brief    This header file contains enums for turn types (player, zombies) and event types (start, update, end) for those turns,
-		  structs to hold information (pointers, priority) for the events and an array of events for each turn, and 7 functions.
+		  structs to hold information (pointers, priority) for the events and an array of events for each turn, and 9 functions.
 
 		  SubscribeEvent - Add a function to be called everytime an event happens (e.g. player start, zombie update).
+		  SubscribeEventEx - Same as SubscribeEvent, but the function is passed a pointer of your choosing when called.
 		  UnsubscribeEvent - Pass the event you want to unsubscribe your function from, and pass the function pointer too.
+		  UnsubscribeEventHandle - Pass the handle you got when subscribing, removes that one subscription straight away.
 		  UnsubscribeAllEvents - It is important this function is called when the game level exits!!
 		  ZeroOutAllEvents - Similar to UnsubscribeAllEvents but this forces ALL events to be zeroed out, even the NULL ones
 
 		  GameLoopInit - Needs to be called at the start of the game level to handle the turns between the player and the zombies.
 		  GameLoopSwitch - Call this to swap between turns. The functions subscribed to the end of current turn and start of next turn will be called.
+						   If called from inside an event, the swap waits until every function of that event has been called.
 		  GameLoopUpdate - Every update, calls all functions subscribed to the turn's update array.
 
 @license  Copyright  2022 DigiPen, All rights reserved.
@@ -40,6 +43,18 @@ typedef enum {
 } TurnEventType;
 #define DEFAULT_PRIORITY 0 
 
+/*______________________________________________________________
+@brief A function that can be subscribed with SubscribeEventEx, user_data is the pointer given when subscribing.
+*/
+typedef void (*EventCallback)(void* user_data);
+
+/*______________________________________________________________
+@brief Identifies one subscription, keep it to unsubscribe with UnsubscribeEventHandle. Handles of removed subscriptions
+	   are never reused, so unsubscribing twice is harmless.
+*/
+typedef unsigned int EventHandle;
+#define NO_EVENT_HANDLE 0	// Returned when the subscription could not be made
+
 /*______________________________________________________________
 @brief     If you need a function called during any of the player's or zombie's turn, pass your function here.
 	       ONLY VOID FUNCTION(VOID) (Functions that return nothing and have no parameters) allowed.
@@ -52,8 +67,20 @@ typedef enum {
 @priority  !! For Priority, higher numbers will be called first, the DEFAULT_PRIORITY int is 0 use it if you have no preference. 
 			  If your function needs to be called first, use a higher number (not too high) like 5 or 20, if your function needs
 			  to be called last, use a lower number (negative) like -1 or -20.
+			  Functions with the same priority are called in the order they subscribed.
+
+@return    The handle of the subscription, for UnsubscribeEventHandle. NO_EVENT_HANDLE if there was no memory for it.
+		   Subscribing from inside an event is fine, the new function is only called from the next time that event happens.
 */
-void SubscribeEvent(TurnEventType event_type, void(*function_pointer)(void), int priority);
+EventHandle SubscribeEvent(TurnEventType event_type, void(*function_pointer)(void), int priority);
+
+/*______________________________________________________________
+@brief Same as SubscribeEvent, but the function is called with user_data, so one function can be subscribed for many
+	   objects (e.g. a function per zombie, with the zombie as user_data).
+
+@return The handle of the subscription, for UnsubscribeEventHandle. NO_EVENT_HANDLE if there was no memory for it.
+*/
+EventHandle SubscribeEventEx(TurnEventType event_type, EventCallback callback, void* user_data, int priority);
 
 /*______________________________________________________________
 @brief Pass the event you want to unsubscribe your function from, and pass the function pointer too so it knows which one to remove.
@@ -63,6 +90,14 @@ void SubscribeEvent(TurnEventType event_type, void(*function_pointer)(void), int
 */
 void UnsubscribeEvent(TurnEventType event_type, void(*function_pointer)(void));
 
+/*______________________________________________________________
+@brief Removes the subscription the handle is for, it is not looked for so this costs the same however many are subscribed.
+	   Unsubscribing from inside an event is fine, even the function being called can unsubscribe itself.
+
+@param[in] handle - The handle returned by SubscribeEvent or SubscribeEventEx
+*/
+void UnsubscribeEventHandle(EventHandle handle);
+
 /*______________________________________________________________
 @brief It is important this function is called when the game level exits!!
 */
@@ -77,20 +112,28 @@ void ZeroOutAllEvents(void);
 // Turn & Events structs
 
 /*______________________________________________________________
-@brief Each event stores a pointer and the priority in event list array
+@brief Each event stores a pointer and the priority in event list array. Only one of event or callback is set.
 */
 typedef struct {
-	void (*event)(void);
+	void (*event)(void);		// Subscribed with SubscribeEvent
+	EventCallback callback;		// Subscribed with SubscribeEventEx, called with user_data
+	void* user_data;
 	int priority;
+	int slot;					// Index of the subscription's handle slot, -1 once unsubscribed
 } Event;
 
 /*______________________________________________________________
-@brief Each event array can store up to MAX_EVENTS_BUFFER events, stores the total subscribed count as well
+@brief Each event array grows as functions subscribe, stores the total subscribed count as well.
+	   Unsubscribed events are only taken out of the array the next time the event happens, and events subscribed
+	   since then are sorted in by priority at the same time.
 */
-#define MAX_EVENTS_BUFFER 10
 typedef struct {
-	Event events[MAX_EVENTS_BUFFER];
-	int count;
+	Event* events;
+	int count;					// Events in the array, including the unsubscribed ones not taken out yet
+	int capacity;
+	int sorted_count;			// The first sorted_count events are in priority order, the rest are new
+	int removed_count;			// Unsubscribed events not taken out yet
+	int dispatch_depth;			// How many times the event is being called right now, the array is left alone while it is
 } TurnEvent;
 
 /*______________________________________________________________
@@ -0,0 +1,48 @@
+/*!
+@file	  GlyphAtlas.h
+@date     17/10/2026
+@brief    This header file contains the glyph atlas, for the single characters drawn many times a frame like the
+		  particles, the enemies and the wizard. The printable characters of the game font are baked into one image
+		  at the size of a cell when the level starts, so a character is drawn as a part of that image instead of
+		  being laid out as text every time. There are 4 functions,
+
+		  GlyphAtlasInit - Bakes the atlas at a glyph size.
+		  GlyphAtlasFree - Frees the atlas.
+		  DrawGlyph - Draws a character now.
+		  QueueGlyph - Queues a character in the render queue, drawn on the next RenderQueueFlush.
+
+		  Characters are drawn like CP_Font_DrawText with CP_TEXT_ALIGN_H_CENTER and CP_TEXT_ALIGN_V_MIDDLE, x and y
+		  are the middle of the character. '\0' draws nothing. If the atlas is not baked or the character is not in
+		  it, it is drawn as text instead.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#pragma once // Only include this header file once
+
+#include <cprocessing.h>
+#include "RenderQueue.h"
+
+#define GLYPH_FONT_PATH "Assets/PressStart2P-Regular.ttf"
+
+/*______________________________________________________________
+@brief Bakes the printable characters (' ' to '~') of the game font into the atlas, glyph_size pixels high. Call it
+	   again to bake at a new size. Characters drawn bigger than they were baked are stretched.
+*/
+void GlyphAtlasInit(float glyph_size);
+
+/*______________________________________________________________
+@brief Frees the atlas image, characters are drawn as text until it is baked again.
+*/
+void GlyphAtlasFree(void);
+
+/*______________________________________________________________
+@brief Draws a character size pixels high in color, centered on x and y. Changes the tint, leaves it off.
+*/
+void DrawGlyph(char glyph, float x, float y, float size, CP_Color color);
+
+/*______________________________________________________________
+@brief Queues a character size pixels high in color, centered on x and y. Everything queued with the atlas in a layer
+	   is drawn one after another on the flush, so many characters cost about one image draw each.
+*/
+void QueueGlyph(RenderLayer layer, char glyph, float x, float y, float size, CP_Color color);
@@ -11,13 +11,11 @@ ________________________________________________________________________________
 #pragma once // Only include this header file once
 
 #include <cprocessing.h>
+#include "SimCore.h" // For TOTAL_XGRID and TOTAL_YGRID
 
 #define WINDOWHEIGHT CP_System_GetWindowHeight()
 #define WINDOWLENGTH CP_System_GetWindowWidth()
 
-#define	TOTAL_YGRID 7
-#define TOTAL_XGRID 13
-
 typedef struct SpaceInfo{
 	float x_pos;
 	float y_pos;
@@ -42,12 +40,14 @@ int PosYToGridY(float pos);
 
 void grid_init(void);
 void grid_update(void);
+//Frees the baked board, on the exit of the game level
+void grid_exit(void);
 
 //Check if given point is in playing area
 _Bool IsInPlayingArea(float x,float y);
 _Bool IsIndexInPlayingArea(int x, int y);
 
-//For drawing the grid
+//For drawing the grid, the lines and cells are baked into an image by grid_init
 void DrawLineGrid();
 //Create the space for players to place their blocks and enemy to move in
 void CreatePlayingSpace();
\ No newline at end of file
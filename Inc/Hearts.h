@@ -10,7 +10,8 @@ ________________________________________________________________________________
 
 #pragma once // Only include this header file once
 
-#define MAX_HEART_COUNT 3
+#include "SimCore.h" // For MAX_HEART_COUNT, the hearts left are kept in the game's SimState
+
 #define IMAGE_HEART_LENGTH 263
 #define HEART_SPACING 0.35f
 #define HEART_SIZE 4.f
@@ -18,7 +19,6 @@ ________________________________________________________________________________
 #define HEART_ROTATION 0.f
 
 typedef struct HeartContainer{
-	int heartAlive;
 	float xpos;
 	float ypos;
 	float size;
@@ -53,6 +53,12 @@ after a few seconds
 ------------------------------------------------------------------------------*/
 void YouLoseTitleRender(void);
 
+/*----------------------------------------------------------------------------
+@brief Called when the You Lose title card has been up long enough, goes to the
+Game Over screen
+------------------------------------------------------------------------------*/
+void GoToGameOver(void* data);
+
 /*----------------------------------------------------------------------------
 @brief Function to allow for the gaining of life
 ------------------------------------------------------------------------------*/
@@ -81,13 +87,7 @@ int CheckLoseCondition(void);
 void RenderHeartText(void);
 
 /*----------------------------------------------------------------------------
-@brief Function for Bezier Curve
-@param Place the tick time here, to have a smoother animation
-------------------------------------------------------------------------------*/
-float BezierCurve(float);
-
-/*----------------------------------------------------------------------------
-@brief Animates the hearts to go up and down
+@brief Starts the hearts going up and down, called when the life is initialized
 ------------------------------------------------------------------------------*/
 void AnimationLife(void);
 
@@ -98,6 +98,6 @@ heart text and if the hearts are 0, start the You Lose render
 void UpdateLife(void);
 
 /*----------------------------------------------------------------------------
-@brief Clear the heart image that was loaded previously
+@brief Clear the heart image, it is kept by the asset loader
 ------------------------------------------------------------------------------*/
 void ClearHearts(void);
@@ -0,0 +1,31 @@
+/*!
+@file	  Hint.h
+@date     17/10/2026
+@brief    This header file contains the hint shown when the player presses H on their turn. The placement comes from the
+		  solver (SimSolver.h), there are 3 functions,
+
+		  HintInit - Needs to be called at the start of the game level, subscribes the hint to the player's turn.
+		  RenderHint - Needs to be called in update after the hand is rendered, draws the hint if one was asked for.
+		  ClearHint - Hides the hint, called when the player's turn ends.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#pragma once // Only include this header file once
+
+/*______________________________________________________________
+@brief Needs to be called at the start of the game level (after the hand is filled by TPlayerInit), subscribes
+	   the hint to the player's turn.
+*/
+void HintInit(void);
+
+/*______________________________________________________________
+@brief Needs to be called in update after RenderHand, draws the hinted placement on the grid and marks the piece in
+	   the hand to play it with.
+*/
+void RenderHint(void);
+
+/*______________________________________________________________
+@brief Hides the hint, it is only good for the hand and board it was worked out on.
+*/
+void ClearHint(void);
@@ -10,16 +10,43 @@ ________________________________________________________________________________
 #include "cprocessing.h"
 #include "ColorTable.h"     
 #include <math.h>           //some angle to vector calculations are needed
-#include <string.h>         //used for animating the particles
+#include <string.h>         //used for moving the particles around
 #include "EnemyStats.h"     //for grabbing enemy data
 
 //====================== DEFINES ======================
 #define VECTOR_UP CP_Vector_Set(0,-1)
 #define VECTOR_DOWN CP_Vector_Set(0,1)
-#define PARTICLECOUNT 1001
+#define PARTICLE_BUDGET 4096     //Most particles alive at once unless SetParticleBudget changes it
 #define LERPPARTICLECOUNT 20
 
-
+//An animation of a particle, every character of frames is a frame, played over the particle's life.
+typedef struct ParticleAnimation{
+    const char* frames;
+    int frameCount;
+} ParticleAnimation;
+
+//Makes a ParticleAnimation from a string literal, the frames are counted when it is compiled.
+#define PARTICLE_ANIMATION(frames) { frames, (int)sizeof(frames) - 1 }
+
+//What a particle is for, when there is no room left the ones that matter less make room first.
+typedef enum ParticlePriority{
+    PARTICLE_DECORATIVE,    //Bursts and sparkles
+    PARTICLE_GAMEPLAY,      //Tells the player something happened: enemy spawns, deaths and attacks
+    PARTICLE_PRIORITY_COUNT
+} ParticlePriority;
+
+//Counters of the particle pool, for the profiler. Counted since the last ResetParticles.
+typedef struct ParticlePoolStats{
+    int live;
+    int capacity;           //Room there is for particles now, grows up to the budget
+    int budget;
+    int peak;               //Most particles alive at once
+    int evicted[PARTICLE_PRIORITY_COUNT];   //Particles taken out early to make room, by priority
+    int dropped;            //New particles not made as everything alive mattered more
+} ParticlePoolStats;
+
+
+//A single particle, used for the lerped particles. The other particles are kept field by field in Particles.c.
 typedef struct Particle{
     float x;
     float y;
@@ -33,30 +60,38 @@ typedef struct Particle{
     float size;             //NOTE!! Size is normally set to cell size!
     _Bool isRGB;
     _Bool isLoop;            //Manually set for certain particles in source
-    CP_Vector force;        //force that is acting on particle. Cummulative and will be calculated in UpdateParticle.
-    char* animString;
+    CP_Vector force;        //force that is acting on particle. Cummulative, gravity is added to it every frame.
+    ParticleAnimation const* animation;
     CP_Color color;
     float gravityScale;    
 } Particle;
 /*____________________________________________________________________*/
 
 /*
-@brief Create Particle will add the particle to the particle array for use.
+@brief Create Particle will add the particle to the particle pool for use. With the budget reached it replaces the
+oldest particle of a priority that matters less or the same, or is dropped if there is none.
 @param[in] Params : Refer to particle struct for full list of params.
+@param[in] priority What the particle is for, see ParticlePriority.
 */
-void CreateParticle(float xPos, float yPos, float lifeTime, float size,float gravityScale, CP_Color color,CP_Vector force,const char* animString,BOOL isRGB,float timeBeforeActive);
+void CreateParticle(float xPos, float yPos, float lifeTime, float size,float gravityScale, CP_Color color,CP_Vector force,ParticleAnimation const* animation,BOOL isRGB,float timeBeforeActive,ParticlePriority priority);
 /*____________________________________________________________________*/
 
 /*
-@brief Updates a single particle's position and physics and deducts lifetime.
-@param[in] particlePointer pointer to a particle in the particleArray.
+@brief Sets the most particles that can be alive at once (PARTICLE_BUDGET at the start). Lowering it below what is alive
+takes effect as they die.
 */
-void UpdateParticle(Particle* particlePointer);
+void SetParticleBudget(int budget);
 /*____________________________________________________________________*/
 
 /*
-@brief Draws the particle if it still has lifetime.
-@param[in] particlePointer pointer to a particle in the particleArray.
+@brief Returns the counters of the particle pool, shown with the profiler in debug mode.
+*/
+ParticlePoolStats GetParticlePoolStats(void);
+/*____________________________________________________________________*/
+
+/*
+@brief Queues the particle to be drawn from the glyph atlas if it still has lifetime, drawn on the next RenderQueueFlush.
+@param[in] particlePointer pointer to a lerped particle.
 */
 void DrawParticle(Particle* particlePointer);
 /*____________________________________________________________________*
@@ -68,16 +103,11 @@ void UpdateEffects(void);
 /*____________________________________________________________________*
 
 /*
-@brief Adds lerped particle to the particle array for use.
+@brief Adds lerped particle to the particle array for use. It is moved to the end by tweens, so UpdateTweens needs to
+be called every frame for it to move.
 @param[in] Params : Refer to particle struct for full list of params.
 */
-void CreateLerpedParticle(float xPos, float yPos,float endX,float endY,float lifeTime, float size, const char* animString);
-/*____________________________________________________________________*
-
-/*
-@brief Updates the lerped particles, needs to be called every frame!
-*/
-void UpdateLerpParticle(void);
+void CreateLerpedParticle(float xPos, float yPos,float endX,float endY,float lifeTime, float size, ParticleAnimation const* animation);
 /*____________________________________________________________________*/
 
 
@@ -134,11 +164,17 @@ void PlayerMagicParticle(float endX, float endY);
 /*____________________________________________________________________*
 
 /*
-@brief Resets particle array and index. Used when exiting game to mainmenu
+@brief Resets the particles and the pool counters. Used when exiting game to mainmenu
 */
 void ResetParticles(void);
 /*____________________________________________________________________*
 
+/*
+@brief Resets the particles and frees the memory they were kept in. Needs to be called on the exit of the game level
+*/
+void FreeParticles(void);
+/*____________________________________________________________________*
+
 /*
 @brief Spawns the particle of the enemy moving towards the player.
 @param[in] Position is the particles x and y positions respectively.
@@ -156,7 +192,8 @@ CP_Vector AngleToVector(float degreeAngle);
 
 /*
 @brief Helper function for RGB values
-@param[in] Color,timeStep Returns a HSL color based on the time step given. 
+@param[in] Color,timeStep Returns a HSL color based on the time step given, from a table made the first time the color
+is used. 
 */
 CP_Color LerpedHSLColor(CP_Color color,float timeStep);
 /*____________________________________________________________________*/
\ No newline at end of file
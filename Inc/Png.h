@@ -0,0 +1,24 @@
+/*!
+@file	  Png.h
+@date     17/10/2026
+@brief    This header file contains the png decoder the asset loader uses to turn the game's images into pixels off the
+		  main thread, as CProcessing only loads images on the thread that draws. There is 1 function,
+
+		  PngDecode - Turns the bytes of a png file into RGBA pixels.
+
+		  Only what the game's images use is read: 8 bit gray, gray and alpha, RGB, RGBA and palette images (with a
+		  tRNS chunk for palette transparency), not interlaced. Anything else is left to CP_Image_Load.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#pragma once // Only include this header file once
+
+#include <stddef.h>
+
+/*______________________________________________________________
+@brief Decodes the png file in data into width * height RGBA pixels, 4 bytes a pixel, row by row from the top. The
+	   pixels are malloc'd and need to be freed by the caller. Returns NULL, with width and height untouched, if the
+	   file is broken or uses something not read.
+*/
+unsigned char* PngDecode(unsigned char const* data, size_t size, int* width, int* height);
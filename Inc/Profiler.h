@@ -0,0 +1,132 @@
+/*!
+@file	  Profiler.h
+@date     17/10/2026
+@brief    This header file contains the frame profiler. Every stage of the game level's update and every turn event is
+		  timed as a zone, and the last PROFILE_HISTORY frames of each zone are kept for the min/avg/p99 shown in debug
+		  mode. The zones of the last frames are also kept in order, so they can be saved as a Chrome trace
+		  (chrome://tracing or ui.perfetto.dev) to look at a spike frame by frame. There are 11 functions,
+
+		  ProfilerSetEnabled - Starts or stops timing, nothing is timed until it is enabled.
+		  ProfilerIsEnabled - Returns if zones are being timed.
+		  ProfilerReset - Forgets every frame timed so far.
+		  ProfilerBeginFrame - Needs to be called at the start of the update, starts the PROFILE_FRAME zone.
+		  ProfilerEndFrame - Needs to be called at the end of the update, keeps the times of the frame.
+		  ProfilerBegin - Starts timing a zone, zones can be started inside each other.
+		  ProfilerEnd - Stops timing the zone started last.
+		  ProfilerGetStats - Returns the last, min, avg and p99 time of a zone.
+		  ProfilerGetZoneName - Returns the name a zone is shown and saved with.
+		  ProfilerSaveTrace - Writes the zones of the last frames to a Chrome trace file.
+		  ProfilerGetSeconds - Returns the time on the profiler's clock, for timing things longer than a frame.
+
+		  Does not need CProcessing, the game level draws the stats itself.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#pragma once // Only include this header file once
+
+#define PROFILE_HISTORY 240			// Frames the stats are worked out over, 4 seconds at 60fps
+#define PROFILE_TRACE_SIZE 65536	// Zones kept for the trace, the oldest are written over first
+#define PROFILE_TRACE_PATH "profile.json"
+
+/*______________________________________________________________
+@brief Everything that is timed. The turn event zones are in the same order as TurnEventType, so
+	   PROFILE_PLAYER_START + event_type is the zone of an event.
+*/
+typedef enum {
+	PROFILE_FRAME,
+	PROFILE_TWEENS,
+	PROFILE_CAMERA_SHAKE,
+	PROFILE_GRID,
+	PROFILE_ENEMIES,
+	PROFILE_GAME_LOOP,
+	PROFILE_EFFECTS,
+	PROFILE_HAND,
+	PROFILE_HINT,
+	PROFILE_WAVE_TEXT,
+	PROFILE_MOUSE_ICON,
+	PROFILE_ENEMY_INFO,
+	PROFILE_WIZARD,
+	PROFILE_LIFE,
+	PROFILE_WIN_CHECK,
+	PROFILE_CLEAR,
+
+	PROFILE_PLAYER_START,
+	PROFILE_PLAYER_UPDATE,
+	PROFILE_PLAYER_END,
+	PROFILE_ZOMBIE_START,
+	PROFILE_ZOMBIE_UPDATE,
+	PROFILE_ZOMBIE_END,
+
+	PROFILE_ZONE_COUNT
+} ProfileZone;
+
+/*______________________________________________________________
+@brief The times of a zone in milliseconds, over the frames it was entered in. A zone entered more than once in a
+	   frame (e.g. an event) counts the total of that frame.
+*/
+typedef struct ProfileStats {
+	float last;
+	float min;
+	float avg;
+	float p99;
+	int frames;			// Frames the stats are over, up to PROFILE_HISTORY
+} ProfileStats;
+
+/*______________________________________________________________
+@brief Starts or stops timing. Zones cost a single check while it is off.
+*/
+void ProfilerSetEnabled(_Bool enabled);
+
+/*______________________________________________________________
+@brief Returns if zones are being timed.
+*/
+_Bool ProfilerIsEnabled(void);
+
+/*______________________________________________________________
+@brief Forgets every frame timed so far, the stats and the trace start over.
+*/
+void ProfilerReset(void);
+
+/*______________________________________________________________
+@brief Needs to be called at the very start of the update, starts the PROFILE_FRAME zone.
+*/
+void ProfilerBeginFrame(void);
+
+/*______________________________________________________________
+@brief Needs to be called at the end of the update, stops the PROFILE_FRAME zone and keeps the times of the frame.
+*/
+void ProfilerEndFrame(void);
+
+/*______________________________________________________________
+@brief Starts timing a zone. Every ProfilerBegin needs its ProfilerEnd, zones started inside it have to end first.
+*/
+void ProfilerBegin(ProfileZone zone);
+
+/*______________________________________________________________
+@brief Stops timing the zone, it has to be the one started last.
+*/
+void ProfilerEnd(ProfileZone zone);
+
+/*______________________________________________________________
+@brief Works out the stats of the zone over the last PROFILE_HISTORY frames it was entered in.
+@return FALSE if the zone was not entered since the profiler was enabled or reset
+*/
+_Bool ProfilerGetStats(ProfileZone zone, ProfileStats* stats);
+
+/*______________________________________________________________
+@brief Returns the name the zone is shown and saved with.
+*/
+char const* ProfilerGetZoneName(ProfileZone zone);
+
+/*______________________________________________________________
+@brief Writes the zones of the last frames (up to PROFILE_TRACE_SIZE of them) as Chrome trace events.
+@return FALSE if the file could not be written
+*/
+_Bool ProfilerSaveTrace(char const* path);
+
+/*______________________________________________________________
+@brief Returns the seconds on the clock the zones are timed with, from some point before the game started. Works while
+	   the profiler is off.
+*/
+double ProfilerGetSeconds(void);
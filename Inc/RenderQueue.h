@@ -0,0 +1,63 @@
+/*!
+@file	  RenderQueue.h
+@date     17/10/2026
+@brief    This header file contains the render queue for things drawn many times a frame with only a few looks, like
+		  the dots of the grid and the tiles of the hand. Rects and images are queued with everything they are drawn
+		  with, and drawn together on the flush, grouped by look so the fill, stroke and stroke weight are only set
+		  when they change. There are 4 functions,
+
+		  RenderQueueRect - Queues a rect with its fill, stroke and stroke weight.
+		  RenderQueueImage - Queues an image.
+		  RenderQueueSubImage - Queues a part of an image, tinted.
+		  RenderQueueFlush - Draws everything queued, layer by layer, and empties the queue.
+
+		  Layers are drawn in order, but inside a layer the order is the grouping's, so things in the same layer
+		  must not overlap (touching strokes of the same color are fine). Whatever is over something else goes in a
+		  later layer. LAYER_HELD is the exception, it is drawn in the order it was queued, so each icon of the held
+		  piece is drawn right after its own cell like before. It only has a few cells, so little is lost.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#pragma once // Only include this header file once
+
+#include <cprocessing.h>
+
+#define RENDER_QUEUE_SIZE 1024	// Rects and images that can be queued before a flush, more flushes early
+
+/*______________________________________________________________
+@brief The order things are drawn in on a flush, from the bottom up.
+*/
+typedef enum {
+	LAYER_GRID_DOTS,
+	LAYER_GRID_MARKS,
+	LAYER_PARTICLES,
+	LAYER_HAND_SLOTS,
+	LAYER_HAND_ICONS,
+	LAYER_HAND_TILES,
+	LAYER_HELD,				// Drawn in the order queued
+
+	RENDER_LAYER_COUNT
+} RenderLayer;
+
+/*______________________________________________________________
+@brief Queues a rect, x and y are its top left corner (CP_POSITION_CORNER).
+*/
+void RenderQueueRect(RenderLayer layer, float x, float y, float w, float h, CP_Color fill, CP_Color stroke, float stroke_weight);
+
+/*______________________________________________________________
+@brief Queues an image, drawn like CP_Image_Draw. The same images of a layer are drawn one after another.
+*/
+void RenderQueueImage(RenderLayer layer, CP_Image image, float x, float y, float w, float h, int alpha);
+
+/*______________________________________________________________
+@brief Queues the part of an image from u0, v0 to u1, v1 (in pixels), drawn like CP_Image_DrawSubImage with its color
+	   multiplied by tint. The tint's alpha is the alpha of the draw. The tint is only set when it changes.
+*/
+void RenderQueueSubImage(RenderLayer layer, CP_Image image, float x, float y, float w, float h, float u0, float v0, float u1, float v1, CP_Color tint);
+
+/*______________________________________________________________
+@brief Draws everything queued and empties the queue. Leaves the rect mode at CP_POSITION_CORNER and the tint off, the
+	   fill, stroke and stroke weight are those of the last rect drawn.
+*/
+void RenderQueueFlush(void);
@@ -0,0 +1,587 @@
+/*!
+@file	  SimCore.h
+@date     16/10/2026
+@brief    This header file contains the rules of the game (the board, the wave director, enemy stats, hearts and the
+		  Tetris piece bag and hand) with no CProcessing or windows dependency, so whole games can be stepped headless.
+		  All of a game's state lives in one SimState, presentation (particles, sounds) hooks in through SimHooks.
+		  The game itself keeps one SimState in WaveSystem.c, see GetGameState().
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#pragma once // Only include this header file once
+
+#include "SimRandom.h" // For the random number streams of each game
+
+#ifndef TRUE
+#define TRUE 1
+#endif
+#ifndef FALSE
+#define FALSE 0
+#endif
+
+//______________________________________________________________
+// Board settings
+#define	TOTAL_YGRID 7
+#define TOTAL_XGRID 13								//The last column is where zombies spawn, the rest is the playing area
+
+//Total count of all possible enemies in the grid with a bit extra as a buffer
+#define WAVEOBJECTCOUNT (TOTAL_XGRID*TOTAL_YGRID*3)
+#define MAXENEMYCOUNT 20							//The maximum amount of enemies that can be queued in a wave
+#define ENEMYPOOL 10
+
+#define WAVES_TO_WIN 30
+#define MAX_HEART_COUNT 3
+
+//______________________________________________________________
+// Tetris Spawn settings
+
+/* Each bag contains 1 of each piece, meaning if there are 2 bags and 7 total pieces, only 14 pieces will be in play at a time,
+   DO NOT set the sizes of the hand and peek to be larger than the size of all the bags */
+#define TOTAL_BAGS 2
+#define HAND_SIZE 3             // How many pieces can the player hold at a time
+#define PEEK_SIZE 2             // How many pieces can the player see coming next
+
+typedef enum ZombieType{
+    ZOMBIE,
+    LEAPER,
+    TANK,
+    BREAKER,
+    GRAVE,
+	WALL,
+	ZOMBIE_TYPE_LENGTH
+} ZombieType;
+
+typedef struct EnemyInfo{
+	//Position
+	int x;
+	int y;
+	//Cost to spawn
+	int Cost;
+	//Movement of tiles per turn
+	int MovementSpeed;
+	int damage;
+	//Health
+	int Health;
+	int MaxHealth;
+	//For the time being, it's the "sprite"
+	char* CharSprite;
+	ZombieType type;
+	_Bool moveCooldown;	//IUsed for grave spawn cooldowns
+	//Helps check if the enemy needs to be rendered or not
+	_Bool isAlive;
+
+} EnemyInfo;
+
+/*______________________________________________________________
+@brief What every enemy of a type shares. Only the prefabs and this table have it, the board doesn't store it per enemy.
+*/
+typedef struct SimEnemyStats{
+	int Cost;
+	int MovementSpeed;
+	int damage;
+	int MaxHealth;
+	char* CharSprite;
+} SimEnemyStats;
+
+/*______________________________________________________________
+@brief The objects on the board, stored as one array per field indexed by slot. Only what changes from turn to turn is
+	   kept here, so a pass over the board pulls in a few bytes per object instead of a whole EnemyInfo.
+	   The rest comes from the object's type, see SimGetEnemyStats(), or use SimGetEnemyInSlot() for a full copy.
+*/
+typedef struct SimWaveObjects{
+	signed char x[WAVEOBJECTCOUNT];			//Goes past the left of the board for the move that reaches the player
+	signed char y[WAVEOBJECTCOUNT];
+	short health[WAVEOBJECTCOUNT];
+	unsigned char type[WAVEOBJECTCOUNT];	//ZombieType
+	_Bool moveCooldown[WAVEOBJECTCOUNT];
+	_Bool isAlive[WAVEOBJECTCOUNT];
+} SimWaveObjects;
+
+/*______________________________________________________________
+@brief All possible Tetris Piece types
+*/
+#define TOTAL_PIECES 7
+typedef enum{
+	I_PIECE,
+	O_PIECE,
+	T_PIECE,
+	L_PIECE,
+	J_PIECE,
+	Z_PIECE,
+	S_PIECE
+} PieceType;
+
+#define SHAPE_BOUNDS 6 // The maximum size of pieces (e.g. if set to 5, maximum size of a piece is a 5x5 block)
+
+/*______________________________________________________________
+@brief Indicators to tell which orientation the Tetris piece is in right now, each one is another turn to the right.
+*/
+typedef enum{
+	UP,
+	RIGHT,
+	DOWN,
+	LEFT,
+	ROTATION_TYPE_LENGTH
+} PieceOrientation;
+
+//______________________________________________________________
+// All possible Tetris Piece shapes
+
+/* Preview: #
+			#
+			#
+			# */
+#define I_PIECE_SHAPE "#\n#\n#\n#"
+
+/* Preview: ##
+			## */
+#define O_PIECE_SHAPE "##\n##"
+
+/* Preview: ###
+			 # */
+#define T_PIECE_SHAPE "###\n0#"
+
+/* Preview: ##
+			 #
+			 # */
+#define L_PIECE_SHAPE "##\n0#\n0#"
+
+/* Preview: ##
+			#
+			# */
+#define J_PIECE_SHAPE "##\n#\n#"
+
+/* Preview: ##
+			 ## */
+#define Z_PIECE_SHAPE "##\n0##"
+
+/* Preview:  ##
+			## */
+#define S_PIECE_SHAPE "0##\n##"
+
+/*______________________________________________________________
+@brief A cell offset from where the piece is dropped, used for the cells a piece covers (or just a cell of the board).
+*/
+typedef struct SimCell{
+	int x;
+	int y;
+} SimCell;
+
+/*______________________________________________________________
+@brief One orientation of a piece, worked out once by SimInitPieceShapes(). The covered cells are packed into a mask
+	   only as big as the piece, bit x of rows[y] is covered. The cell the piece is dropped on (the one the player
+	   holds it by) is anchorX,anchorY in the mask, so the piece sits on the board at x-anchorX,y-anchorY.
+*/
+typedef struct SimPieceShape{
+	uint16_t rows[SHAPE_BOUNDS];
+	int width, height;
+	int anchorX, anchorY;
+	int cellCount;
+	SimCell cells[SHAPE_BOUNDS*SHAPE_BOUNDS];	//The covered cells as offsets from the drop cell, row by row
+} SimPieceShape;
+
+/*______________________________________________________________
+@brief One bit per cell of the board, bit x of rows[y] is the cell x,y. A whole row fits in one uint16_t, so checking
+	   a row or every cell a piece covers is a few ANDs and shifts instead of a lookup per cell.
+*/
+typedef struct SimBitboard{
+	uint16_t rows[TOTAL_YGRID];
+} SimBitboard;
+
+/*______________________________________________________________
+@brief One turn of the player: which piece of the hand, how it is rotated and the cell it is dropped on.
+*/
+typedef struct SimMove{
+	int slot;			//Hand slot, 0 is the wall piece
+	int rotation;		//Times rotated 90 degrees to the right
+	int x;
+	int y;
+} SimMove;
+
+/*______________________________________________________________
+@brief Things that happen on the board that the game might want to show or play a sound for.
+*/
+typedef enum SimEventType{
+	SIM_ENEMY_SPAWNED,		//A wave enemy spawned in
+	SIM_GRAVE_HATCHED,		//A grave got replaced by a random enemy
+	SIM_WALL_BUILT,
+	SIM_ENEMY_KILLED,		//Killed by the player, the enemy is already despawned but keeps its x,y and type
+	SIM_WALL_DESTROYED,		//A zombie broke a wall
+	SIM_WALL_BREACHED,		//A zombie moved into the space of the wall it just broke
+	SIM_ENEMY_MOVED,
+	SIM_PLAYER_HIT,			//A zombie walked past the last column, x is already off the board
+	SIM_HEART_LOST,			//enemy is NULL
+	SIM_EVENT_TYPE_LENGTH
+} SimEventType;
+
+/*______________________________________________________________
+@brief Each part of the rules draws from its own random stream, so extra draws in one part don't change the others.
+*/
+typedef enum SimRandomStream{
+	SIM_RANDOM_BAG,			//Shuffling the piece bags
+	SIM_RANDOM_WAVE,		//Picking the enemies for a wave
+	SIM_RANDOM_SPAWN,		//Picking the spawn cells and how many enemies spawn in a turn
+	SIM_RANDOM_GRAVE,		//Picking what comes out of a grave
+	SIM_RANDOM_STREAM_LENGTH
+} SimRandomStream;
+
+/*______________________________________________________________
+@brief Callbacks for the presentation side, any of them can be NULL. The enemy passed to OnEvent is a copy that is only
+	   valid during the call.
+*/
+typedef struct SimHooks{
+	void (*OnEvent)(SimEventType type, EnemyInfo const* enemy, void* userData);
+	void* userData;
+} SimHooks;
+
+/*______________________________________________________________
+@brief Everything that makes up one game. There are no pointers into the state itself so it can be copied around freely.
+*/
+typedef struct SimState{
+	//Board
+	SimWaveObjects waveObjects;							//All the enemies (and walls) of the wave
+	short cellObjects[TOTAL_XGRID][TOTAL_YGRID];		//Slot index + 1 of the live object in each cell, 0 means empty
+	short freeSlots[WAVEOBJECTCOUNT];					//Stack of the free waveObjects slots, spawns take the top one
+	short freeCount;
+	short liveSlots[WAVEOBJECTCOUNT];					//Every live waveObjects slot packed together, in no particular order
+	short livePositions[WAVEOBJECTCOUNT];				//Where each live slot is in liveSlots
+	short liveCount;
+	SimBitboard occupied;								//The cells with a live object, always in sync with cellObjects
+	SimBitboard typeMasks[ZOMBIE_TYPE_LENGTH];			//The same split by the type in the cell, walls are typeMasks[WALL]
+
+	//Wave
+	unsigned char enemiesToSpawn[MAXENEMYCOUNT];		//Prefab index of each enemy, populated in SimGenerateWave()
+	int enemySpawnIndex;
+	int waveIndex;				//Used to keep track of which enemy to spawn in enemiesToSpawn
+	int waveCredits;
+	int currentWave;
+	int enemiesKilled;
+
+	//Player
+	int hearts;
+	PieceType hand[HAND_SIZE];							//Slot 0 is always the wall (shield) piece
+	PieceType peekHand[PEEK_SIZE];
+	PieceType piecesBag[TOTAL_BAGS][TOTAL_PIECES];		//The Tetris Pieces queue
+	int currentBag;
+	int currentIndex;
+
+	//Randomness, the same seed always plays out the same game
+	uint64_t seed;
+	SimRandom random[SIM_RANDOM_STREAM_LENGTH];
+
+	SimHooks hooks;
+} SimState;
+
+/*______________________________________________________________
+@brief A saved game, see SimSaveSnapshot(). It is the whole SimState with the hooks cleared, so it is a few kilobytes
+	   of plain data that can be kept in an array, copied with memcpy or written to a file as is.
+*/
+typedef struct SimSnapshot{
+	SimState state;
+} SimSnapshot;
+
+/*____________________________________________________________________*/
+
+/*
+@brief Initialises the enemy prefabs, shared by every SimState. MUST BE CALLED ONCE before any game is started.
+*/
+void SimInitEnemyPool(void);
+/*____________________________________________________________________*/
+
+/*
+@brief Returns the total count of enemy prefabs
+*/
+int SimGetEnemyCount(void);
+/*____________________________________________________________________*/
+
+/*
+@brief Returns the enemy prefab at the index. Index 0 is the wall.
+*/
+EnemyInfo* SimGetEnemyPrefab(int index);
+/*____________________________________________________________________*/
+
+/*
+@brief Returns the stats shared by every enemy of the type.
+*/
+SimEnemyStats const* SimGetEnemyStats(ZombieType type);
+/*____________________________________________________________________*/
+
+/*
+@brief Clears the state for a new game (empty board, wave 1, full hearts) without generating a wave or filling the bags.
+@param[in] hooks the callbacks to use, can be NULL.
+@param[in] seed seeds all the random streams of the game.
+*/
+void SimInit(SimState* sim, SimHooks const* hooks, uint64_t seed);
+/*____________________________________________________________________*/
+
+/*
+@brief Starts a whole new game: SimInit, fills the bags and the player's hand and generates the first wave.
+@param[in] hooks the callbacks to use, can be NULL.
+@param[in] seed seeds all the random streams of the game.
+*/
+void SimNewGame(SimState* sim, SimHooks const* hooks, uint64_t seed);
+/*____________________________________________________________________*/
+
+/*
+@brief Saves the whole game into the snapshot, it is one copy of the state so it is cheap enough to do every turn.
+*/
+void SimSaveSnapshot(SimState const* sim, SimSnapshot* snapshot);
+/*____________________________________________________________________*/
+
+/*
+@brief Puts the game back to how it was when the snapshot was saved. The hooks of sim are kept, the snapshot has none.
+*/
+void SimRestoreSnapshot(SimState* sim, SimSnapshot const* snapshot);
+/*____________________________________________________________________*/
+
+/*
+@brief Hashes what the rules can see of the game: every cell of the board, the wave, hearts, pieces and random streams.
+	   Two states that play out the same from here on hash the same, no matter which waveObjects slots they use.
+*/
+uint32_t SimHashState(SimState const* sim);
+/*____________________________________________________________________*/
+
+/*
+@brief Generates the wave using wave credits and populates the enemies to spawn
+*/
+void SimGenerateWave(SimState* sim);
+/*____________________________________________________________________*/
+
+/*
+@brief Starts the next wave.
+*/
+void SimNextWave(SimState* sim);
+/*____________________________________________________________________*/
+
+/*
+@brief The zombie's turn: moves all the enemies, spawns the next enemies of the wave and starts the next wave if needed.
+*/
+void SimZombieTurn(SimState* sim);
+/*____________________________________________________________________*/
+
+/*
+@brief Spawns random enemy at cell occupied by grave enemy
+*/
+void SimSpawnTombEnemies(SimState* sim);
+/*____________________________________________________________________*/
+
+/*
+@brief Spawns specified enemy at a random spawn cell based off of the enemy type.
+*/
+void SimSpawnEnemy(SimState* sim, EnemyInfo* enemy);
+/*____________________________________________________________________*/
+
+/*
+@brief Spawns specified enemy to the cell specified if it is unoccupied
+*/
+void SimSpawnEnemyInCell(SimState* sim, int x, int y, EnemyInfo const* enemy);
+/*____________________________________________________________________*/
+
+/*
+@brief Creates a wall in the specified cell if it's unoccupied.
+*/
+void SimCreateWall(SimState* sim, int x, int y);
+/*____________________________________________________________________*/
+
+/*
+@brief Sends damage from the player to the enemy in the cell. Walls are not affected.
+*/
+void SimSendDamage(SimState* sim, int x, int y, int damage);
+/*____________________________________________________________________*/
+
+/*
+@brief Function for zombies to send damage to the thing in the cell (walls).
+*/
+void SimZombieDealDamage(SimState* sim, int x, int y, int damage);
+/*____________________________________________________________________*/
+
+/*
+@brief Movement of the enemy in the slot, the enemy damages the player if it walks past the last column.
+*/
+void SimMoveEnemy(SimState* sim, int slot);
+/*____________________________________________________________________*/
+
+/*
+@brief Returns the waveObjects slot of the live enemy (or wall) in the specified cell, -1 if there is none.
+*/
+int SimGetSlot(SimState const* sim, int x, int y);
+/*____________________________________________________________________*/
+
+/*
+@brief Copies everything about the enemy in the slot, with its type's stats, into one EnemyInfo.
+*/
+void SimGetEnemyInSlot(SimState const* sim, int slot, EnemyInfo* enemy);
+/*____________________________________________________________________*/
+
+/*
+@brief Copies the live enemy (or wall) in the specified cell into enemy.
+@return FALSE if the cell is empty, enemy is left untouched then.
+*/
+_Bool SimGetEnemy(SimState const* sim, int x, int y, EnemyInfo* enemy);
+/*____________________________________________________________________*/
+
+/*
+@brief Checks if there is a live enemy (or wall) in the specified cell
+*/
+_Bool SimHasLiveEnemy(SimState const* sim, int x, int y);
+/*____________________________________________________________________*/
+
+/*
+@brief Checks if there is a wall in the specified cell
+*/
+_Bool SimHasWall(SimState const* sim, int x, int y);
+/*____________________________________________________________________*/
+
+/*
+@brief Checks if there is a zombie (anything live but a wall) in row y between the columns fromX and toX (inclusive).
+*/
+_Bool SimHasZombieInRow(SimState const* sim, int y, int fromX, int toX);
+/*____________________________________________________________________*/
+
+/*
+@brief Gets the cells of the board with a zombie in them, walls are left out.
+*/
+void SimGetZombieMask(SimState const* sim, SimBitboard* mask);
+/*____________________________________________________________________*/
+
+/*
+@brief Checks if all the enemies in the grid are dead. Walls don't count.
+*/
+_Bool SimIsAllEnemiesDead(SimState const* sim);
+/*____________________________________________________________________*/
+
+/*
+@brief Returns true if the cell index is where the player can play pieces (the board without the spawn column)
+*/
+_Bool SimIsInPlayingArea(int x, int y);
+/*____________________________________________________________________*/
+
+/*
+@brief Resets the board and wave stats (the hearts and pieces are kept).
+*/
+void SimResetGame(SimState* sim);
+/*____________________________________________________________________*/
+
+/*
+@brief Removes lives from the player, it won't go below 0.
+*/
+void SimLoseHearts(SimState* sim, int count);
+/*____________________________________________________________________*/
+
+/*
+@brief Gives lives back to the player, up to MAX_HEART_COUNT.
+*/
+void SimGainHearts(SimState* sim, int count);
+/*____________________________________________________________________*/
+
+/*
+@brief Returns true if the player has lost all their hearts
+*/
+_Bool SimIsGameLost(SimState const* sim);
+/*____________________________________________________________________*/
+
+/*
+@brief Returns true if the player survived the last wave
+*/
+_Bool SimIsGameWon(SimState const* sim);
+/*____________________________________________________________________*/
+
+/*
+@brief Fills and shuffles all the piece bags.
+*/
+void SimFillBags(SimState* sim);
+/*____________________________________________________________________*/
+
+/*
+@brief Draws the next piece from the queue, the queue will never run out of pieces.
+*/
+PieceType SimDrawFromBag(SimState* sim);
+/*____________________________________________________________________*/
+
+/*
+@brief Fills the player's hand and then the peek queue from the bag.
+*/
+void SimFillHand(SimState* sim);
+/*____________________________________________________________________*/
+
+/*
+@brief Removes the piece in the hand slot, shifts the rest forward and pulls the next piece in from the peek queue.
+*/
+void SimRemoveFromHand(SimState* sim, int slot);
+/*____________________________________________________________________*/
+
+/*
+@brief Works out every orientation of every piece. MUST BE CALLED ONCE before any piece is played or rotated.
+*/
+void SimInitPieceShapes(void);
+/*____________________________________________________________________*/
+
+/*
+@brief Returns the piece in the orientation, the same table is used to draw, play and score pieces.
+*/
+SimPieceShape const* SimGetPieceShape(PieceType type, PieceOrientation orientation);
+/*____________________________________________________________________*/
+
+/*
+@brief Gets the cells a piece covers, as offsets from the cell it is dropped on (same as the piece held in game).
+@param[in] rotation how many times the piece is rotated 90 degrees to the right
+@param[out] cells has to fit SHAPE_BOUNDS*SHAPE_BOUNDS cells
+@return the number of cells written
+*/
+int SimGetPieceCells(PieceType type, int rotation, SimCell* cells);
+/*____________________________________________________________________*/
+
+/*
+@brief Gets the cells of the playing area a piece dropped on x,y covers, cells hanging off it are left out.
+@param[in] rotation how many times the piece is rotated 90 degrees to the right
+*/
+void SimGetPieceMask(PieceType type, int rotation, int x, int y, SimBitboard* mask);
+/*____________________________________________________________________*/
+
+/*
+@brief Narrows the cells a piece covers down to the ones it acts on: the empty cells for the wall slot (0), the zombies
+	   for the rest.
+*/
+void SimGetPieceTargets(SimState const* sim, int slot, SimBitboard const* covered, SimBitboard* targets);
+/*____________________________________________________________________*/
+
+/*
+@brief Sets the bit of the cell, cells off the board are ignored.
+*/
+void SimBitboardSet(SimBitboard* board, int x, int y);
+/*____________________________________________________________________*/
+
+/*
+@brief Returns true if the bit of the cell is set, FALSE for cells off the board.
+*/
+_Bool SimBitboardTest(SimBitboard const* board, int x, int y);
+/*____________________________________________________________________*/
+
+/*
+@brief Lists the set cells row by row, from the top left.
+@param[out] cells has to fit TOTAL_XGRID*TOTAL_YGRID cells
+@return the number of cells written
+*/
+int SimBitboardGetCells(SimBitboard const* board, SimCell* cells);
+/*____________________________________________________________________*/
+
+/*
+@brief Plays the piece in the hand slot dropped on x,y: the wall slot builds walls, the rest damage the enemies.
+	   The piece is then removed from the hand. Cells outside the playing area are skipped.
+@return FALSE if the slot or the cell it is dropped on is invalid, nothing is played then.
+*/
+_Bool SimPlayPiece(SimState* sim, int slot, int rotation, int x, int y);
+/*____________________________________________________________________*/
+
+/*
+@brief Ends the player's turn: graves hatch, then the zombies take their turn.
+*/
+void SimEndTurn(SimState* sim);
+/*____________________________________________________________________*/
+
+/*
+@brief One whole turn, SimPlayPiece then SimEndTurn.
+@return FALSE if the piece could not be played, the turn does not end then.
+*/
+_Bool SimStepTurn(SimState* sim, int slot, int rotation, int x, int y);
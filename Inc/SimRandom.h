@@ -0,0 +1,43 @@
+/*!
+@file	  SimRandom.h
+@date     16/10/2026
+@brief    This header file contains the random number generator used by the game rules. Each SimState holds its own
+		  generators (one per stream, see SimRandomStream in SimCore.h) so games never share random numbers and the same
+		  seed always plays out the same, no matter how many games are running at once or on which thread.
+
+		  The generator is xoshiro128** (http://prng.di.unimi.it/), seeded through splitmix64.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#pragma once // Only include this header file once
+
+#include <stdint.h>
+
+/*______________________________________________________________
+@brief The state of one random number stream, plain data so it can be copied with the rest of the game state.
+*/
+typedef struct SimRandom{
+	uint32_t state[4];
+} SimRandom;
+
+/*____________________________________________________________________*/
+
+/*
+@brief Seeds the stream. Different stream numbers with the same seed give unrelated sequences.
+@param[in] seed the seed of the game
+@param[in] stream which stream of the game this is
+*/
+void SimRandomSeed(SimRandom* random, uint64_t seed, uint32_t stream);
+/*____________________________________________________________________*/
+
+/*
+@brief Returns the next 32 random bits of the stream.
+*/
+uint32_t SimRandomNext(SimRandom* random);
+/*____________________________________________________________________*/
+
+/*
+@brief Returns a random int between lower and upper (both inclusive) without modulo bias. The bounds can be either way round.
+*/
+int SimRandomRange(SimRandom* random, int lower, int upper);
@@ -0,0 +1,114 @@
+/*!
+@file	  SimReplay.h
+@date     17/10/2026
+@brief    This header file contains replays. A replay is the seed of a game and what the player did each turn (which
+		  piece of the hand, how many times it was turned and the cell it was dropped on), so a whole game is a few
+		  bytes a turn. Playing it back with SimReplayPlay() runs the rules headless as fast as they go.
+
+		  Every move also keeps the SimHashState() of the game after the zombie turn that follows it, so a replay
+		  played back on changed rules points at the first turn that plays out differently.
+
+		  Scripted spawns (the tutorial zombies) are kept as their own actions, since they depend on the window size.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#pragma once // Only include this header file once
+
+#include "SimCore.h"
+
+#define SIM_REPLAY_VERSION 1
+
+typedef enum SimReplayActionType{
+	SIM_REPLAY_MOVE,		//The player played a piece, the zombies then took their turn
+	SIM_REPLAY_SPAWN		//An enemy was put straight into a cell, see SimSpawnEnemyInCell
+} SimReplayActionType;
+
+/*______________________________________________________________
+@brief One action of the game. Saved as 9 bytes.
+*/
+typedef struct SimReplayAction{
+	unsigned char type;			//SimReplayActionType
+	unsigned char index;		//Hand slot of a move, ZombieType of a spawn
+	unsigned char rotation;		//Times the piece was turned to the right
+	signed char x;
+	signed char y;
+	uint32_t hash;				//SimHashState after the zombie turn that follows a move, 0 for spawns
+} SimReplayAction;
+
+/*______________________________________________________________
+@brief A game being recorded or played back. The actions grow as they are recorded, SimReplayFree() frees them.
+*/
+typedef struct SimReplay{
+	uint64_t seed;
+	SimReplayAction* actions;
+	int count;
+	int capacity;
+	int pendingMove;			//Move waiting for the state after its turn to be hashed, -1 if there is none
+} SimReplay;
+
+/*______________________________________________________________
+@brief How playing back a replay went.
+*/
+typedef struct SimReplayResult{
+	int turns;					//Moves played back
+	int mismatchAction;			//First action the game played out differently on, -1 if every hash matched
+	_Bool invalidAction;		//The mismatch was a move the rules would not play
+} SimReplayResult;
+
+/*____________________________________________________________________*/
+
+/*
+@brief Starts an empty replay of the game with the seed.
+*/
+void SimReplayInit(SimReplay* replay, uint64_t seed);
+/*____________________________________________________________________*/
+
+/*
+@brief Frees the actions, the replay is empty afterwards.
+*/
+void SimReplayFree(SimReplay* replay);
+/*____________________________________________________________________*/
+
+/*
+@brief Records the move the player is about to play. sim is the game before the move, it also finishes off the
+	   move before this one: everything from it, its zombie turn and the refilled hand has happened by now.
+@return FALSE if there was no memory for the action
+*/
+_Bool SimReplayRecordMove(SimReplay* replay, SimState const* sim, SimMove const* move);
+/*____________________________________________________________________*/
+
+/*
+@brief Records an enemy about to be put into the cell, sim is the game before it is.
+@return FALSE if there was no memory for the action
+*/
+_Bool SimReplayRecordSpawn(SimReplay* replay, SimState const* sim, int x, int y, ZombieType type);
+/*____________________________________________________________________*/
+
+/*
+@brief Hashes the game after the last move, call it once the game is over or left before saving.
+*/
+void SimReplayFinish(SimReplay* replay, SimState const* sim);
+/*____________________________________________________________________*/
+
+/*
+@brief Writes the replay to the file.
+@return FALSE if the file could not be written
+*/
+_Bool SimReplaySave(SimReplay const* replay, char const* path);
+/*____________________________________________________________________*/
+
+/*
+@brief Reads the replay from the file, anything in replay is freed first.
+@return FALSE if the file could not be read or is not a replay of this version
+*/
+_Bool SimReplayLoad(SimReplay* replay, char const* path);
+/*____________________________________________________________________*/
+
+/*
+@brief Plays the replay back from the start, checking the hash after every move. It stops at the first mismatch.
+	   SimInitEnemyPool() and SimInitPieceShapes() MUST have been called.
+@param[out] sim the game played back, left where it stopped
+@param[in] hooks the callbacks to use, can be NULL.
+*/
+SimReplayResult SimReplayPlay(SimReplay const* replay, SimState* sim, SimHooks const* hooks);
@@ -0,0 +1,62 @@
+/*!
+@file	  SimSolver.h
+@date     17/10/2026
+@brief    This header file contains the placement solver. It tries every piece of the hand in every rotation on every
+		  cell and scores what each one leads to: the damage it deals (same as SimSendDamage), the walls it builds (same
+		  as SimCreateWall) and the hearts expected to be lost on the zombie turns after it.
+
+		  Where the zombies spawn and what graves hatch into is random, so the zombie turns are searched as expectimax
+		  chance nodes: each one is averaged over a few sampled spawns instead of reading the game's own random streams
+		  (that would be peeking at the future). The order of the pieces left in the bags is sampled the same way. The
+		  placements at the top are spread over worker threads.
+
+		  The game uses it for the hint shown with H, the balance runner plays with it as the "solver" player.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#pragma once // Only include this header file once
+
+#include "SimCore.h"
+
+#define SIM_SOLVER_MAX_PLACEMENTS (HAND_SIZE*ROTATION_TYPE_LENGTH*(TOTAL_XGRID-1)*TOTAL_YGRID)
+
+/*______________________________________________________________
+@brief How hard the solver searches. SimSolverDefaultSettings() gives settings quick enough for a single frame.
+*/
+typedef struct SimSolverSettings{
+	int depth;			//Player turns to look ahead, 1 only looks at the zombie turn right after the placement
+	int samples;		//Sampled spawns each zombie turn is averaged over
+	int beamWidth;		//Past the first turn only the best this many placements (by what they do right away) are searched
+	int threadCount;	//Threads to spread the placements over, 0 uses every core
+	uint64_t seed;		//Seeds the sampled spawns, the same state, settings and seed always give the same answer
+} SimSolverSettings;
+
+/*______________________________________________________________
+@brief One placement of the hand and how it scored. Placements that hit exactly the same cells with the same piece are
+	   only scored once, the first one found is kept.
+*/
+typedef struct SimSolverPlacement{
+	SimMove move;
+	float score;			//Expected score, higher is better
+	float heartsLost;		//Expected hearts lost on the zombie turn right after
+	int damage;				//Damage dealt to zombies by the placement itself
+	int kills;				//Zombies the placement kills
+	int walls;				//Walls the placement builds
+} SimSolverPlacement;
+
+/*____________________________________________________________________*/
+
+/*
+@brief Fills in the default settings: depth 1, a handful of samples and every core.
+*/
+void SimSolverDefaultSettings(SimSolverSettings* settings);
+/*____________________________________________________________________*/
+
+/*
+@brief Scores every distinct placement of the hand, best first. The state is only read, never changed.
+	   SimInitPieceShapes() and SimInitEnemyPool() MUST have been called.
+@param[out] placements has to fit maxPlacements, SIM_SOLVER_MAX_PLACEMENTS is always enough
+@return the number of placements written, 0 if the game is already over
+*/
+int SimSolve(SimState const* sim, SimSolverSettings const* settings, SimSolverPlacement* placements, int maxPlacements);
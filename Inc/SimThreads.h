@@ -0,0 +1,68 @@
+/*!
+@file	  SimThreads.h
+@date     17/10/2026
+@brief    This header file contains the little bit of threading the headless tools and the solver need: how many cores
+		  there are, and running the same job over an array of work items with one thread each. The asset loader also
+		  runs a job in the background, and says how far it got with an atomic count. Win32 threads on windows,
+		  pthreads everywhere else.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#pragma once // Only include this header file once
+
+#include <stddef.h> // For size_t
+
+#define SIM_MAX_THREAD_COUNT 256
+
+/*______________________________________________________________
+@brief The job each thread runs, item points at that thread's work item.
+*/
+typedef void (*SimThreadJob)(void* item);
+
+/*______________________________________________________________
+@brief A thread running in the background, from SimStartThread.
+*/
+typedef struct SimThread SimThread;
+
+/*____________________________________________________________________*/
+
+/*
+@brief Returns how many cores the machine has, at least 1.
+*/
+int SimGetCoreCount(void);
+/*____________________________________________________________________*/
+
+/*
+@brief Runs job on each of the count items, every item on its own thread with the first one on the calling thread.
+	   Returns once every job is done. If a thread can't be started its item is run on the calling thread instead.
+@param[in] items the first work item, the rest follow every itemSize bytes
+@param[in] count how many items (and threads) there are, up to SIM_MAX_THREAD_COUNT
+*/
+void SimRunThreads(SimThreadJob job, void* items, size_t itemSize, int count);
+/*____________________________________________________________________*/
+
+/*
+@brief Starts job on item in a new thread and returns straight away. If a thread can't be started the job is run on the
+	   calling thread before returning, and NULL is returned.
+*/
+SimThread* SimStartThread(SimThreadJob job, void* item);
+/*____________________________________________________________________*/
+
+/*
+@brief Waits for the thread's job to be done and frees the thread. Does nothing for NULL.
+*/
+void SimJoinThread(SimThread* thread);
+/*____________________________________________________________________*/
+
+/*
+@brief Reads a value another thread sets with SimAtomicStore. Everything that thread wrote before storing it can be read
+	   once the value is seen.
+*/
+int SimAtomicLoad(int volatile* value);
+/*____________________________________________________________________*/
+
+/*
+@brief Sets a value for other threads to read with SimAtomicLoad, after everything written before it.
+*/
+void SimAtomicStore(int volatile* value, int newValue);
@@ -11,6 +11,8 @@ ________________________________________________________________________________
 #include <cprocessing.h>
 
 #define SOUNDCOUNT 25   //designating 25 sounds as the max count
+#define SOUND_MAX_VOICES 4  //Most times one clip can be playing at once
+#define SOUND_MAX_GAIN 2.f  //Loudest a clip asked for many times in a frame gets, times its volume
 
 //Enum for clipnames. Add clip names here if more sounds needed
 typedef enum Clip{
@@ -39,12 +41,15 @@ typedef struct SoundClip{
     CP_Sound sound;
     float volumeModifier;
     Clip clipName;
+    float length;       //Seconds a voice of it is counted as playing
+    int maxVoices;      //Times it can be playing at once, up to SOUND_MAX_VOICES
 } SoundClip;
 /*____________________________________________________________________*/
 
 
 /*
-@brief Loads all the sounds in the game. Needs to be called once and only once!
+@brief Gets all the sounds in the game from the asset loader, and sets the sounds queued in a frame to be played at the
+end of it (the post update of CProcessing). Needs to be called once and only once, best once the asset loader is done!
 */
 void InitSoundManager(void);
 /*____________________________________________________________________*/
@@ -67,8 +72,10 @@ void StopAllSounds(void);
 @param[in] clipName is the name of the clip. (Refer to Clip enum)
 @param[in] sound is the CP_Sound_Load("PathName") for the sound
 @param[in] volumeModifier is the base volume of the sound (for when they are too loud)
+@param[in] length is how long the sound is in seconds, 0 if not known
+@param[in] maxVoices is how many times the sound can be playing at once
 */
-void AddSoundToArray(CP_Sound sound,Clip clipName,float volumeModifier);
+void AddSoundToArray(CP_Sound sound,Clip clipName,float volumeModifier,float length,int maxVoices);
 //Returns a sound that matches the clip name. NULL if clipname doesn't exist.
 /*____________________________________________________________________*/
 
@@ -87,7 +94,8 @@ float GetVolume(Clip clipName);
 /*____________________________________________________________________*/
 
 /*
-@brief Plays the specified sound with varied pitch and sets the sound group. Use only GROUP_SFX or GROUP_MUSIC accordingly!
+@brief Plays the specified sound with varied pitch and sets the sound group at the end of the frame. Use only GROUP_SFX
+or GROUP_MUSIC accordingly!
 @param[in] clipName the name of the clip. (Refer to Clip enum)
 @param[in] group the group that the sound belongs too (GROUP_SFX or GROUP_MUSIC)
 */
@@ -95,13 +103,21 @@ void PlaySoundEx(Clip clipName,CP_SOUND_GROUP group);
 /*____________________________________________________________________*/
 
 /*
-@brief Plays the specified sound and sets the sound group. Use only GROUP_SFX or GROUP_MUSIC accordingly!
+@brief Plays the specified sound and sets the sound group at the end of the frame. Use only GROUP_SFX or GROUP_MUSIC
+accordingly! Played many times in a frame it is played once, louder.
 @param[in] clipName the name of the clip. (Refer to Clip enum)
 @param[in] group the group that the sound belongs too (GROUP_SFX or GROUP_MUSIC)
 */
 void PlaySound(Clip clipName,CP_SOUND_GROUP group);
 /*____________________________________________________________________*/
 
+/*
+@brief Plays the sounds queued this frame, a clip once however many times it was asked for unless all its voices are
+still playing. Set as the post update by InitSoundManager.
+*/
+void PlayQueuedSounds(void);
+/*____________________________________________________________________*/
+
 /*
 @brief Sets GROUP_SFX volume
 @param[in] volume the volume to set the SFX to.
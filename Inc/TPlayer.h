@@ -3,15 +3,17 @@
 @author	  Ang Jiawei Jarrett (a.jiaweijarrett@digipen.edu)
 @date     17/11/2022
 @brief    This header file contains a struct used to store positions and piece information (like shape) for rendering,
-          many variables for position scaling based on screen size, hand size, and peek size. As well as 5 functions,
+          many variables for position scaling based on screen size, hand size, and peek size. As well as 7 functions,
 
           TPlayerInit - Needs to be called at the start of the game level so that the player has pieces to play with.
 
           TPlayerProcessInput - Needs to be called in update, checks for player clicks, updates TPlayerHeld to render the held piece accordingly.
           RenderHand - Needs to be called in update, renders everything in the player's hand, all the slots, pieces, text, etc.
           RemovePieceHeldFromHand - When a Tetris Piece is dropped onto the grid, remove it from the player's hand
+          RefreshHand - Rebuilds the pieces shown from the hand in the game state, e.g. after a snapshot is restored
+          GetHandSlotPosition - Returns the top left of a slot in the player's hand, for pointing at it (e.g. the hint)
 
-          FreeIconImages - Needs to be called on the exit of game level, frees the icons for the attack and defend pieces
+          FreeIconImages - Needs to be called on the exit of game level, lets go of the icons for the attack and defend pieces
 
 @license  Copyright  2022 DigiPen, All rights reserved.
 ________________________________________________________________________________________________________*/
@@ -77,6 +79,20 @@ void RenderHand(void);
 void RemovePieceHeldFromHand(void);
 
 /*______________________________________________________________
-@brief Needs to be called on the exit of game level, frees the icons for the attack and defend pieces
+@brief Rebuilds the pieces shown in the hand and peek queue from the hand in the game state, needed whenever the
+       game state changes the hand outside of playing a piece (e.g. restoring a snapshot)
+*/
+void RefreshHand(void);
+
+/*______________________________________________________________
+@brief Returns the top left of the slot in the player's hand, each slot is hand_slot_length wide and tall.
+
+@param[in] index - The slot, 0 is the wall piece
+*/
+CP_Vector GetHandSlotPosition(int index);
+
+/*______________________________________________________________
+@brief Needs to be called on the exit of game level, lets go of the icons for the attack and defend pieces, they are
+	   kept by the asset loader
 */
 void FreeIconImages(void);
@@ -2,8 +2,8 @@
 @file	  TPlayerHeld.h
 @author	  Ang Jiawei Jarrett (a.jiaweijarrett@digipen.edu)
 @date     17/11/2022
-@brief    This header file contains 3 structs used to store information about rotations and rendering,
-          an enum to identify the current piece's rotation and 7 functions,
+@brief    This header file contains a struct used to store information about rendering the piece held and 7 functions,
+          the piece's orientations themselves are precomputed in SimCore.c (see SimGetPieceShape).
 
           TPlayerHeldInit - Called by TPlayer during its initialization, loads the values needed for rendering and such.
           LoadIconImages - Called by TPlayer during its initialization, loads the attack and defend icons.
@@ -31,6 +31,7 @@ typedef struct{
     CP_Vector draw_pos;
     float x_screen_length, y_screen_length;
     CP_Vector center_offset;
+    SimPieceShape const* shape; // The piece in its current orientation, shared with placing it on the grid
 
     CP_Color color;
     CP_Color color_stroke;
@@ -38,32 +39,6 @@ typedef struct{
     int slot_index;
 } PlayerPieceHeld;
 
-/*______________________________________________________________
-@brief Each cell in the piece's shape holds an index based on the origin (middle of array).
-*/
-typedef struct{
-    int grid_x, grid_y;
-    int cell;
-} PieceHeldCell;
-
-/*______________________________________________________________
-@brief Holds all the cells in a SHAPE_BOUNDS by SHAPE_BOUNDS sized grid, used for rotation and rendering.
-*/
-typedef struct{
-    PieceHeldCell grid[SHAPE_BOUNDS * SHAPE_BOUNDS];
-} PieceHeldShape;
-
-/*______________________________________________________________
-@brief Indicators to tell which orientation the Tetris piece is in right now.
-*/
-typedef enum{
-    UP,
-    RIGHT,
-    DOWN,
-    LEFT,
-    ROTATION_TYPE_LENGTH
-} PieceOrientation;
-
 /*______________________________________________________________
 @brief Called by TPlayer during its initialization, this function will load the values needed for rendering and such.
 */
@@ -110,6 +85,6 @@ void NewPieceHeld(TetrisPiece const *new_piece, int slot_index);
 void TPlayerHeldProcessInput(void);
 
 /*______________________________________________________________
-@brief Render the piece held by the player, if any.
+@brief Render the piece held by the player, if any. The cells are queued (RenderQueue.h) and drawn on the next flush.
 */
 void RenderPieceHeld(void);
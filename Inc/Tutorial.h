@@ -12,7 +12,7 @@ ________________________________________________________________________________
 
 #pragma once // Only include this header file once
 
-#include "CProcessing.h" // For CP_Vector & CP_Color
+#include "cprocessing.h" // For CP_Vector & CP_Color
 
 /*______________________________________________________________
 @brief Contains information for rendering text, like colors, position, size.
@@ -0,0 +1,135 @@
+/*!
+@file	  Tween.h
+@date     17/10/2026
+@brief    This header file contains the tweens, for everything that changes over time like the fades, the blinking
+		  and the bobbing hearts. A tween moves a float, vector or color from one value to another over a duration
+		  with an easing, or only keeps time. All tweens are moved on together once a frame by UpdateTweens. There
+		  are 13 functions,
+
+		  UpdateTweens - Moves every tween by a frame and calls the callbacks of those that ended.
+		  TweenTimer - Starts a tween that only keeps time, read with TweenProgress.
+		  TweenFloat - Starts a tween of a float.
+		  TweenVector - Starts a tween of a vector.
+		  TweenColor - Starts a tween of a color.
+		  TweenOnComplete - Sets the function called when a tween ends or goes round.
+		  TweenProgress - Returns how far along a tween is, eased.
+		  TweenIsPlaying - Checks if a tween has not ended yet.
+		  PauseTween - Stops or lets a tween keep time.
+		  RestartTween - Puts a tween back to its start.
+		  StopTween - Ends a tween without calling its callback.
+		  StopAllTweens - Ends every tween, used when leaving a state.
+		  Ease - Returns an easing of a time step.
+
+		  Tweens are kept by handle, a handle of a tween that ended is not playing anymore and does nothing, so it
+		  can be kept and checked safely. TWEEN_NONE is never a tween.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#pragma once // Only include this header file once
+
+#include <cprocessing.h>
+
+#define MAX_TWEENS 256	// Tweens playing at once, more are not started
+#define TWEEN_NONE 0u
+
+typedef unsigned int Tween;
+
+/*______________________________________________________________
+@brief How a tween goes from start to end, see Ease.
+*/
+typedef enum {
+	EASE_LINEAR,
+	EASE_IN_QUAD,
+	EASE_OUT_QUAD,
+	EASE_IN_OUT_QUAD,
+	EASE_IN_CUBIC,
+	EASE_OUT_CUBIC,
+	EASE_SMOOTHSTEP,	// Slow at both ends, t * t * (3 - 2t)
+
+	EASE_COUNT
+} TweenEase;
+
+/*______________________________________________________________
+@brief What a tween does when it gets to the end.
+*/
+typedef enum {
+	TWEEN_ONCE,			// Ends
+	TWEEN_LOOP,			// Starts again from the start
+	TWEEN_PING_PONG		// Goes back to the start, then to the end again, and so on
+} TweenMode;
+
+/*______________________________________________________________
+@brief Called with the data given to TweenOnComplete.
+*/
+typedef void (*TweenCallback)(void* data);
+
+/*______________________________________________________________
+@brief Moves every tween by the frame's delta time, writes their targets and then calls the callbacks of the tweens
+	   that ended or went round this frame. Needs to be called once at the start of the update of a state with tweens.
+*/
+void UpdateTweens(void);
+
+/*______________________________________________________________
+@brief Starts a tween that only keeps time for duration seconds, TweenProgress is how far along it is.
+*/
+Tween TweenTimer(float duration, TweenMode mode);
+
+/*______________________________________________________________
+@brief Starts a tween moving the float target points to from start to end over duration seconds. target is set to
+	   start now, it must stay valid until the tween ends or is stopped.
+*/
+Tween TweenFloat(float* target, float start, float end, float duration, TweenEase ease, TweenMode mode);
+
+/*______________________________________________________________
+@brief Starts a tween moving the vector target points to from start to end, like TweenFloat.
+*/
+Tween TweenVector(CP_Vector* target, CP_Vector start, CP_Vector end, float duration, TweenEase ease, TweenMode mode);
+
+/*______________________________________________________________
+@brief Starts a tween moving the color target points to from start to end channel by channel, like TweenFloat.
+*/
+Tween TweenColor(CP_Color* target, CP_Color start, CP_Color end, float duration, TweenEase ease, TweenMode mode);
+
+/*______________________________________________________________
+@brief Sets the function called with data when the tween ends, or every time it goes round if it loops or ping
+	   pongs. Callbacks are called after every tween is moved, so they can start and stop tweens.
+*/
+void TweenOnComplete(Tween tween, TweenCallback callback, void* data);
+
+/*______________________________________________________________
+@brief Returns how far the tween is from its start to its end, eased, 0 to 1 (going back down when a ping pong comes
+	   back). A tween that is not playing is at its end, 1.
+*/
+float TweenProgress(Tween tween);
+
+/*______________________________________________________________
+@brief Returns TRUE if the tween has not ended and was not stopped.
+*/
+_Bool TweenIsPlaying(Tween tween);
+
+/*______________________________________________________________
+@brief A paused tween keeps its place and does not change its target until it is unpaused.
+*/
+void PauseTween(Tween tween, _Bool paused);
+
+/*______________________________________________________________
+@brief Puts the tween back to its start and sets its target to the start.
+*/
+void RestartTween(Tween tween);
+
+/*______________________________________________________________
+@brief Ends the tween where it is, its callback is not called.
+*/
+void StopTween(Tween tween);
+
+/*______________________________________________________________
+@brief Ends every tween, their callbacks are not called. Needs to be called when leaving a state with tweens, as their
+	   targets may not be used anymore.
+*/
+void StopAllTweens(void);
+
+/*______________________________________________________________
+@brief Returns the easing of the time step t (0 to 1), also 0 to 1.
+*/
+float Ease(TweenEase ease, float t);
@@ -12,15 +12,23 @@ ________________________________________________________________________________
 #include <cprocessing.h>
 #include "EnemyStats.h"
 #include "Grid.h"
+#include "SimCore.h"
+
+#define REPLAY_PATH "last.replay"	//Where the replay of the last game played is saved, in the working directory like Assets
 
-//Total count of all possible enemies in the grid with a bit extra as a buffer
-#define WAVEOBJECTCOUNT (TOTAL_XGRID*TOTAL_YGRID*3)
 /*____________________________________________________________________*/
 
 /*
-@brief Initialises the wave system. MUST BE CALLED AT LEAST ONCE.
+@brief Initialises the wave system and the game state. MUST BE CALLED AT LEAST ONCE.
+@param[in] seed Which seed to use for all the randomness in the game rules (waves, spawns and the Tetris queue).
 */
-void InitWaveSystem(void);
+void InitWaveSystem(int seed);
+/*____________________________________________________________________*/
+
+/*
+@brief Returns the state of the game currently being played, all the rules in SimCore.h work on this.
+*/
+SimState* GetGameState(void);
 /*____________________________________________________________________*/
 
 /*
@@ -49,10 +57,12 @@ void CreateWall(int x, int y);
 /*____________________________________________________________________*/
 
 /*
-@brief Gets the live enemy in the specified cell. NULL if otherwise.
+@brief Copies the live enemy in the specified cell, the board itself doesn't store whole EnemyInfos.
 @param[in] x,y Index of cell to get live enemy in
+@param[out] enemy filled in if there is a live enemy
+@return FALSE if there is no live enemy in the cell
 */
-EnemyInfo* GetAliveEnemyFromGrid(int x, int y);
+_Bool GetAliveEnemyFromGrid(int x, int y, EnemyInfo* enemy);
 /*____________________________________________________________________*/
 
 /*
@@ -62,6 +72,21 @@ EnemyInfo* GetAliveEnemyFromGrid(int x, int y);
 _Bool HasLiveEnemyInCell(int x, int y);
 /*____________________________________________________________________*/
 
+/*
+@brief Checks if there is a wall in the specified cell
+@param[in] x,y Index of cell to check
+*/
+_Bool HasWallInCell(int x, int y);
+/*____________________________________________________________________*/
+
+/*
+@brief Checks if there is a zombie (walls don't count) in the row between the two columns
+@param[in] y Index of the row to check
+@param[in] fromX,toX the first and last column to check (inclusive)
+*/
+_Bool HasZombieInRow(int y, int fromX, int toX);
+/*____________________________________________________________________*/
+
 /*
 @brief Sends specified damage to specified cell
 @param[in] x,y Index of cell to send damage to
@@ -130,6 +155,27 @@ void RenderEnemy(void);
 EnemyInfo* GetEnemyFromGrid(int x, int y);
 /*____________________________________________________________________*/
 
+/*
+@brief Records the move the player is about to play into the replay of the game. Call it before the piece is played.
+@param[in] slot hand slot of the piece, 0 is the wall piece
+@param[in] rotation times the piece was turned to the right
+@param[in] x,y the cell the piece is dropped on
+*/
+void RecordPlayerMove(int slot, int rotation, int x, int y);
+/*____________________________________________________________________*/
+
+/*
+@brief Stops recording the replay (e.g. once playtest mode changes the board), the moves so far are kept.
+*/
+void StopRecording(void);
+/*____________________________________________________________________*/
+
+/*
+@brief Saves the replay of the game to the file and frees it, nothing is saved if no move was played.
+*/
+void SaveReplay(char const* path);
+/*____________________________________________________________________*/
+
 /*
 @brief Resets the game stats and clears the arrays to be repopulated again.
 */
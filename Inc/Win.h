@@ -10,7 +10,7 @@ ________________________________________________________________________________
 #pragma once
 #include "cprocessing.h"
 
-#define WAVES_TO_WIN 30
+#include "SimCore.h" // For WAVES_TO_WIN
 
 /*----------------------------------------------------------------------------
 @brief Initializes the buttons for the Win Screen
@@ -44,6 +44,12 @@ void CheckWinCondition(void);
 ------------------------------------------------------------------------------*/
 void WinAnimation(void);
 
+/*----------------------------------------------------------------------------
+@brief Called when the Win title card has been up long enough, goes to the Win
+screen
+------------------------------------------------------------------------------*/
+void GoToWin(void* data);
+
 /*----------------------------------------------------------------------------
 @brief WinInit state, loads the background, font and all the texts and buttons
 ------------------------------------------------------------------------------*/
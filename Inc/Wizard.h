@@ -37,7 +37,8 @@ void UpdateWizard(void);
 void DrawWizard(Wizard wiz_body_part);
 
 /*----------------------------------------------------------------------------
-@brief Initializes the images for the rotation icon and the mouse right click icon
+@brief Initializes the images for the rotation icon and the mouse right click icon,
+and starts the rotation icon spinning
 ------------------------------------------------------------------------------*/
 void InitMouseIcon(void);
 
@@ -47,6 +48,6 @@ void InitMouseIcon(void);
 void RenderMouseIcon(void);
 
 /*----------------------------------------------------------------------------
-@brief Frees the images of the rotation and right click icon that was loaded previously
+@brief Lets go of the images of the rotation and right click icon, they are kept by the asset loader
 ------------------------------------------------------------------------------*/
 void FreeMouseIcons(void);
\ No newline at end of file
@@ -48,6 +48,13 @@ void ShowPlaytestMode(void);
 /*____________________________________________________________________*/
 
 
+/*
+@brief Shows the last, min, avg and p99 time of every profiler zone, in playtest mode.
+*/
+void ShowProfilerStats(void);
+/*____________________________________________________________________*/
+
+
 /*
 @brief Test function for showing total enemies killed
 */
@@ -0,0 +1,507 @@
+/*!
+@file	  AssetLoader.c
+@date     17/10/2026
+@brief    This source file contains the asset loader, see AssetLoader.h. The files the game needs are listed up front
+		  in the order they are loaded. The thread goes down the list reading each file, decoding the pngs into
+		  pixels and working out how long the wavs are, and counts how far it got. A sprite sheet's frames are decoded
+		  and copied into one image's pixels by the thread too, in rows as wide as MAX_SHEET_WIDTH. The main thread only makes assets
+		  of the files the thread has counted, so the two never work on the same file. CProcessing only loads sounds
+		  from a file, so the main thread loads them again, from the disk cache the thread warmed. Fonts are loaded
+		  when they are first asked for, the splash screen needs the game font straight away. Files are read from the
+		  asset pack when there is one, without a copy, and from the Assets folder when not. There are 24 functions
+		  in this file,
+
+		  StartAssetLoader - Starts the thread loading the game's assets.
+		  UpdateAssetLoader - Turns what the thread loaded into assets, for a few milliseconds.
+		  FinishAssetLoader - Waits for the thread and turns everything left into assets now.
+		  IsAssetLoaderDone - Checks if every asset is ready.
+		  GetAssetLoaderProgress - Returns how much of the loading is done.
+		  GetAssetImage - Returns the image of a file.
+		  GetAssetSheet - Returns the sprite sheet of numbered frame files.
+		  GetAssetSound - Returns the sound of a file.
+		  GetAssetSoundLength - Returns how long the sound of a file is.
+		  GetAssetFont - Returns the font of a file.
+		  ReportTimeToInteractive - Records and prints how long the game took to get to the menu.
+		  GetTimeToInteractive - Returns what ReportTimeToInteractive recorded.
+
+		  LoadAssetFiles - The thread's job, reads and decodes every file listed.
+		  FinishLoadedAssets - Turns the files the thread loaded into assets, within a time.
+		  FinishAsset - Turns a file the thread loaded into its asset.
+		  LoadAssetNow - Loads the asset of a file the thread has not got to yet.
+		  GetAsset - Returns the cache entry of a file, ready to use.
+		  FindAsset - Returns where a file is in the cache.
+		  AddAsset - Adds a file to the cache.
+		  BuildSheet - Lays out a sprite sheet and copies its frames into its pixels.
+		  ReadImagePixels - Reads and decodes a png into pixels.
+		  ReadAsset - Returns the bytes of a file, from the pack or read from the disk.
+		  ReadAssetFile - Reads a whole file into memory.
+		  ReadWavLength - Works out how long a wav file plays for.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "AssetLoader.h"
+#include "AssetPack.h"
+#include "Png.h"
+#include "Profiler.h"		// For the clock
+#include "SimThreads.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>		// For OutputDebugStringA, the game has no console
+#endif
+
+#define MAX_ASSET_PATH 64
+#define MAX_SHEET_WIDTH 4096	// Pixels, sprite sheets start a new row of frames past this
+#define SHEET_PADDING 2			// Clear pixels between the frames of a sheet, so a frame drawn scaled does not take in the next
+
+/*______________________________________________________________
+@brief What a file is loaded as.
+*/
+typedef enum {
+	ASSET_IMAGE,
+	ASSET_SHEET,
+	ASSET_SOUND,
+	ASSET_FONT
+} AssetType;
+
+/*______________________________________________________________
+@brief A file in the cache. The thread only writes what it loaded, and only before counting the file as loaded, the
+	   rest is only used by the main thread.
+*/
+typedef struct Asset {
+	char path[MAX_ASSET_PATH];
+	AssetType type;
+	int frame_count;			// Of sheets
+
+	// Written by the thread
+	unsigned char* pixels;		// Of images and sheets, freed once the image is made
+	int width;
+	int height;
+	SpriteSheet* loaded_sheet;	// Given to sheet once the image is made
+	float file_length;			// Of sounds
+
+	// Main thread only
+	_Bool ready;
+	CP_Image image;
+	SpriteSheet* sheet;
+	CP_Sound sound;
+	CP_Font font;
+	float length;
+} Asset;
+
+/*______________________________________________________________
+@brief A file the thread loads.
+*/
+typedef struct AssetFile {
+	char const* path;
+	AssetType type;
+	int frame_count;			// Of sheets
+} AssetFile;
+
+// In the order they are loaded, what the menu needs first. Files asked for that are not here are loaded when asked.
+static AssetFile const asset_files[] = {
+	{ "Assets/LogoAnim/Logo_%02d.png", ASSET_SHEET, 13 },
+	// The clips of InitSoundManager
+	{ "Assets/GameBGM.wav", ASSET_SOUND, 0 },
+	{ "Assets/MainMenu.wav", ASSET_SOUND, 0 },
+	{ "Assets/EnemyDeathSound.wav", ASSET_SOUND, 0 },
+	{ "Assets/TetrominoExplode.wav", ASSET_SOUND, 0 },
+	{ "Assets/Nuke.wav", ASSET_SOUND, 0 },
+	{ "Assets/LoseHealth.wav", ASSET_SOUND, 0 },
+	{ "Assets/WinSound.wav", ASSET_SOUND, 0 },
+	{ "Assets/MouseClick.wav", ASSET_SOUND, 0 },
+	{ "Assets/GameOver.wav", ASSET_SOUND, 0 },
+	{ "Assets/GainHealth.wav", ASSET_SOUND, 0 },
+	{ "Assets/ZombieSpawn.wav", ASSET_SOUND, 0 },
+	{ "Assets/ZombieMove.wav", ASSET_SOUND, 0 },
+	{ "Assets/WallBuild.wav", ASSET_SOUND, 0 },
+	{ "Assets/GraveSpawn.wav", ASSET_SOUND, 0 },
+	{ "Assets/GameWin.wav", ASSET_SOUND, 0 },
+	{ "Assets/Thud.wav", ASSET_SOUND, 0 },
+	{ "Assets/WallBreak.wav", ASSET_SOUND, 0 },
+	// The options and the game
+	{ "Assets/Slider.png", ASSET_IMAGE, 0 },
+	{ "Assets/Knob.png", ASSET_IMAGE, 0 },
+	{ "Assets/WindowSizeUpBtn.png", ASSET_IMAGE, 0 },
+	{ "Assets/WindowSizeDownBtn.png", ASSET_IMAGE, 0 },
+	{ "Assets/Heart.png", ASSET_IMAGE, 0 },
+	{ "Assets/AttackIcon.png", ASSET_IMAGE, 0 },
+	{ "Assets/ShieldIcon.png", ASSET_IMAGE, 0 },
+	{ "Assets/RotationIcon.png", ASSET_IMAGE, 0 },
+	{ "Assets/MouseRightClickIcon.png", ASSET_IMAGE, 0 },
+};
+
+Asset assets[MAX_ASSETS];
+int asset_count = 0;
+int loader_file_count = 0;		// The first files of assets are the thread's, set before it starts
+int volatile loaded_count = 0;	// Files the thread has loaded, from the first, set with SimAtomicStore
+int finished_count = 0;			// Files the thread loaded that UpdateAssetLoader has looked at
+
+SimThread* loader_thread = NULL;
+_Bool loader_started = FALSE;
+double loader_start_time = 0.0;
+double load_time = -1.0;			// Seconds from StartAssetLoader to every asset being ready
+double time_to_interactive = -1.0;
+
+#pragma region
+void LoadAssetFiles(void* data);
+void FinishLoadedAssets(double budget);
+void FinishAsset(Asset* asset);
+void LoadAssetNow(Asset* asset);
+Asset* GetAsset(char const* path, AssetType type);
+int FindAsset(char const* path, AssetType type);
+Asset* AddAsset(char const* path, AssetType type);
+SpriteSheet* BuildSheet(char const* path_format, int frame_count, _Bool use_cprocessing, unsigned char** pixels, int* width, int* height);
+unsigned char* ReadImagePixels(char const* path, int* width, int* height, _Bool use_cprocessing);
+unsigned char const* ReadAsset(char const* path, size_t* size, unsigned char** read);
+unsigned char* ReadAssetFile(char const* path, size_t* size);
+float ReadWavLength(unsigned char const* bytes, size_t size);
+#pragma endregion Forward Declarations
+
+void StartAssetLoader(void){
+	if (loader_started) return;
+	loader_started = TRUE;
+	loader_start_time = ProfilerGetSeconds();
+	// Mapped before the thread starts and never closed, so the thread can read it without a lock
+	OpenAssetPack(ASSET_PACK_PATH);
+
+	for (size_t file = 0; file < sizeof(asset_files) / sizeof(asset_files[0]); ++file) {
+		if (FindAsset(asset_files[file].path, asset_files[file].type) >= 0) continue;
+		Asset* asset = AddAsset(asset_files[file].path, asset_files[file].type);
+		if (asset) asset->frame_count = asset_files[file].frame_count;
+	}
+	loader_file_count = asset_count;
+	loader_thread = SimStartThread(LoadAssetFiles, NULL);
+	// Without a thread everything is loaded here, so the splash screen never waits on a thread that is not there
+	if (!loader_thread && SimAtomicLoad(&loaded_count) < loader_file_count) LoadAssetFiles(NULL);
+}
+
+void UpdateAssetLoader(void){
+	FinishLoadedAssets(ASSET_FRAME_BUDGET);
+}
+
+void FinishAssetLoader(void){
+	SimJoinThread(loader_thread);
+	loader_thread = NULL;
+	FinishLoadedAssets(-1.0);
+}
+
+_Bool IsAssetLoaderDone(void){
+	return finished_count == loader_file_count && loader_thread == NULL;
+}
+
+float GetAssetLoaderProgress(void){
+	if (loader_file_count == 0) return 1.0f;
+	return (float)(SimAtomicLoad(&loaded_count) + finished_count) / (float)(loader_file_count * 2);
+}
+
+CP_Image GetAssetImage(char const* path){
+	Asset const* asset = GetAsset(path, ASSET_IMAGE);
+	return asset ? asset->image : CP_Image_Load(path);
+}
+
+SpriteSheet const* GetAssetSheet(char const* path_format, int frame_count){
+	// The frame count is needed to load it, so it is added here instead of by GetAsset
+	if (FindAsset(path_format, ASSET_SHEET) < 0) {
+		Asset* added = AddAsset(path_format, ASSET_SHEET);
+		if (added) added->frame_count = frame_count;
+	}
+	// Out of space, not loaded at all, as a sheet made every time would never be freed
+	Asset const* asset = GetAsset(path_format, ASSET_SHEET);
+	return asset ? asset->sheet : NULL;
+}
+
+CP_Sound GetAssetSound(char const* path){
+	Asset const* asset = GetAsset(path, ASSET_SOUND);
+	return asset ? asset->sound : CP_Sound_Load(path);
+}
+
+float GetAssetSoundLength(char const* path){
+	Asset const* asset = GetAsset(path, ASSET_SOUND);
+	return asset ? asset->length : 0.0f;
+}
+
+CP_Font GetAssetFont(char const* path){
+	Asset const* asset = GetAsset(path, ASSET_FONT);
+	return asset ? asset->font : CP_Font_Load(path);
+}
+
+void ReportTimeToInteractive(void){
+	if (!loader_started || time_to_interactive >= 0.0) return;
+	time_to_interactive = (ProfilerGetSeconds() - loader_start_time) * 1000.0;
+
+#ifdef _WIN32
+	char report[128];
+	snprintf(report, sizeof(report), "Menu interactive after %.0f ms, assets loaded in %.0f ms\n", time_to_interactive, load_time * 1000.0);
+	OutputDebugStringA(report);
+#endif
+}
+
+double GetTimeToInteractive(void){
+	return time_to_interactive;
+}
+
+void LoadAssetFiles(void* data){
+	(void)data;
+	for (int index = 0; index < loader_file_count; ++index) {
+		Asset* asset = &assets[index];
+		if (asset->type == ASSET_SHEET) {
+			asset->loaded_sheet = BuildSheet(asset->path, asset->frame_count, FALSE, &asset->pixels, &asset->width, &asset->height);
+		}
+		else {
+			size_t size = 0;
+			unsigned char* read = NULL;
+			unsigned char const* bytes = ReadAsset(asset->path, &size, &read);
+			if (bytes) {
+				if (asset->type == ASSET_IMAGE) asset->pixels = PngDecode(bytes, size, &asset->width, &asset->height);
+				else if (asset->type == ASSET_SOUND) asset->file_length = ReadWavLength(bytes, size);
+			}
+			free(read);
+		}
+		// Everything written above can be read by the main thread once it sees the count
+		SimAtomicStore(&loaded_count, index + 1);
+	}
+}
+
+void FinishLoadedAssets(double budget){
+	double start = ProfilerGetSeconds();
+	int loaded = SimAtomicLoad(&loaded_count);
+	while (finished_count < loaded) {
+		Asset* asset = &assets[finished_count++];
+		// Asked for before the thread got to it, what the thread loaded is not needed
+		if (asset->ready) {
+			free(asset->pixels);
+			asset->pixels = NULL;
+			free(asset->loaded_sheet);
+			asset->loaded_sheet = NULL;
+			continue;
+		}
+		FinishAsset(asset);
+		if (budget >= 0.0 && ProfilerGetSeconds() - start >= budget) break;
+	}
+
+	if (finished_count == loader_file_count && load_time < 0.0) {
+		SimJoinThread(loader_thread);
+		loader_thread = NULL;
+		load_time = ProfilerGetSeconds() - loader_start_time;
+	}
+}
+
+void FinishAsset(Asset* asset){
+	switch (asset->type) {
+	case ASSET_IMAGE:
+		// Pngs the decoder does not read are left to CProcessing
+		asset->image = asset->pixels ? CP_Image_CreateFromData(asset->width, asset->height, asset->pixels) : CP_Image_Load(asset->path);
+		free(asset->pixels);
+		asset->pixels = NULL;
+		break;
+	case ASSET_SHEET:
+		// A frame the decoder does not read, the sheet is made again with CProcessing loading the frames
+		if (!asset->loaded_sheet) asset->loaded_sheet = BuildSheet(asset->path, asset->frame_count, TRUE, &asset->pixels, &asset->width, &asset->height);
+		asset->sheet = asset->loaded_sheet;
+		asset->loaded_sheet = NULL;
+		if (asset->sheet) asset->sheet->image = CP_Image_CreateFromData(asset->width, asset->height, asset->pixels);
+		free(asset->pixels);
+		asset->pixels = NULL;
+		break;
+	case ASSET_SOUND:
+		asset->sound = CP_Sound_Load(asset->path);
+		asset->length = asset->file_length;
+		break;
+	case ASSET_FONT:
+		asset->font = CP_Font_Load(asset->path);
+		break;
+	}
+	asset->ready = TRUE;
+}
+
+void LoadAssetNow(Asset* asset){
+	switch (asset->type) {
+	case ASSET_IMAGE: {
+		// Decoded from the pack if it is there, as that is already in memory
+		size_t size = 0;
+		int width = 0, height = 0;
+		unsigned char const* bytes = FindPackedAsset(asset->path, &size);
+		unsigned char* pixels = bytes ? PngDecode(bytes, size, &width, &height) : NULL;
+		asset->image = pixels ? CP_Image_CreateFromData(width, height, pixels) : CP_Image_Load(asset->path);
+		free(pixels);
+		break;
+	}
+	case ASSET_SHEET: {
+		unsigned char* pixels = NULL;
+		int width = 0, height = 0;
+		asset->sheet = BuildSheet(asset->path, asset->frame_count, TRUE, &pixels, &width, &height);
+		if (asset->sheet) asset->sheet->image = CP_Image_CreateFromData(width, height, pixels);
+		free(pixels);
+		break;
+	}
+	case ASSET_SOUND: {
+		asset->sound = CP_Sound_Load(asset->path);
+		size_t size = 0;
+		unsigned char* read = NULL;
+		unsigned char const* bytes = ReadAsset(asset->path, &size, &read);
+		asset->length = bytes ? ReadWavLength(bytes, size) : 0.0f;
+		free(read);
+		break;
+	}
+	case ASSET_FONT:
+		asset->font = CP_Font_Load(asset->path);
+		break;
+	}
+	asset->ready = TRUE;
+}
+
+Asset* GetAsset(char const* path, AssetType type){
+	int index = FindAsset(path, type);
+	Asset* asset = index >= 0 ? &assets[index] : AddAsset(path, type);
+	if (!asset || asset->ready) return asset;
+
+	// The thread's own files are only touched once it has counted them
+	if (index >= 0 && index < loader_file_count && index < SimAtomicLoad(&loaded_count)) FinishAsset(asset);
+	else LoadAssetNow(asset);
+	return asset;
+}
+
+int FindAsset(char const* path, AssetType type){
+	for (int index = 0; index < asset_count; ++index) {
+		if (assets[index].type == type && strcmp(assets[index].path, path) == 0) return index;
+	}
+	return -1;
+}
+
+Asset* AddAsset(char const* path, AssetType type){
+	// Out of space, the file is loaded every time it is asked for
+	if (asset_count == MAX_ASSETS || strlen(path) >= MAX_ASSET_PATH) return NULL;
+	Asset* asset = &assets[asset_count++];
+	memset(asset, 0, sizeof(Asset));
+	memcpy(asset->path, path, strlen(path) + 1);
+	asset->type = type;
+	return asset;
+}
+
+SpriteSheet* BuildSheet(char const* path_format, int frame_count, _Bool use_cprocessing, unsigned char** pixels, int* width, int* height){
+	SpriteSheet* sheet = NULL;
+	*pixels = NULL;
+	int columns = 1;
+
+	for (int frame = 0; frame < frame_count; ++frame) {
+		char path[MAX_ASSET_PATH];
+		snprintf(path, sizeof(path), path_format, frame);
+		int frame_width = 0, frame_height = 0;
+		unsigned char* frame_pixels = ReadImagePixels(path, &frame_width, &frame_height, use_cprocessing);
+
+		// Laid out once the size of the frames is known, as many frames a row as fit in MAX_SHEET_WIDTH
+		if (frame_pixels && !sheet) {
+			columns = (MAX_SHEET_WIDTH + SHEET_PADDING) / (frame_width + SHEET_PADDING);
+			if (columns < 1) columns = 1;
+			if (columns > frame_count) columns = frame_count;
+			int rows = (frame_count + columns - 1) / columns;
+			*width = columns * (frame_width + SHEET_PADDING) - SHEET_PADDING;
+			*height = rows * (frame_height + SHEET_PADDING) - SHEET_PADDING;
+
+			sheet = malloc(sizeof(SpriteSheet) + sizeof(SpriteFrame) * (size_t)frame_count);
+			*pixels = calloc((size_t)*width * (size_t)*height, 4);
+			if (sheet) {
+				sheet->image = NULL;
+				sheet->frame_count = frame_count;
+				sheet->frame_width = frame_width;
+				sheet->frame_height = frame_height;
+			}
+		}
+		// Every frame is needed and the same size, or there is no sheet
+		if (!frame_pixels || !sheet || !*pixels || frame_width != sheet->frame_width || frame_height != sheet->frame_height) {
+			free(frame_pixels);
+			free(sheet);
+			free(*pixels);
+			*pixels = NULL;
+			return NULL;
+		}
+
+		int x = frame % columns * (frame_width + SHEET_PADDING);
+		int y = frame / columns * (frame_height + SHEET_PADDING);
+		for (int row = 0; row < frame_height; ++row) {
+			memcpy(*pixels + ((size_t)(y + row) * (size_t)*width + (size_t)x) * 4, frame_pixels + (size_t)row * (size_t)frame_width * 4, (size_t)frame_width * 4);
+		}
+		SpriteFrame* sprite_frame = &sheet->frames[frame];
+		sprite_frame->u0 = (float)x;
+		sprite_frame->v0 = (float)y;
+		sprite_frame->u1 = (float)(x + frame_width);
+		sprite_frame->v1 = (float)(y + frame_height);
+		free(frame_pixels);
+	}
+	return sheet;
+}
+
+unsigned char* ReadImagePixels(char const* path, int* width, int* height, _Bool use_cprocessing){
+	size_t size = 0;
+	unsigned char* read = NULL;
+	unsigned char const* bytes = ReadAsset(path, &size, &read);
+	unsigned char* pixels = bytes ? PngDecode(bytes, size, width, height) : NULL;
+	free(read);
+	if (pixels || !use_cprocessing) return pixels;
+
+	// Pngs the decoder does not read are loaded by CProcessing and read back, only on the main thread
+	CP_Image image = CP_Image_Load(path);
+	if (!image) return NULL;
+	*width = CP_Image_GetWidth(image);
+	*height = CP_Image_GetHeight(image);
+	pixels = malloc((size_t)*width * (size_t)*height * sizeof(CP_Color));
+	if (pixels) CP_Image_GetPixelData(image, (CP_Color*)pixels);
+	CP_Image_Free(&image);
+	return pixels;
+}
+
+unsigned char const* ReadAsset(char const* path, size_t* size, unsigned char** read){
+	unsigned char const* packed = FindPackedAsset(path, size);
+	if (packed) return packed;
+	// Not in the pack, the copy read is freed by the caller
+	*read = ReadAssetFile(path, size);
+	return *read;
+}
+
+unsigned char* ReadAssetFile(char const* path, size_t* size){
+	FILE* file = NULL;
+#ifdef _MSC_VER
+	if (fopen_s(&file, path, "rb") != 0) file = NULL;
+#else
+	file = fopen(path, "rb");
+#endif
+	if (!file) return NULL;
+
+	unsigned char* bytes = NULL;
+	long length = fseek(file, 0, SEEK_END) == 0 ? ftell(file) : -1;
+	if (length > 0 && fseek(file, 0, SEEK_SET) == 0) {
+		bytes = malloc((size_t)length);
+		if (bytes && fread(bytes, 1, (size_t)length, file) != (size_t)length) {
+			free(bytes);
+			bytes = NULL;
+		}
+	}
+	fclose(file);
+	*size = (size_t)length;
+	return bytes;
+}
+
+float ReadWavLength(unsigned char const* bytes, size_t size){
+	if (size < 12 || memcmp(bytes, "RIFF", 4) != 0 || memcmp(bytes + 8, "WAVE", 4) != 0) return 0.0f;
+
+	// Goes through the chunks for the bytes per second (fmt) and the size of the sound (data), data comes last
+	unsigned int bytes_per_second = 0;
+	for (size_t pos = 12; pos + 8 <= size; ) {
+		unsigned char const* chunk = bytes + pos;
+		unsigned int chunk_size = chunk[4] | chunk[5] << 8 | chunk[6] << 16 | (unsigned int)chunk[7] << 24;
+		if (memcmp(chunk, "fmt ", 4) == 0 && chunk_size >= 16 && pos + 24 <= size) {
+			bytes_per_second = chunk[16] | chunk[17] << 8 | chunk[18] << 16 | (unsigned int)chunk[19] << 24;
+		}
+		else if (memcmp(chunk, "data", 4) == 0) {
+			return bytes_per_second > 0 ? (float)chunk_size / (float)bytes_per_second : 0.0f;
+		}
+		// Chunks are padded to an even size
+		pos += 8 + (size_t)chunk_size + (chunk_size & 1);
+	}
+	return 0.0f;
+}
@@ -0,0 +1,180 @@
+/*!
+@file	  AssetPack.c
+@date     17/10/2026
+@brief    This source file contains the asset pack, see AssetPack.h. The whole pack is checked when it is opened, so a
+		  lookup trusts the index: it hashes the path, goes to its bucket and walks on until the path is found or an
+		  empty bucket says it is not there. There are 7 functions in this file,
+
+		  OpenAssetPack - Maps a pack into memory.
+		  CloseAssetPack - Unmaps the pack.
+		  FindPackedAsset - Returns where a file is in the pack.
+		  AssetPackHash - Returns the hash of a path, the index is looked up with.
+
+		  MapPack - Maps a file into memory, read only.
+		  UnmapPack - Unmaps what MapPack mapped.
+		  IsPackValid - Checks the header and every entry stay inside the pack.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#include "AssetPack.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifndef TRUE
+#define TRUE 1
+#endif
+#ifndef FALSE
+#define FALSE 0
+#endif
+
+unsigned char const* pack = NULL;	// The mapping, NULL when no pack is open
+size_t pack_size = 0;
+
+#pragma region
+unsigned char const* MapPack(char const* path, size_t* size);
+void UnmapPack(unsigned char const* data, size_t size);
+_Bool IsPackValid(unsigned char const* data, size_t size);
+#pragma endregion Forward Declarations
+
+_Bool OpenAssetPack(char const* path){
+	CloseAssetPack();
+	size_t size = 0;
+	unsigned char const* data = MapPack(path, &size);
+	if (data == NULL) return FALSE;
+	if (!IsPackValid(data, size)) {
+		UnmapPack(data, size);
+		return FALSE;
+	}
+	pack = data;
+	pack_size = size;
+	return TRUE;
+}
+
+void CloseAssetPack(void){
+	if (pack == NULL) return;
+	UnmapPack(pack, pack_size);
+	pack = NULL;
+	pack_size = 0;
+}
+
+unsigned char const* FindPackedAsset(char const* path, size_t* size){
+	if (pack == NULL) return NULL;
+	AssetPackHeader const* header = (AssetPackHeader const*)pack;
+	AssetPackEntry const* entries = (AssetPackEntry const*)(header + 1);
+	char const* paths = (char const*)pack + header->paths_offset;
+
+	uint32_t hash = AssetPackHash(path);
+	uint32_t mask = header->bucket_count - 1;
+	for (uint32_t bucket = hash & mask; ; bucket = (bucket + 1) & mask) {
+		AssetPackEntry const* entry = &entries[bucket];
+		if (entry->path == ASSET_PACK_EMPTY) return NULL;
+		if (entry->hash != hash) continue;
+
+		// Same hash, the paths are compared to be sure, the pack's have '/' only
+		char const* packed = paths + entry->path;
+		char const* wanted = path;
+		while (*packed != '\0' && *packed == (*wanted == '\\' ? '/' : *wanted)) {
+			++packed;
+			++wanted;
+		}
+		if (*packed == '\0' && *wanted == '\0') {
+			*size = entry->size;
+			return pack + entry->offset;
+		}
+	}
+}
+
+uint32_t AssetPackHash(char const* path){
+	uint32_t hash = 2166136261u;
+	for (; *path != '\0'; ++path) {
+		hash ^= (unsigned char)(*path == '\\' ? '/' : *path);
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+#ifdef _WIN32
+unsigned char const* MapPack(char const* path, size_t* size){
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (file == INVALID_HANDLE_VALUE) return NULL;
+	LARGE_INTEGER file_size;
+	if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0 || file_size.QuadPart > 0xFFFFFFFF) {
+		CloseHandle(file);
+		return NULL;
+	}
+	HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	// The view keeps the file open, the handles are not needed anymore
+	void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+	if (mapping) CloseHandle(mapping);
+	CloseHandle(file);
+	if (view == NULL) return NULL;
+
+	// Reads the whole pack in the background now, so the pages are there before they are first touched
+	WIN32_MEMORY_RANGE_ENTRY range = { view, (SIZE_T)file_size.QuadPart };
+	PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+	*size = (size_t)file_size.QuadPart;
+	return view;
+}
+
+void UnmapPack(unsigned char const* data, size_t size){
+	(void)size;
+	UnmapViewOfFile(data);
+}
+#else
+unsigned char const* MapPack(char const* path, size_t* size){
+	int file = open(path, O_RDONLY);
+	if (file < 0) return NULL;
+	struct stat status;
+	if (fstat(file, &status) != 0 || status.st_size == 0 || status.st_size > 0xFFFFFFFF) {
+		close(file);
+		return NULL;
+	}
+	void* view = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+	close(file);
+	if (view == MAP_FAILED) return NULL;
+
+	// Reads the whole pack in the background now, so the pages are there before they are first touched
+	madvise(view, (size_t)status.st_size, MADV_WILLNEED);
+	*size = (size_t)status.st_size;
+	return view;
+}
+
+void UnmapPack(unsigned char const* data, size_t size){
+	munmap((void*)data, size);
+}
+#endif
+
+_Bool IsPackValid(unsigned char const* data, size_t size){
+	if (size < sizeof(AssetPackHeader)) return FALSE;
+	AssetPackHeader const* header = (AssetPackHeader const*)data;
+	if (header->magic != ASSET_PACK_MAGIC || header->version != ASSET_PACK_VERSION || header->pack_size != size) return FALSE;
+
+	// A power of two with room to spare, so a lookup always gets to an empty bucket
+	uint32_t buckets = header->bucket_count;
+	if (buckets == 0 || (buckets & (buckets - 1)) != 0 || header->file_count >= buckets) return FALSE;
+	if (buckets > (size - sizeof(AssetPackHeader)) / sizeof(AssetPackEntry)) return FALSE;
+	if (header->paths_offset < sizeof(AssetPackHeader) + buckets * sizeof(AssetPackEntry)) return FALSE;
+	if (header->paths_offset > size || header->paths_size > size - header->paths_offset || header->paths_size == 0) return FALSE;
+	char const* paths = (char const*)data + header->paths_offset;
+	if (paths[header->paths_size - 1] != '\0') return FALSE;
+
+	AssetPackEntry const* entries = (AssetPackEntry const*)(header + 1);
+	uint32_t files = 0;
+	for (uint32_t bucket = 0; bucket < buckets; ++bucket) {
+		AssetPackEntry const* entry = &entries[bucket];
+		if (entry->path == ASSET_PACK_EMPTY) continue;
+		if (entry->path >= header->paths_size || entry->offset > size || entry->size > size - entry->offset) return FALSE;
+		if (entry->offset % ASSET_PACK_ALIGNMENT != 0) return FALSE;
+		++files;
+	}
+	return files == header->file_count;
+}
@@ -11,6 +11,7 @@ ________________________________________________________________________________
 #include "ColorTable.h"
 #include "UIManager.h"
 #include "MainMenu.h"
+#include "AssetLoader.h"
 
 #define NUM_OF_CREDITS 8
 
@@ -71,7 +72,7 @@ void InitCreditsTexts(void){
 	// Base text data for header texts.
 	TextData headerTextData = {
 		.color = MENU_RED,
-		.font = CP_Font_Load("Assets/PressStart2P-Regular.ttf"),
+		.font = GetAssetFont("Assets/PressStart2P-Regular.ttf"),
 		.hAlign = CP_TEXT_ALIGN_H_CENTER,
 		.vAlign = CP_TEXT_ALIGN_V_MIDDLE,
 		.textSize = 80 * GetHeightScale()
@@ -80,7 +81,7 @@ void InitCreditsTexts(void){
 	// Base text data for names texts.
 	TextData namesTextData = {
 	.color = MENU_WHITE,
-	.font = CP_Font_Load("Assets/PressStart2P-Regular.ttf"),
+	.font = GetAssetFont("Assets/PressStart2P-Regular.ttf"),
 	.hAlign = CP_TEXT_ALIGN_H_CENTER,
 	.vAlign = CP_TEXT_ALIGN_V_MIDDLE,
 	.textSize = 50 * GetHeightScale()
@@ -241,7 +242,7 @@ void InitCreditsButtons(void){
 
 	TextData backBtnTextData = {
 		.color = MENU_WHITE,
-		.font = CP_Font_Load("Assets/PressStart2P-Regular.ttf"),
+		.font = GetAssetFont("Assets/PressStart2P-Regular.ttf"),
 		.textSize = 70 * GetHeightScale(),
 		.hAlign = CP_TEXT_ALIGN_H_CENTER,
 		.vAlign = CP_TEXT_ALIGN_V_MIDDLE,
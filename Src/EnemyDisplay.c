@@ -7,7 +7,7 @@
 
 		  EnemyDisplayInit - Called by Gamelevel during its initialization, loads the values needed for rendering and such.
 
-		  EnemyDisplayTimeIncrement - Subscribed to the player update event, increments the time trackers for the different animations.
+		  EnemyDisplayTimeIncrement - Subscribed to the player update event, keeps the hover timer going while the cursor stays in a cell.
 		  RenderEnemyDisplay - Renders the enemy health and damage stats in the four corners of the cell.
 		  RenderEnemyMovement - Renders the movement arrows on the left, and the shading of the final cell of its movement.
 		  DisplayEnemyInfo - Renders the information box for the enemy in the grid after hovering after a while.
@@ -26,6 +26,8 @@ ________________________________________________________________________________
 #include "ColorTable.h"	// For text & health bar colors
 
 #include "GameLoop.h"	// For subscribing to player update
+#include "Tween.h"		// For the movement blinking and the hover timer
+#include "AssetLoader.h"	// For the attack icon
 #include "EnemyDisplay.h"
 
 // Offsets for displaying in the four corners of the cell
@@ -48,9 +50,8 @@ float health_width;				// THe x-size of the entire health bar
 float health_spacing;			// Gap between each health cell in the bar
 
 // Movement blinking settings
-float move_elapsed_time;		// How much time as passed since it last blinked
+Tween move_blink;				// Goes round every two blinks, the movement is shown for the second half
 float move_blink_speed = 0.5f;	// How many seconds to wait before blinking again
-_Bool move_draw;				// Flag when enemy has 0 movement, skips the entire calculations and rendering
 
 CP_Image attack_icon;			// Icon for displaying enemy's attack
 
@@ -58,8 +59,9 @@ CP_Image attack_icon;			// Icon for displaying enemy's attack
 E_DisplayInfo zombie_info[ZOMBIE_TYPE_LENGTH];
 
 float hover_info_display_time = 0.75f;	// How long to wait before showing enemy information
-float hover_elapsed_time;				// How long the cursor has been hovering in a cell of the grid
-EnemyInfo *hovered_zombie;				// The information of the enemy in the grid, if any.
+Tween hover_timer;						// Ends once the cursor has been hovering in a cell of the grid long enough
+EnemyInfo hovered_zombie;				// The information of the enemy in the grid, if any.
+_Bool is_zombie_hovered;				// If there is an enemy in hovered_zombie to show.
 int last_hover_x, last_hover_y;			// Check to tell if the cursor is still hovering in the same cell
 E_DisplayText info_text;				// Struct containing information for rendering
 
@@ -99,19 +101,19 @@ void EnemyDisplayInit(void){
 	health_offset.y = cell_size * 0.4f;
 
 	// Load attack icon
-	attack_icon = CP_Image_Load("Assets/AttackIcon.png");
+	attack_icon = GetAssetImage("Assets/AttackIcon.png");
 
-	move_elapsed_time = 0.0f;
-	move_draw = FALSE;
+	move_blink = TweenTimer(move_blink_speed * 2, TWEEN_LOOP);
 
-	// Subscribe the enemy movement flicker time incrementation to player update
+	// Subscribe the enemy hover time incrementation to player update
 	SubscribeEvent(PLAYER_UPDATE, EnemyDisplayTimeIncrement, 0);
 
 	//______________________________________________________________
 	// Initialize zombie info descriptions
-	hover_elapsed_time = 0.0f;
+	hover_timer = TWEEN_NONE;
+	ResetDisplayEnemyInfoTime();
 	last_hover_x = last_hover_y = 0;
-	hovered_zombie = NULL;
+	is_zombie_hovered = FALSE;
 	SubscribeEvent(PLAYER_END, ResetDisplayEnemyInfoTime, 0);
 
 	zombie_info[WALL].type = GetEnemyPrefab(0); // 0 is wall
@@ -145,36 +147,26 @@ void EnemyDisplayInit(void){
 }
 
 /*______________________________________________________________
-@brief Subscribed to the player update event, increments the time trackers for the different animations
+@brief Subscribed to the player update event, keeps the hover timer going while the cursor stays in a cell
 */
 void EnemyDisplayTimeIncrement(void){
-	// Update the timing for the zombie move indicator flicker
-	move_elapsed_time += CP_System_GetDt();
-
-	if (move_elapsed_time > move_blink_speed) {
-		move_draw = TRUE;
-
-		if (move_elapsed_time > move_blink_speed * 2) {
-			move_draw = FALSE;
-			move_elapsed_time = 0.0f;
-		}
-	}
-
 	// Update the timing for the zombie information hover
 	// If the cursor is not in the playing area, skip
 	if (!IsIndexInPlayingArea(0, PosYToGridY(CP_Input_GetMouseY()))) {
-		hovered_zombie = NULL;
+		is_zombie_hovered = FALSE;
+		PauseTween(hover_timer, TRUE);
 		return;
 	}
 
 	// If the cursor is still in the same cell as it was last time, update the timing
 	if (last_hover_x == PosXToGridX(CP_Input_GetMouseX()) && last_hover_y == PosYToGridY(CP_Input_GetMouseY())) {
-		hover_elapsed_time += CP_System_GetDt();
+		PauseTween(hover_timer, FALSE);
 
 		// Once the time spent hovering is enough, draws the information box for the enemy
-		if (hover_elapsed_time > hover_info_display_time) {
-			if (hovered_zombie = GetAliveEnemyFromGrid(last_hover_x, last_hover_y)) {
-				info_text.zombie_index = hovered_zombie->type;
+		if (!TweenIsPlaying(hover_timer)) {
+			is_zombie_hovered = GetAliveEnemyFromGrid(last_hover_x, last_hover_y, &hovered_zombie);
+			if (is_zombie_hovered) {
+				info_text.zombie_index = hovered_zombie.type;
 			}
 		}
 	}
@@ -182,7 +174,7 @@ void EnemyDisplayTimeIncrement(void){
 		ResetDisplayEnemyInfoTime();
 		last_hover_x = PosXToGridX(CP_Input_GetMouseX());
 		last_hover_y = PosYToGridY(CP_Input_GetMouseY());
-		hovered_zombie = NULL;
+		is_zombie_hovered = FALSE;
 	}
 }
 
@@ -243,24 +235,24 @@ void RenderEnemyDisplay(float pos_x, float pos_y, int health, int max_health, in
 @param[in] movement - The amount of cells the enemy can move per turn
 */
 void RenderEnemyMovement(float pos_x, float pos_y, int movement){
-	if (!movement || !move_draw) return;
+	if (!movement || TweenProgress(move_blink) <= 0.5f) return;
 
 	CP_Settings_Fill(ENEMY_MOVEMENT);
 
 	int actual_movement = 1, grid_x = PosXToGridX(pos_x), grid_y = PosYToGridY(pos_y);
 	for (; actual_movement < movement; ++actual_movement) {
-		EnemyInfo* enemy;
-		if (enemy = GetAliveEnemyFromGrid(grid_x - actual_movement, grid_y)) {
-			if (enemy->type == WALL) {
+		EnemyInfo enemy;
+		if (GetAliveEnemyFromGrid(grid_x - actual_movement, grid_y, &enemy)) {
+			if (enemy.type == WALL) {
 				break;
 			}
 			else {
-				if (enemy->MovementSpeed + actual_movement > movement) {
+				if (enemy.MovementSpeed + actual_movement > movement) {
 					actual_movement = movement;
 					break;
 				}
 				else {
-					actual_movement += enemy->MovementSpeed - 1;
+					actual_movement += enemy.MovementSpeed - 1;
 					break;
 				}
 			}
@@ -280,9 +272,9 @@ void RenderEnemyMovement(float pos_x, float pos_y, int movement){
 	}
 
 	// If enemy is in cell, don't draw the shade
-	EnemyInfo *enemy = GetAliveEnemyFromGrid(grid_x - actual_movement, grid_y);
-	if (enemy != NULL) {
-		if (enemy->type != WALL) return;
+	EnemyInfo enemy;
+	if (GetAliveEnemyFromGrid(grid_x - actual_movement, grid_y, &enemy)) {
+		if (enemy.type != WALL) return;
 	}
 
 	// Shade cell,top half
@@ -311,17 +303,17 @@ void RenderEnemyMovement(float pos_x, float pos_y, int movement){
 }
 
 /*______________________________________________________________
-@brief Upon exit of game level, free the image since it no longer used.
+@brief Upon exit of game level, let go of the image since it no longer used. It is kept by the asset loader.
 */
 void FreeEnemyDisplayIcon(void){
-	CP_Image_Free(&attack_icon);
+	attack_icon = NULL;
 }
 
 /*______________________________________________________________
 @brief Renders the information box for the enemy in the grid after hovering after a while.
 */
 void DisplayEnemyInfo(void){
-	if (!hovered_zombie) return;
+	if (!is_zombie_hovered) return;
 
 	// Text box
 	CP_Settings_RectMode(CP_POSITION_CENTER);
@@ -337,7 +329,7 @@ void DisplayEnemyInfo(void){
 
 	// Enemy stats
 	char text_buffer[28];
-	sprintf_s(text_buffer, _countof(text_buffer), "HP:%d/%d WALL-ATK:%d SPD:%d", hovered_zombie->Health, hovered_zombie->MaxHealth, hovered_zombie->damage, hovered_zombie->MovementSpeed);
+	sprintf_s(text_buffer, _countof(text_buffer), "HP:%d/%d WALL-ATK:%d SPD:%d", hovered_zombie.Health, hovered_zombie.MaxHealth, hovered_zombie.damage, hovered_zombie.MovementSpeed);
 	CP_Font_DrawText(text_buffer, CP_Input_GetMouseX() + info_text.offset.x, CP_Input_GetMouseY() + info_text.offset.y - info_text.size / 1.2f);
 
 	// Enemy description
@@ -345,8 +337,11 @@ void DisplayEnemyInfo(void){
 }
 
 /*______________________________________________________________
-@brief Resets the timing of the elapsed hover time to 0.
+@brief Resets the timing of the elapsed hover time to 0, it only counts again once
+	   the cursor is in the same cell on the player's turn.
 */
 void ResetDisplayEnemyInfoTime(void){
-	hover_elapsed_time = 0.0f;
+	StopTween(hover_timer);
+	hover_timer = TweenTimer(hover_info_display_time, TWEEN_ONCE);
+	PauseTween(hover_timer, TRUE);
 }
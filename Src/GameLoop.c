@@ -3,24 +3,40 @@
 @author	  Ang Jiawei Jarrett (a.jiaweijarrett@digipen.edu)
 @date     22/11/2022
 @brief    This source file contains event arrays for different events in game, such as player start, zombie update, etc. Functions from
-		  elsewhere in the solution can subscribe to these events and will be called when it happens. There are 9 functions in this file,
+		  elsewhere in the solution can subscribe to these events and will be called when it happens. There are 17 functions in this file,
 
 		  GameLoopInit - Called at the start of the game level to handle the turns between the player and the zombies.
 		  GameLoopSwitch - Switches the turn state, calls the end events for the current state and the start events for the new one.
 		  GameLoopUpdate - Every update, calls all functions subscribed to the current turn's update.
 
 		  SubscribeEvent - Add a function to one of the events array, should the event happen, the function will be called.
+		  SubscribeEventEx - Same as SubscribeEvent, for functions that take a pointer of the subscriber's choosing.
 		  UnsubscribeEvent - Remove a function from one of the event arrays.
+		  UnsubscribeEventHandle - Remove the subscription a handle is for, without looking for it.
 		  UnsubscribeAllEvents - Resets ALL events subscribed to zero/null.
-		  ZeroOutAllEvents - Similar to UnsubscribeAllEvents but this forces ALL events to be zeroed out, even the NULL ones.
-		  
-		  InsertToArrayAt - Inserts a new function pointer into the events array.
-		  RemoveFromArrayAt - Removes an existing function pointer from the events array.
+		  ZeroOutAllEvents - Similar to UnsubscribeAllEvents but this also forgets any queued turn swaps.
+
+		  GetTurnEvent - Returns the events array of an event type.
+		  GetCurrentTurnEvent - Returns the event type of the current turn's start, update or end.
+		  AddToArray - Adds a new function pointer to the end of the events array, growing it if needed.
+		  RemoveFromArrayAt - Marks an existing function pointer in the events array as unsubscribed.
+		  TidyArray - Takes the unsubscribed events out and sorts the new ones in by priority, before an event is called.
+		  DispatchEvents - Calls every function of an event, safe against functions (un)subscribing while it does. Timed by the profiler.
+		  ApplyQueuedSwitches - Does the turn swaps asked for while an event was being called.
+		  FreeTurnEvent - Frees an events array.
 
 @license  Copyright  2022 DigiPen, All rights reserved.
 ________________________________________________________________________________________________________*/
 
+#include <stdlib.h>
+#include <string.h>
 #include "GameLoop.h"
+#include "Profiler.h" // For timing each event
+
+#define FIRST_EVENTS_CAPACITY 8		// Events an array starts with, it doubles whenever it fills up
+#define FIRST_SWITCHES_CAPACITY 4	// Turn swaps that can wait for an event to finish before the queue grows
+#define EVENT_SLOT_BITS 16			// A handle is the generation of its slot in the top 16 bits and the slot + 1 in the bottom 16 bits
+#define MAX_EVENT_SLOTS ((1 << EVENT_SLOT_BITS) - 1)
 
 TurnType current_turn_type;	// Enum to show current turn event type (Start, Update, End)
 Turn *current_turn;			// Pointer to the current turn events (Start, Update, End)
@@ -30,9 +46,37 @@ Turn *current_turn;			// Pointer to the current turn events (Start, Update, End)
 Turn player_turn;	// Player turn events (Start, Update, End)
 Turn zombie_turn;	// Zombie turn events (Start, Update, End)
 
+//______________________________________________________________
+// Subscription handles, each handle points to a slot that knows where its event is in the arrays
+typedef struct {
+	TurnEvent* owner;		// Array the event is in, NULL if the slot is free
+	int index;				// Index of the event in the array
+	unsigned int generation;// Goes up every time the slot is freed, so old handles to the slot stop working
+	int next_free;			// Next free slot, -1 for the last one
+} EventSlot;
+
+EventSlot* event_slots = NULL;
+int event_slot_count = 0;
+int event_slot_capacity = 0;
+int first_free_slot = -1;
+
+//______________________________________________________________
+// Turn swaps asked for while an event was being called, done once it is over
+TurnType* queued_switches = NULL;
+int queued_switch_count = 0;
+int queued_switch_capacity = 0;
+int events_dispatching = 0;	// How many events are being called right now, any of them
+_Bool applying_switches = 0;	// ApplyQueuedSwitches is already running further up
+
 #pragma region
-void InsertToArrayAt(TurnEvent* turn_array, void(*function_pointer)(void), int priority);
-void RemoveFromArrayAt(TurnEvent* turn_array, void(*function_pointer)(void));
+TurnEvent* GetTurnEvent(TurnEventType event_type);
+TurnEventType GetCurrentTurnEvent(TurnEventType player_event);
+EventHandle AddToArray(TurnEvent* turn_array, void(*function_pointer)(void), EventCallback callback, void* user_data, int priority);
+void RemoveFromArrayAt(TurnEvent* turn_array, int index);
+void TidyArray(TurnEvent* turn_array);
+void DispatchEvents(TurnEventType event_type);
+void ApplyQueuedSwitches(void);
+void FreeTurnEvent(TurnEvent* turn_array);
 #pragma endregion Forward Declarations
 
 //______________________________________________________________
@@ -47,45 +91,36 @@ void GameLoopInit(void) {
 	current_turn = &player_turn;
 
 	// Call the start events for the current turn
-	int total_events_subscribed = current_turn->start.count;
-	for (int index = 0; index < total_events_subscribed; ++index) {
-		current_turn->start.events[index].event();
-	}
+	DispatchEvents(GetCurrentTurnEvent(PLAYER_START));
+	ApplyQueuedSwitches();
 }
 
 /*______________________________________________________________
 @brief Switches the turn state, calls the end events for the current state and the start events for the new one.
+	   When called from inside an event, the switch is queued and done once that event has called all its functions,
+	   so the functions still waiting to be called are not called in the middle of the other turn.
 
 @param[in] new_turn - The turn type to swap to next
 */
 void GameLoopSwitch(TurnType new_turn) {
-	// Call the exit events for the current turn
-	int total_events_subscribed = current_turn->end.count;
-	for (int index = 0; index < total_events_subscribed; ++index) {
-		current_turn->end.events[index].event();
-	}
-
-	// Update the current turn to the new one
-	current_turn_type = new_turn;
-	switch (current_turn_type) {
-	case TURN_PLAYER: current_turn = &player_turn; break;
-	case TURN_ZOMBIE: current_turn = &zombie_turn; break;
-	}
-
-	// Call the start events for the current turn
-	total_events_subscribed = current_turn->start.count;
-	for (int index = 0; index < total_events_subscribed; ++index) {
-		current_turn->start.events[index].event();
+	// Grow the queue if it is full, the same as the events arrays
+	if (queued_switch_count == queued_switch_capacity) {
+		int capacity = queued_switch_capacity > 0 ? queued_switch_capacity * 2 : FIRST_SWITCHES_CAPACITY;
+		TurnType *switches = realloc(queued_switches, sizeof(TurnType) * (size_t)capacity);
+		if (switches == NULL) return;
+		queued_switches = switches;
+		queued_switch_capacity = capacity;
 	}
+	queued_switches[queued_switch_count++] = new_turn;
+	ApplyQueuedSwitches();
 }
 
 /*______________________________________________________________
 @brief Every update, calls all functions subscribed to the current turn's update.
 */
 void GameLoopUpdate(void) {
-	for (int index = 0; index < current_turn->update.count; ++index) {
-		current_turn->update.events[index].event();
-	}
+	DispatchEvents(GetCurrentTurnEvent(PLAYER_UPDATE));
+	ApplyQueuedSwitches();
 }
 
 //______________________________________________________________
@@ -97,21 +132,27 @@ void GameLoopUpdate(void) {
 @param[in] event_type - The type of event to subscribe to
 @param[in] function_pointer - The function to add to the event array
 @param[in] priority - If the function should be called first, higher priority functions get called first
+@return The handle of the subscription, NO_EVENT_HANDLE if it could not be made
 */
-void SubscribeEvent(TurnEventType event_type, void(*function_pointer)(void), int priority) {
-	TurnEvent *chosen_event = NULL;
-	switch (event_type) {
-	case PLAYER_START:  chosen_event = &player_turn.start; break;
-	case PLAYER_UPDATE: chosen_event = &player_turn.update; break;
-	case PLAYER_END:    chosen_event = &player_turn.end; break;
+EventHandle SubscribeEvent(TurnEventType event_type, void(*function_pointer)(void), int priority) {
+	TurnEvent *chosen_event = GetTurnEvent(event_type);
+	if (chosen_event == NULL || function_pointer == NULL) return NO_EVENT_HANDLE;
+	return AddToArray(chosen_event, function_pointer, NULL, NULL, priority);
+}
 
-	case ZOMBIE_START:  chosen_event = &zombie_turn.start; break;
-	case ZOMBIE_UPDATE: chosen_event = &zombie_turn.update; break;
-	case ZOMBIE_END:    chosen_event = &zombie_turn.end;  break;
-	}
+/*______________________________________________________________
+@brief Add a function that takes a pointer to one of the events array, it is called with user_data.
 
-	if (chosen_event == NULL) return;
-	InsertToArrayAt(chosen_event, function_pointer, priority);
+@param[in] event_type - The type of event to subscribe to
+@param[in] callback - The function to add to the event array
+@param[in] user_data - Passed to the function every time it is called
+@param[in] priority - If the function should be called first, higher priority functions get called first
+@return The handle of the subscription, NO_EVENT_HANDLE if it could not be made
+*/
+EventHandle SubscribeEventEx(TurnEventType event_type, EventCallback callback, void* user_data, int priority) {
+	TurnEvent *chosen_event = GetTurnEvent(event_type);
+	if (chosen_event == NULL || callback == NULL) return NO_EVENT_HANDLE;
+	return AddToArray(chosen_event, NULL, callback, user_data, priority);
 }
 
 /*______________________________________________________________
@@ -121,178 +162,266 @@ void SubscribeEvent(TurnEventType event_type, void(*function_pointer)(void), int
 @param[in] function_pointer - The pointer to the function to subscribe
 */
 void UnsubscribeEvent(TurnEventType event_type, void(*function_pointer)(void)) {
-	TurnEvent *chosen_event = NULL;
-	switch (event_type) {
-	case PLAYER_START:  chosen_event = &player_turn.start; break;
-	case PLAYER_UPDATE: chosen_event = &player_turn.update; break;
-	case PLAYER_END:    chosen_event = &player_turn.end; break;
+	TurnEvent *chosen_event = GetTurnEvent(event_type);
+	if (chosen_event == NULL || function_pointer == NULL) return;
 
-	case ZOMBIE_START:  chosen_event = &zombie_turn.start; break;
-	case ZOMBIE_UPDATE: chosen_event = &zombie_turn.update; break;
-	case ZOMBIE_END:    chosen_event = &zombie_turn.end;  break;
+	for (int index = 0; index < chosen_event->count; ++index) {
+		if (chosen_event->events[index].event == function_pointer) {
+			RemoveFromArrayAt(chosen_event, index);
+			return;
+		}
 	}
+}
 
-	if (chosen_event == NULL) return;
-	RemoveFromArrayAt(chosen_event, function_pointer);
+/*______________________________________________________________
+@brief Remove the subscription the handle is for, the slot of the handle says where its event is.
+
+@param[in] handle - The handle returned when subscribing
+*/
+void UnsubscribeEventHandle(EventHandle handle) {
+	int slot = (int)(handle & MAX_EVENT_SLOTS) - 1;
+	if (slot < 0 || slot >= event_slot_count) return;
+
+	EventSlot *event_slot = &event_slots[slot];
+	if (event_slot->owner == NULL || event_slot->generation != handle >> EVENT_SLOT_BITS) return;
+	RemoveFromArrayAt(event_slot->owner, event_slot->index);
 }
 
 /*______________________________________________________________
-@brief Similar to UnsubscribeAllEvents but this forces ALL events to be zeroed out, even the NULL ones.
+@brief Similar to UnsubscribeAllEvents but this also forgets the turn swaps still queued and frees the queue, so the
+	   level starts clean.
 */
 void ZeroOutAllEvents(void) {
-	// Remove references to all events to player start
-	for (int index = 0; index < MAX_EVENTS_BUFFER; ++index) {
-		player_turn.start.events[index].event = NULL;
-		player_turn.start.events[index].priority = -9999;
-	}
-	// Remove references to all events to player update
-	for (int index = 0; index < MAX_EVENTS_BUFFER; ++index) {
-		player_turn.update.events[index].event = NULL;
-		player_turn.update.events[index].priority = -9999;
-	}
-	// Remove references to all events to player end
-	for (int index = 0; index < MAX_EVENTS_BUFFER; ++index) {
-		player_turn.end.events[index].event = NULL;
-		player_turn.end.events[index].priority = -9999;
-	}
-	// Remove references to all events to zombie start
-	for (int index = 0; index < MAX_EVENTS_BUFFER; ++index) {
-		zombie_turn.start.events[index].event = NULL;
-		zombie_turn.start.events[index].priority = -9999;
-	}
-	// Remove references to all events to zombie update
-	for (int index = 0; index < MAX_EVENTS_BUFFER; ++index) {
-		zombie_turn.update.events[index].event = NULL;
-		zombie_turn.update.events[index].priority = -9999;
-	}
-	// Remove references to all events to zombie end
-	for (int index = 0; index < MAX_EVENTS_BUFFER; ++index) {
-		zombie_turn.end.events[index].event = NULL;
-		zombie_turn.end.events[index].priority = -9999;
-	}
-
-	// Reset the counters to 0 as well
-	player_turn.start.count = 0;
-	player_turn.update.count = 0;
-	player_turn.end.count = 0;
+	UnsubscribeAllEvents();
 
-	zombie_turn.start.count = 0;
-	zombie_turn.update.count = 0;
-	zombie_turn.end.count = 0;
+	free(queued_switches);
+	queued_switches = NULL;
+	queued_switch_count = 0;
+	queued_switch_capacity = 0;
 }
 
 /*______________________________________________________________
-@brief Resets ALL events subscribed to zero/null, it is important this function is called when the game level exits!!
+@brief Resets ALL events subscribed to zero/null and frees the arrays, it is important this function is called when the game level exits!!
 */
 void UnsubscribeAllEvents(void) {
-	int total_events_subscribed;
-	
-	// Remove references to all events to player start, if any
-	if (total_events_subscribed = player_turn.start.count) {
-		for (int index = 0; index < total_events_subscribed; ++index) {
-			player_turn.start.events[index].event = NULL;
-		}
-	}
-	// Remove references to all events to player update, if any
-	if (total_events_subscribed = player_turn.update.count) {
-		for (int index = 0; index < total_events_subscribed; ++index) {
-			player_turn.update.events[index].event = NULL;
-		}
-	}
-	// Remove references to all events to player end, if any
-	if (total_events_subscribed = player_turn.end.count) {
-		for (int index = 0; index < total_events_subscribed; ++index) {
-			player_turn.end.events[index].event = NULL;
-		}
-	}
-	// Remove references to all events to zombie start, if any
-	if (total_events_subscribed = zombie_turn.start.count) {
-		for (int index = 0; index < total_events_subscribed; ++index) {
-			zombie_turn.start.events[index].event = NULL;
-		}
-	}
-	// Remove references to all events to zombie update, if any
-	if (total_events_subscribed = zombie_turn.update.count) {
-		for (int index = 0; index < total_events_subscribed; ++index) {
-			zombie_turn.update.events[index].event = NULL;
-		}
-	}
-	// Remove references to all events to zombie end, if any
-	if (total_events_subscribed = zombie_turn.end.count) {
-		for (int index = 0; index < total_events_subscribed; ++index) {
-			zombie_turn.end.events[index].event = NULL;
-		}
-	}
-
-	// Reset the counters to 0 as well
-	player_turn.start.count = 0;
-	player_turn.update.count = 0;
-	player_turn.end.count = 0;
-
-	zombie_turn.start.count = 0;
-	zombie_turn.update.count = 0;
-	zombie_turn.end.count = 0;
+	FreeTurnEvent(&player_turn.start);
+	FreeTurnEvent(&player_turn.update);
+	FreeTurnEvent(&player_turn.end);
+
+	FreeTurnEvent(&zombie_turn.start);
+	FreeTurnEvent(&zombie_turn.update);
+	FreeTurnEvent(&zombie_turn.end);
+
+	// Every handle given out so far stops working, the slots are only freed when the level exits so this is the only place they go
+	free(event_slots);
+	event_slots = NULL;
+	event_slot_count = 0;
+	event_slot_capacity = 0;
+	first_free_slot = -1;
 }
 
 //______________________________________________________________
 // Array Manipulation Functions
 
 /*______________________________________________________________
-@brief Inserts a new function pointer into the events array,
-	   shifts all the functions below the new function down by 1
+@brief Returns the event array for the event type, NULL if there is none.
+*/
+TurnEvent* GetTurnEvent(TurnEventType event_type) {
+	switch (event_type) {
+	case PLAYER_START:  return &player_turn.start;
+	case PLAYER_UPDATE: return &player_turn.update;
+	case PLAYER_END:    return &player_turn.end;
+
+	case ZOMBIE_START:  return &zombie_turn.start;
+	case ZOMBIE_UPDATE: return &zombie_turn.update;
+	case ZOMBIE_END:    return &zombie_turn.end;
+	}
+	return NULL;
+}
+
+/*______________________________________________________________
+@brief Returns the event type of the current turn's start, update or end.
+
+@param[in] player_event - PLAYER_START, PLAYER_UPDATE or PLAYER_END, the zombie events are in the same order after them
+*/
+TurnEventType GetCurrentTurnEvent(TurnEventType player_event) {
+	return current_turn_type == TURN_ZOMBIE ? (TurnEventType)(player_event + ZOMBIE_START) : player_event;
+}
+
+/*______________________________________________________________
+@brief Adds a new function to the end of the events array, growing it if it is full, and gives it a handle slot.
+	   It is sorted in by priority the next time the event happens (TidyArray).
 
 @param[in] turn_array - The array of events to add the new function pointer to
-@param[in] function_pointer - The new function to add
+@param[in] function_pointer - The new function to add, if it takes no pointer
+@param[in] callback - The new function to add, if it takes a pointer
+@param[in] user_data - The pointer passed to callback
 @param[in] priority - Where in the array should the function pointer be placed in
+@return The handle of the new event, NO_EVENT_HANDLE if there was no memory for it
 */
-void InsertToArrayAt(TurnEvent *turn_array, void(*function_pointer)(void), int priority) {
-	// Check with functions has a priority lower than the new one, we will ignore those
-	int insert_index = 0, max = turn_array->count;
-
-	for (int index = 0; index <= max; ++index) {
-		if (turn_array->events[index].priority < priority) {
-			insert_index = index;
-			break;
-		}
+EventHandle AddToArray(TurnEvent *turn_array, void(*function_pointer)(void), EventCallback callback, void* user_data, int priority) {
+	// Grow the array if it is full
+	if (turn_array->count == turn_array->capacity) {
+		int capacity = turn_array->capacity > 0 ? turn_array->capacity * 2 : FIRST_EVENTS_CAPACITY;
+		Event *events = realloc(turn_array->events, sizeof(Event) * (size_t)capacity);
+		if (events == NULL) return NO_EVENT_HANDLE;
+		turn_array->events = events;
+		turn_array->capacity = capacity;
 	}
 
-	// Shift all functions with lower priority backwards to make space for the new function
-	for (int index = max; index >= insert_index; --index) {
-		turn_array->events[index + 1] = turn_array->events[index];
+	// Take a free slot for the handle, or add one
+	int slot = first_free_slot;
+	if (slot >= 0) {
+		first_free_slot = event_slots[slot].next_free;
 	}
-	// Finally, insert the new function
-	turn_array->events[insert_index].event = function_pointer;
-	turn_array->events[insert_index].priority = priority;
+	else {
+		if (event_slot_count == MAX_EVENT_SLOTS) return NO_EVENT_HANDLE;
+		if (event_slot_count == event_slot_capacity) {
+			int capacity = event_slot_capacity > 0 ? event_slot_capacity * 2 : FIRST_EVENTS_CAPACITY * 4;
+			EventSlot *slots = realloc(event_slots, sizeof(EventSlot) * (size_t)capacity);
+			if (slots == NULL) return NO_EVENT_HANDLE;
+			event_slots = slots;
+			event_slot_capacity = capacity;
+		}
+		slot = event_slot_count++;
+		event_slots[slot].generation = 1;
+	}
+
+	int index = turn_array->count++;
+	event_slots[slot].owner = turn_array;
+	event_slots[slot].index = index;
+
+	Event *new_event = &turn_array->events[index];
+	new_event->event = function_pointer;
+	new_event->callback = callback;
+	new_event->user_data = user_data;
+	new_event->priority = priority;
+	new_event->slot = slot;
 
-	// Increase the count to match new size
-	++turn_array->count;
+	return (EventHandle)(event_slots[slot].generation << EVENT_SLOT_BITS) | (EventHandle)(slot + 1);
 }
 
 /*______________________________________________________________
-@brief Removes an existing function pointer from the events array,
-	   shifts all the functions below the removed functions up by 1
+@brief Marks an event in the events array as unsubscribed and frees its handle slot. Nothing is shifted, the event
+	   is skipped from now on and taken out of the array the next time the event happens (TidyArray).
 
 @param[in] turn_array - The array of events to remove the function pointer from
-@param[in] function_pointer - The function to remove
+@param[in] index - Where the event to remove is in the array
 */
-void RemoveFromArrayAt(TurnEvent *turn_array, void(*function_pointer)(void)) {
-	int remove_index = -1, max = turn_array->count;
+void RemoveFromArrayAt(TurnEvent *turn_array, int index) {
+	Event *removed = &turn_array->events[index];
+	if (removed->slot < 0) return;
+
+	EventSlot *event_slot = &event_slots[removed->slot];
+	event_slot->owner = NULL;
+	event_slot->generation = (event_slot->generation + 1) & MAX_EVENT_SLOTS;
+	if (event_slot->generation == 0) event_slot->generation = 1;
+	event_slot->next_free = first_free_slot;
+	first_free_slot = removed->slot;
+
+	removed->event = NULL;
+	removed->callback = NULL;
+	removed->slot = -1;
+	++turn_array->removed_count;
+}
+
+/*______________________________________________________________
+@brief Takes the unsubscribed events out of the array and sorts the new ones in by priority, higher first. A new event
+	   goes after the ones with the same priority, so they stay in the order they subscribed.
 
-	for (int index = 0; index < max; ++index) {
-		if (turn_array->events[index].event == function_pointer) {
-			remove_index = index;
-			break;
+@param[in] turn_array - The array of events to tidy, it must not be in the middle of being called
+*/
+void TidyArray(TurnEvent *turn_array) {
+	Event *events = turn_array->events;
+	int kept = 0;
+
+	for (int index = 0; index < turn_array->count; ++index) {
+		if (events[index].slot < 0) continue;
+
+		// Events from sorted_count on are new, shift the ones with lower priority backwards to make space for each
+		Event current = events[index];
+		int insert_index = kept;
+		if (index >= turn_array->sorted_count) {
+			while (insert_index > 0 && events[insert_index - 1].priority < current.priority) {
+				events[insert_index] = events[insert_index - 1];
+				event_slots[events[insert_index].slot].index = insert_index;
+				--insert_index;
+			}
 		}
+		events[insert_index] = current;
+		event_slots[current.slot].index = insert_index;
+		++kept;
+	}
+
+	turn_array->count = kept;
+	turn_array->sorted_count = kept;
+	turn_array->removed_count = 0;
+}
+
+/*______________________________________________________________
+@brief Calls every function subscribed to the event. Only the events subscribed before it started are called,
+	   events unsubscribed on the way are skipped.
+
+@param[in] event_type - The event to call
+*/
+void DispatchEvents(TurnEventType event_type) {
+	TurnEvent *turn_array = GetTurnEvent(event_type);
+	ProfilerBegin((ProfileZone)(PROFILE_PLAYER_START + event_type));
+	if (turn_array->dispatch_depth == 0 && (turn_array->removed_count > 0 || turn_array->sorted_count != turn_array->count)) {
+		TidyArray(turn_array);
+	}
+
+	++turn_array->dispatch_depth;
+	++events_dispatching;
+
+	// The array can grow (and move) while a function is called, so it is indexed again every time
+	int total_events_subscribed = turn_array->sorted_count;
+	for (int index = 0; index < total_events_subscribed && index < turn_array->count; ++index) {
+		Event current = turn_array->events[index];
+		if (current.callback) current.callback(current.user_data);
+		else if (current.event) current.event();
 	}
 
-	// If function not found, stop
-	if (remove_index < 0) return;
+	--events_dispatching;
+	--turn_array->dispatch_depth;
+	ProfilerEnd((ProfileZone)(PROFILE_PLAYER_START + event_type));
+}
+
+/*______________________________________________________________
+@brief Does the queued turn swaps once no event is being called, calls the end events for the current turn and the
+	   start events for the new one. Swaps asked for by those events are queued behind and done in order.
+*/
+void ApplyQueuedSwitches(void) {
+	if (events_dispatching > 0 || applying_switches) return;
+	applying_switches = 1;
+
+	for (int queued = 0; queued < queued_switch_count; ++queued) {
+		// Call the exit events for the current turn
+		DispatchEvents(GetCurrentTurnEvent(PLAYER_END));
+
+		// Update the current turn to the new one
+		current_turn_type = queued_switches[queued];
+		switch (current_turn_type) {
+		case TURN_PLAYER: current_turn = &player_turn; break;
+		case TURN_ZOMBIE: current_turn = &zombie_turn; break;
+		}
 
-	// Else, shift all the functions forward
-	for (int index = remove_index; index < max; ++index) {
-		turn_array->events[index] = turn_array->events[index + 1];
+		// Call the start events for the current turn
+		DispatchEvents(GetCurrentTurnEvent(PLAYER_START));
 	}
 
-	// Decrease the count to match new size
-	--turn_array->count;
+	queued_switch_count = 0;
+	applying_switches = 0;
+}
+
+/*______________________________________________________________
+@brief Frees the events array and resets it to empty. If it is being called right now, it stops after the current function.
+
+@param[in] turn_array - The array of events to free
+*/
+void FreeTurnEvent(TurnEvent *turn_array) {
+	int dispatch_depth = turn_array->dispatch_depth;
+	free(turn_array->events);
+	memset(turn_array, 0, sizeof(TurnEvent));
+	turn_array->dispatch_depth = dispatch_depth;
 }
@@ -17,6 +17,7 @@ ________________________________________________________________________________
 #include "Hearts.h"
 #include "Win.h"
 #include "WaveSystem.h"
+#include "AssetLoader.h"
 #include <stdio.h>
 
 #define ENEMIES_KILLED 12
@@ -64,7 +65,7 @@ void InitializeButtonsGameOverScreen(void) {
 
 	TextData GameOverTextData = {
 	.color = MENU_WHITE,
-	.font = CP_Font_Load("Assets/PressStart2P-Regular.ttf"),
+	.font = GetAssetFont("Assets/PressStart2P-Regular.ttf"),
 	.textSize = 50 * GetHeightScale(),
 	// Text will be drawn on the X Y pos of btn rect (which is top left corner),
 	// So we shift text to top left.
@@ -165,7 +166,7 @@ and buttons for the Game Over screen
 ------------------------------------------------------------------------------*/
 void GameOverInit(void) {
 	CP_Graphics_ClearBackground(GAMEOVER_DARKGRAY);
-	main_font = CP_Font_Load("Assets/PressStart2P-Regular.ttf");
+	main_font = GetAssetFont("Assets/PressStart2P-Regular.ttf");
 
 	// Populate buttons with positional, size and text values
 	InitializeButtonsGameOverScreen();
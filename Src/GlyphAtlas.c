@@ -0,0 +1,456 @@
+/*!
+@file	  GlyphAtlas.c
+@date     17/10/2026
+@brief    This source file contains the glyph atlas, see GlyphAtlas.h. The outlines of the characters are read
+		  straight from the TrueType font (cmap, loca, glyf, hhea and hmtx tables) and filled into the atlas with
+		  the nonzero rule, 4 rows of samples a pixel and the exact covered width along each row. Curves are cut
+		  into lines. Composite glyphs are left empty, none of the printable characters of the game font are.
+		  There are 15 functions in this file,
+
+		  GlyphAtlasInit - Bakes the atlas at a glyph size.
+		  GlyphAtlasFree - Frees the atlas.
+		  DrawGlyph - Draws a character now.
+		  QueueGlyph - Queues a character in the render queue.
+
+		  ReadFont - Reads the whole font file, when it is not in the asset pack.
+		  FindTable - Returns where a table of the font starts.
+		  FindGlyph - Returns the glyph of a character from the cmap.
+		  BakeGlyph - Fills a character into its cell of the atlas.
+		  AddContour - Cuts a closed outline of a glyph into edges.
+		  AddCurve - Cuts a curve of an outline into edges.
+		  AddEdge - Adds an edge to be filled.
+		  FillEdges - Fills the edges into a cell, the covered part of each pixel is its alpha.
+		  ReadUShort, ReadShort, ReadULong - Read the big endian numbers of the font, byte by byte so it works on
+		  any machine.
+
+		  Atlas layout, GLYPH_COLUMNS cells a row from ' ', each cell is the glyph with GLYPH_PADDING empty pixels
+		  around it so the filtering of one character never reaches into the next.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "GlyphAtlas.h"
+#include "AssetPack.h"		// For the font, when it is packed
+
+#define GLYPH_FIRST ' '
+#define GLYPH_LAST '~'
+#define GLYPH_COUNT (GLYPH_LAST - GLYPH_FIRST + 1)
+#define GLYPH_COLUMNS 16
+#define GLYPH_PADDING 1
+#define GLYPH_MAX_SIZE 256		// Biggest glyph that is baked, bigger sizes are stretched
+#define GLYPH_SUBROWS 4			// Rows of samples a pixel
+#define GLYPH_CURVE_STEPS 4		// Lines a curve is cut into
+#define MAX_GLYPH_POINTS 512
+#define MAX_GLYPH_EDGES 1024
+#define MAX_GLYPH_CROSSINGS 64	// Edges crossing a row of samples
+
+/*______________________________________________________________
+@brief A line of an outline in the pixels of a cell, y0 is above y1. Direction is 1 if it went down, -1 if up.
+*/
+typedef struct GlyphEdge {
+	float x0, y0, x1, y1;
+	int direction;
+} GlyphEdge;
+
+/*______________________________________________________________
+@brief Where the tables used are in the font.
+*/
+typedef struct FontTables {
+	unsigned char const* data;
+	size_t size;
+	unsigned int cmap, glyf, head, hhea, hmtx, loca;
+} FontTables;
+
+CP_Image glyph_atlas = NULL;
+int glyph_size = 0;				// Size the atlas was baked at in pixels
+_Bool glyph_is_empty[GLYPH_COUNT];	// Nothing to draw, like ' '
+
+float* glyph_coverage = NULL;		// Coverage of the cell being baked, only there during GlyphAtlasInit
+GlyphEdge glyph_edges[MAX_GLYPH_EDGES];
+int glyph_edge_count = 0;
+
+// Font units to cell pixels of the glyph being baked
+float glyph_scale = 0.0f;
+float glyph_origin_x = 0.0f;
+float glyph_origin_y = 0.0f;
+
+#pragma region
+unsigned char* ReadFont(char const* path, size_t* size);
+unsigned int FindTable(unsigned char const* font, size_t size, char const* tag);
+unsigned int FindGlyph(FontTables const* tables, int character);
+void BakeGlyph(FontTables const* tables, int character, unsigned char* pixels, int atlas_width);
+void AddContour(float const* x, float const* y, unsigned char const* on_curve, int count);
+void AddCurve(float x0, float y0, float control_x, float control_y, float x1, float y1);
+void AddEdge(float x0, float y0, float x1, float y1);
+void FillEdges(void);
+unsigned int ReadUShort(unsigned char const* data);
+int ReadShort(unsigned char const* data);
+unsigned int ReadULong(unsigned char const* data);
+#pragma endregion Forward Declarations
+
+void GlyphAtlasInit(float size){
+	GlyphAtlasFree();
+	glyph_size = (int)ceilf(size);
+	if (glyph_size < 1) return;
+	if (glyph_size > GLYPH_MAX_SIZE) glyph_size = GLYPH_MAX_SIZE;
+
+	// The font is read from the asset pack without a copy if it is there
+	FontTables tables = { 0 };
+	unsigned char* read = NULL;
+	unsigned char const* font = FindPackedAsset(GLYPH_FONT_PATH, &tables.size);
+	if (font == NULL) font = read = ReadFont(GLYPH_FONT_PATH, &tables.size);
+	if (font == NULL) return;
+	tables.data = font;
+	tables.cmap = FindTable(font, tables.size, "cmap");
+	tables.glyf = FindTable(font, tables.size, "glyf");
+	tables.head = FindTable(font, tables.size, "head");
+	tables.hhea = FindTable(font, tables.size, "hhea");
+	tables.hmtx = FindTable(font, tables.size, "hmtx");
+	tables.loca = FindTable(font, tables.size, "loca");
+	if (!tables.cmap || !tables.glyf || !tables.head || !tables.hhea || !tables.hmtx || !tables.loca) {
+		free(read);
+		return;
+	}
+
+	int cell = glyph_size + GLYPH_PADDING * 2;
+	int width = GLYPH_COLUMNS * cell;
+	int height = (GLYPH_COUNT + GLYPH_COLUMNS - 1) / GLYPH_COLUMNS * cell;
+	unsigned char* pixels = calloc((size_t)width * (size_t)height, 4);
+	glyph_coverage = malloc(sizeof(float) * (size_t)glyph_size * (size_t)glyph_size);
+	if (pixels != NULL && glyph_coverage != NULL) {
+		for (int character = GLYPH_FIRST; character <= GLYPH_LAST; ++character) {
+			BakeGlyph(&tables, character, pixels, width);
+		}
+		glyph_atlas = CP_Image_CreateFromData(width, height, pixels);
+	}
+
+	free(glyph_coverage);
+	glyph_coverage = NULL;
+	free(pixels);
+	free(read);
+}
+
+void GlyphAtlasFree(void){
+	if (glyph_atlas != NULL) CP_Image_Free(&glyph_atlas);
+	glyph_atlas = NULL;
+}
+
+void DrawGlyph(char glyph, float x, float y, float size, CP_Color color){
+	if (glyph == '\0') return;
+	int index = glyph - GLYPH_FIRST;
+	if (glyph_atlas == NULL || index < 0 || index >= GLYPH_COUNT) {
+		char text[2] = { glyph, '\0' };
+		CP_Settings_Fill(color);
+		CP_Settings_TextSize(size);
+		CP_Settings_TextAlignment(CP_TEXT_ALIGN_H_CENTER, CP_TEXT_ALIGN_V_MIDDLE);
+		CP_Font_DrawText(text, x, y);
+		return;
+	}
+	if (glyph_is_empty[index]) return;
+
+	float u = (float)(index % GLYPH_COLUMNS * (glyph_size + GLYPH_PADDING * 2) + GLYPH_PADDING);
+	float v = (float)(index / GLYPH_COLUMNS * (glyph_size + GLYPH_PADDING * 2) + GLYPH_PADDING);
+	CP_Settings_Tint(CP_Color_Create(color.r, color.g, color.b, 255));
+	CP_Image_DrawSubImage(glyph_atlas, x, y, size, size, u, v, u + glyph_size, v + glyph_size, color.a);
+	CP_Settings_NoTint();
+}
+
+void QueueGlyph(RenderLayer layer, char glyph, float x, float y, float size, CP_Color color){
+	int index = glyph - GLYPH_FIRST;
+	if (glyph_atlas == NULL || index < 0 || index >= GLYPH_COUNT) {
+		DrawGlyph(glyph, x, y, size, color);
+		return;
+	}
+	if (glyph_is_empty[index]) return;
+
+	float u = (float)(index % GLYPH_COLUMNS * (glyph_size + GLYPH_PADDING * 2) + GLYPH_PADDING);
+	float v = (float)(index / GLYPH_COLUMNS * (glyph_size + GLYPH_PADDING * 2) + GLYPH_PADDING);
+	RenderQueueSubImage(layer, glyph_atlas, x, y, size, size, u, v, u + glyph_size, v + glyph_size, color);
+}
+
+unsigned char* ReadFont(char const* path, size_t* size){
+	FILE* file = NULL;
+#ifdef _MSC_VER
+	if (fopen_s(&file, path, "rb") != 0) file = NULL;
+#else
+	file = fopen(path, "rb");
+#endif
+	if (file == NULL) return NULL;
+
+	unsigned char* font = NULL;
+	long length = 0;
+	if (fseek(file, 0, SEEK_END) == 0 && (length = ftell(file)) > 12 && fseek(file, 0, SEEK_SET) == 0) {
+		font = malloc((size_t)length);
+		if (font != NULL && fread(font, 1, (size_t)length, file) != (size_t)length) {
+			free(font);
+			font = NULL;
+		}
+	}
+	fclose(file);
+	*size = (size_t)length;
+	return font;
+}
+
+unsigned int FindTable(unsigned char const* font, size_t size, char const* tag){
+	unsigned int table_count = ReadUShort(font + 4);
+	if (12 + (size_t)table_count * 16 > size) return 0;
+	for (unsigned int index = 0; index < table_count; ++index) {
+		unsigned char const* record = font + 12 + index * 16;
+		if (memcmp(record, tag, 4) != 0) continue;
+		unsigned int offset = ReadULong(record + 8);
+		unsigned int length = ReadULong(record + 12);
+		return (size_t)offset + length <= size ? offset : 0;
+	}
+	return 0;
+}
+
+unsigned int FindGlyph(FontTables const* tables, int character){
+	unsigned char const* cmap = tables->data + tables->cmap;
+	unsigned int subtable_count = ReadUShort(cmap + 2);
+
+	// Only the unicode BMP subtable (format 4) is read, every TrueType font made for windows has one
+	for (unsigned int index = 0; index < subtable_count; ++index) {
+		unsigned char const* record = cmap + 4 + index * 8;
+		unsigned int platform = ReadUShort(record), encoding = ReadUShort(record + 2);
+		if (!(platform == 3 && encoding == 1) && platform != 0) continue;
+		unsigned char const* subtable = cmap + ReadULong(record + 4);
+		if (ReadUShort(subtable) != 4) continue;
+
+		unsigned int segment_count = ReadUShort(subtable + 6) / 2;
+		unsigned char const* end_codes = subtable + 14;
+		unsigned char const* start_codes = end_codes + segment_count * 2 + 2;
+		unsigned char const* deltas = start_codes + segment_count * 2;
+		unsigned char const* range_offsets = deltas + segment_count * 2;
+		for (unsigned int segment = 0; segment < segment_count; ++segment) {
+			if ((unsigned int)character > ReadUShort(end_codes + segment * 2)) continue;
+			unsigned int start = ReadUShort(start_codes + segment * 2);
+			if ((unsigned int)character < start) return 0;
+
+			unsigned int delta = ReadUShort(deltas + segment * 2);
+			unsigned int range_offset = ReadUShort(range_offsets + segment * 2);
+			if (range_offset == 0) return (character + delta) & 0xFFFF;
+			unsigned int glyph = ReadUShort(range_offsets + segment * 2 + range_offset + (character - start) * 2);
+			return glyph == 0 ? 0 : (glyph + delta) & 0xFFFF;
+		}
+		return 0;
+	}
+	return 0;
+}
+
+void BakeGlyph(FontTables const* tables, int character, unsigned char* pixels, int atlas_width){
+	int index = character - GLYPH_FIRST;
+	glyph_is_empty[index] = TRUE;
+
+	unsigned char const* font = tables->data;
+	unsigned int glyph = FindGlyph(tables, character);
+	if (glyph == 0) return;
+
+	// Where the glyph is, loca is in halves of the offset when the short format is used
+	unsigned int start, end;
+	if (ReadShort(font + tables->head + 50) == 0) {
+		start = ReadUShort(font + tables->loca + glyph * 2) * 2;
+		end = ReadUShort(font + tables->loca + glyph * 2 + 2) * 2;
+	}
+	else {
+		start = ReadULong(font + tables->loca + glyph * 4);
+		end = ReadULong(font + tables->loca + glyph * 4 + 4);
+	}
+	if (end <= start || tables->glyf + (size_t)end > tables->size) return;
+	unsigned char const* data = font + tables->glyf + start;
+	int contour_count = ReadShort(data);
+	if (contour_count <= 0) return;
+
+	// The em box (ascender to descender) is the height of the cell and the advance is centered in it, which is where
+	// CP_Font_DrawText puts the character with CP_TEXT_ALIGN_H_CENTER and CP_TEXT_ALIGN_V_MIDDLE
+	int ascender = ReadShort(font + tables->hhea + 4);
+	int descender = ReadShort(font + tables->hhea + 6);
+	unsigned int metric_count = ReadUShort(font + tables->hhea + 34);
+	unsigned int advance = ReadUShort(font + tables->hmtx + (glyph < metric_count ? glyph : metric_count - 1) * 4);
+	if (ascender <= descender) return;
+	glyph_scale = (float)glyph_size / (float)(ascender - descender);
+	glyph_origin_x = ((float)glyph_size - advance * glyph_scale) * 0.5f;
+	glyph_origin_y = ascender * glyph_scale;
+
+	// Points of the outline, the flags and coordinates are packed and have to be read one after another
+	static float point_x[MAX_GLYPH_POINTS], point_y[MAX_GLYPH_POINTS];
+	static unsigned char flags[MAX_GLYPH_POINTS];
+	unsigned char const* end_points = data + 10;
+	int point_count = (int)ReadUShort(end_points + (contour_count - 1) * 2) + 1;
+	if (point_count > MAX_GLYPH_POINTS) return;
+	unsigned char const* cursor = end_points + contour_count * 2;
+	cursor += 2 + ReadUShort(cursor);
+
+	for (int point = 0; point < point_count; ) {
+		unsigned char flag = *cursor++;
+		int repeat = (flag & 8) ? *cursor++ : 0;
+		for (int copy = 0; copy <= repeat && point < point_count; ++copy) flags[point++] = flag;
+	}
+	int value = 0;
+	for (int point = 0; point < point_count; ++point) {
+		if (flags[point] & 2) value += (flags[point] & 16) ? *cursor++ : -*cursor++;
+		else if (!(flags[point] & 16)) { value += ReadShort(cursor); cursor += 2; }
+		point_x[point] = glyph_origin_x + value * glyph_scale;
+	}
+	value = 0;
+	for (int point = 0; point < point_count; ++point) {
+		if (flags[point] & 4) value += (flags[point] & 32) ? *cursor++ : -*cursor++;
+		else if (!(flags[point] & 32)) { value += ReadShort(cursor); cursor += 2; }
+		point_y[point] = glyph_origin_y - value * glyph_scale;
+	}
+	for (int point = 0; point < point_count; ++point) flags[point] &= 1;
+
+	glyph_edge_count = 0;
+	int first = 0;
+	for (int contour = 0; contour < contour_count; ++contour) {
+		int last = (int)ReadUShort(end_points + contour * 2);
+		if (last < first || last >= point_count) break;
+		AddContour(point_x + first, point_y + first, flags + first, last - first + 1);
+		first = last + 1;
+	}
+	if (glyph_edge_count == 0) return;
+
+	FillEdges();
+	int cell = glyph_size + GLYPH_PADDING * 2;
+	int cell_x = index % GLYPH_COLUMNS * cell + GLYPH_PADDING;
+	int cell_y = index / GLYPH_COLUMNS * cell + GLYPH_PADDING;
+	for (int y = 0; y < glyph_size; ++y) {
+		for (int x = 0; x < glyph_size; ++x) {
+			float coverage = glyph_coverage[y * glyph_size + x];
+			if (coverage <= 0.0f) continue;
+			unsigned char* pixel = &pixels[((size_t)(cell_y + y) * (size_t)atlas_width + (size_t)(cell_x + x)) * 4];
+			// White, so the tint is the color
+			pixel[0] = pixel[1] = pixel[2] = 255;
+			pixel[3] = (unsigned char)(coverage >= 1.0f ? 255 : coverage * 255.0f + 0.5f);
+			glyph_is_empty[index] = FALSE;
+		}
+	}
+}
+
+void AddContour(float const* x, float const* y, unsigned char const* on_curve, int count){
+	// Start on a point on the curve, or between the last and first points if none are
+	int first = 0;
+	while (first < count && !on_curve[first]) ++first;
+	float start_x, start_y;
+	int steps;
+	if (first < count) {
+		start_x = x[first];
+		start_y = y[first];
+		steps = count - 1;
+	}
+	else {
+		first = count - 1;
+		start_x = (x[count - 1] + x[0]) * 0.5f;
+		start_y = (y[count - 1] + y[0]) * 0.5f;
+		steps = count;
+	}
+
+	// Two points off the curve in a row have a point on the curve between them
+	float pen_x = start_x, pen_y = start_y;
+	float control_x = 0.0f, control_y = 0.0f;
+	_Bool has_control = FALSE;
+	for (int step = 1; step <= steps; ++step) {
+		int point = (first + step) % count;
+		if (on_curve[point]) {
+			if (has_control) AddCurve(pen_x, pen_y, control_x, control_y, x[point], y[point]);
+			else AddEdge(pen_x, pen_y, x[point], y[point]);
+			pen_x = x[point];
+			pen_y = y[point];
+			has_control = FALSE;
+		}
+		else {
+			if (has_control) {
+				float middle_x = (control_x + x[point]) * 0.5f, middle_y = (control_y + y[point]) * 0.5f;
+				AddCurve(pen_x, pen_y, control_x, control_y, middle_x, middle_y);
+				pen_x = middle_x;
+				pen_y = middle_y;
+			}
+			control_x = x[point];
+			control_y = y[point];
+			has_control = TRUE;
+		}
+	}
+	if (has_control) AddCurve(pen_x, pen_y, control_x, control_y, start_x, start_y);
+	else AddEdge(pen_x, pen_y, start_x, start_y);
+}
+
+void AddCurve(float x0, float y0, float control_x, float control_y, float x1, float y1){
+	float last_x = x0, last_y = y0;
+	for (int step = 1; step <= GLYPH_CURVE_STEPS; ++step) {
+		float t = (float)step / GLYPH_CURVE_STEPS, s = 1.0f - t;
+		float next_x = s * s * x0 + 2.0f * s * t * control_x + t * t * x1;
+		float next_y = s * s * y0 + 2.0f * s * t * control_y + t * t * y1;
+		AddEdge(last_x, last_y, next_x, next_y);
+		last_x = next_x;
+		last_y = next_y;
+	}
+}
+
+void AddEdge(float x0, float y0, float x1, float y1){
+	// Flat edges never cross a row of samples
+	if (y0 == y1 || glyph_edge_count == MAX_GLYPH_EDGES) return;
+	GlyphEdge* edge = &glyph_edges[glyph_edge_count++];
+	edge->direction = y1 > y0 ? 1 : -1;
+	if (y0 > y1) {
+		float swap = x0; x0 = x1; x1 = swap;
+		swap = y0; y0 = y1; y1 = swap;
+	}
+	edge->x0 = x0;
+	edge->y0 = y0;
+	edge->x1 = x1;
+	edge->y1 = y1;
+}
+
+void FillEdges(void){
+	memset(glyph_coverage, 0, sizeof(float) * (size_t)glyph_size * (size_t)glyph_size);
+	float crossing_x[MAX_GLYPH_CROSSINGS];
+	int crossing_direction[MAX_GLYPH_CROSSINGS];
+
+	for (int row = 0; row < glyph_size * GLYPH_SUBROWS; ++row) {
+		float sample_y = (row + 0.5f) / GLYPH_SUBROWS;
+		float* coverage = &glyph_coverage[row / GLYPH_SUBROWS * glyph_size];
+
+		// Where the edges cross this row, sorted left to right
+		int crossing_count = 0;
+		for (int index = 0; index < glyph_edge_count && crossing_count < MAX_GLYPH_CROSSINGS; ++index) {
+			GlyphEdge const* edge = &glyph_edges[index];
+			if (sample_y < edge->y0 || sample_y >= edge->y1) continue;
+			float x = edge->x0 + (edge->x1 - edge->x0) * (sample_y - edge->y0) / (edge->y1 - edge->y0);
+			int slot = crossing_count++;
+			for (; slot > 0 && crossing_x[slot - 1] > x; --slot) {
+				crossing_x[slot] = crossing_x[slot - 1];
+				crossing_direction[slot] = crossing_direction[slot - 1];
+			}
+			crossing_x[slot] = x;
+			crossing_direction[slot] = edge->direction;
+		}
+
+		// Inside where the winding is not 0, each pixel gets the width of it that is inside
+		int winding = 0;
+		for (int index = 0; index + 1 < crossing_count; ++index) {
+			winding += crossing_direction[index];
+			if (winding == 0) continue;
+			float left = fmaxf(crossing_x[index], 0.0f);
+			float right = fminf(crossing_x[index + 1], (float)glyph_size);
+			for (int x = (int)left; x < glyph_size && x < right; ++x) {
+				float inside = fminf(right, x + 1.0f) - fmaxf(left, (float)x);
+				if (inside > 0.0f) coverage[x] += inside / GLYPH_SUBROWS;
+			}
+		}
+	}
+}
+
+unsigned int ReadUShort(unsigned char const* data){
+	return (unsigned int)data[0] << 8 | data[1];
+}
+
+int ReadShort(unsigned char const* data){
+	return (short)ReadUShort(data);
+}
+
+unsigned int ReadULong(unsigned char const* data){
+	return ReadUShort(data) << 16 | ReadUShort(data + 2);
+}
@@ -5,6 +5,10 @@
 @brief    1.Drawing of the grid
 		  2.Calculate,set and send info about each in the cell
 
+		  The grid lines and cells only change when the window does, so they are drawn once into an image when the
+		  grid is initialised (BakeBoard) and that image is drawn every frame. Only the dots, the warning marks and
+		  the enemies are drawn every frame.
+
 @license  Copyright  2022 DigiPen, All rights reserved.
 ________________________________________________________________________________________________________*/
 
@@ -13,7 +17,14 @@ ________________________________________________________________________________
 #include "ColorTable.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <math.h>
 #include "WaveSystem.h"
+#include "RenderQueue.h"
+#include "GlyphAtlas.h"
+#include "Tween.h"
+
+#define GRID_LINE_WEIGHT 0.03f	// Stroke weight of the grid lines, in cell lengths
+#define GRID_CELL_WEIGHT 0.1f	// Stroke weight around each cell, in cell lengths
 
 
 
@@ -35,12 +46,25 @@ int x_Index = 0;
 int y_Index = 0;
 
 // Exclamation mark settings
-float exclaim_elapsed_time;
+Tween exclaim_blink;				// Goes round every two blinks, shown for the second half
 float exclaim_blink_speed = 0.35f;
 
 SpaceInfo space[TOTAL_XGRID][TOTAL_YGRID];
 CurrentGridPos grid_Info;
 
+// The static board, baked when the grid is initialised
+CP_Image board_image = NULL;
+float board_top = 0;			// Window y of the top row of the image, it is as wide as the window
+int board_height = 0;
+unsigned char* board_pixels = NULL;	// Premultiplied while baking, only there during BakeBoard
+
+#pragma region
+void BakeBoard(void);
+void BakeBox(float left, float top, float right, float bottom, CP_Color color);
+void BakeRect(float x, float y, float w, float h, CP_Color fill, CP_Color stroke, float stroke_weight);
+void BakeLine(float x1, float y1, float x2, float y2, CP_Color stroke, float stroke_weight);
+#pragma endregion Forward Declarations
+
 /*______________________________________________________________
 @brief Set the grid and cell for the playing at the start of the game
 ______________________________________________________________*/
@@ -71,10 +95,17 @@ void grid_init(void) {
 	cellLength = size;
 
 	// Initialize exclaimation mark time setting
-	exclaim_elapsed_time = 0.0f;
+	exclaim_blink = TweenTimer(exclaim_blink_speed * 2, TWEEN_LOOP);
 
 	CP_Settings_StrokeWeight(1);
 	CreatePlayingSpace();
+	BakeBoard();
+}
+/*______________________________________________________________
+@brief Frees the baked board, needs to be called on the exit of the game level
+______________________________________________________________*/
+void grid_exit(void) {
+	CP_Image_Free(&board_image);
 }
 /*______________________________________________________________
 @brief Create the cell for player to place their piece and enemy to move in
@@ -157,73 +188,145 @@ struct CurrentGridPos CurrentPos(int x,int y){
 	return CGP;
 }
 /*______________________________________________________________
-@brief Draw grid line
+@brief Draw grid line, and the cells under them, from the baked board
 ______________________________________________________________*/
 void DrawLineGrid(void){
-	CP_Settings_Stroke(BLACK);
-	float grid_CurrentIndex = 0;
+	if (board_image == NULL) BakeBoard();
+	if (board_image == NULL) return;
+
+	// The rest of the game draws images from their centre
+	CP_Settings_ImageMode(CP_POSITION_CORNER);
+	CP_Image_Draw(board_image, 0.f, board_top, (float)CP_Image_GetWidth(board_image), (float)board_height, 255);
+	CP_Settings_ImageMode(CP_POSITION_CENTER);
+}
+/*______________________________________________________________
+@brief Draws the grid lines and the cells into board_image, the same shapes CP would draw with
+	   anti-aliased edges. Everything is an axis aligned box, so each pixel is covered by the area of it.
+______________________________________________________________*/
+void BakeBoard(void) {
+	CP_Image_Free(&board_image);
+
+	// The cell strokes and the lines stick out past the top and bottom of the grid by half their weight
+	float stroke_pad = cellLength * GRID_CELL_WEIGHT / 2 + 1.f;
+	int width = WINDOWLENGTH;
+	int top = (int)(gridTop - stroke_pad);
+	if (top < 0) top = 0;
+	board_top = (float)top;
+	board_height = (int)(gridBottom + stroke_pad) + 1 - top;
+	if (width <= 0 || board_height <= 0) return;
+
+	board_pixels = calloc((size_t)width * (size_t)board_height, 4);
+	if (board_pixels == NULL) return;
+
 	/*
 	* NOTE:
-	* THIS ONLY DRAW A GRID. DOES NOT SET UP GRID CELL
+	* THE SAME LINES AS THE GRID USED TO BE DRAWN WITH, THEN THE CELLS OVER THEM
 	*/
-	CP_Graphics_DrawLine(0.f, gridTop, (float)WINDOWLENGTH, gridTop);
-	CP_Graphics_DrawLine(0.f, gridBottom, (float)WINDOWLENGTH, gridBottom);
+	float line_weight = cellLength * GRID_LINE_WEIGHT;
+	BakeLine(0.f, gridTop, (float)width, gridTop, BLACK, line_weight);
+	BakeLine(0.f, gridBottom, (float)width, gridBottom, BLACK, line_weight);
 	//Control Y grid
-	while (grid_CurrentIndex < TOTAL_YGRID){
-		CP_Graphics_DrawLine(gridXOffset, gridTop + (grid_CurrentIndex * (float)cellLength), (float)WINDOWLENGTH-gridXOffset-(float)cellLength, gridTop + (grid_CurrentIndex * (float)cellLength));
-		grid_CurrentIndex++;
+	for (int y = 0; y < TOTAL_YGRID; ++y) {
+		BakeLine(gridXOffset, gridTop + (y * cellLength), (float)width - gridXOffset - cellLength, gridTop + (y * cellLength), BLACK, line_weight);
 	}
 	//Control XGrid
-	for (int x = 0; x < TOTAL_XGRID; x++){
-		CP_Graphics_DrawLine(gridXOffset + ((WINDOWLENGTH-gridXOffset*2)/TOTAL_XGRID) * x, gridTop, gridXOffset + (((WINDOWLENGTH-gridXOffset*2)/TOTAL_XGRID) * x), gridBottom);
+	for (int x = 0; x < TOTAL_XGRID; x++) {
+		float line_x = gridXOffset + ((width - gridXOffset * 2) / TOTAL_XGRID) * x;
+		BakeLine(line_x, gridTop, line_x, gridBottom, BLACK, line_weight);
+	}
+	for (int y = 0; y < TOTAL_YGRID; ++y) {
+		for (int x = 0; x < TOTAL_XGRID - 1; ++x) {
+			BakeRect(GridXToPosX(x) - cellLength / 2, GridYToPosY(y) - cellLength / 2, cellLength, cellLength,
+				GRID_COLOR, BLACK, cellLength * GRID_CELL_WEIGHT);
+		}
 	}
 
+	// CP takes the colors straight, not premultiplied
+	for (size_t index = 0; index < (size_t)width * (size_t)board_height * 4; index += 4) {
+		unsigned char alpha = board_pixels[index + 3];
+		if (alpha == 0 || alpha == 255) continue;
+		for (int channel = 0; channel < 3; ++channel) {
+			int straight = (board_pixels[index + channel] * 255 + alpha / 2) / alpha;
+			board_pixels[index + channel] = (unsigned char)(straight > 255 ? 255 : straight);
+		}
+	}
+	board_image = CP_Image_CreateFromData(width, board_height, board_pixels);
+	free(board_pixels);
+	board_pixels = NULL;
+}
+/*______________________________________________________________
+@brief Blends a color over the box in board_pixels, edge pixels by how much of them the box covers
+______________________________________________________________*/
+void BakeBox(float left, float top, float right, float bottom, CP_Color color) {
+	int width = WINDOWLENGTH;
+	top -= board_top;
+	bottom -= board_top;
+	int first_x = (int)floorf(left), last_x = (int)ceilf(right);
+	int first_y = (int)floorf(top), last_y = (int)ceilf(bottom);
+	if (first_x < 0) first_x = 0;
+	if (last_x > width) last_x = width;
+	if (first_y < 0) first_y = 0;
+	if (last_y > board_height) last_y = board_height;
+
+	for (int y = first_y; y < last_y; ++y) {
+		float cover_y = fminf((float)y + 1, bottom) - fmaxf((float)y, top);
+		for (int x = first_x; x < last_x; ++x) {
+			float cover_x = fminf((float)x + 1, right) - fmaxf((float)x, left);
+			float alpha = cover_x * cover_y * color.a / 255.f;
+			if (alpha <= 0) continue;
+			unsigned char* pixel = &board_pixels[((size_t)y * (size_t)width + (size_t)x) * 4];
+			pixel[0] = (unsigned char)(color.r * alpha + pixel[0] * (1 - alpha) + 0.5f);
+			pixel[1] = (unsigned char)(color.g * alpha + pixel[1] * (1 - alpha) + 0.5f);
+			pixel[2] = (unsigned char)(color.b * alpha + pixel[2] * (1 - alpha) + 0.5f);
+			pixel[3] = (unsigned char)(255 * alpha + pixel[3] * (1 - alpha) + 0.5f);
+		}
+	}
+}
+/*______________________________________________________________
+@brief Bakes a rect drawn in CP_POSITION_CORNER, the fill and then the stroke over its edges
+______________________________________________________________*/
+void BakeRect(float x, float y, float w, float h, CP_Color fill, CP_Color stroke, float stroke_weight) {
+	float half = stroke_weight / 2;
+	BakeBox(x, y, x + w, y + h, fill);
+	BakeBox(x - half, y - half, x + w + half, y + half, stroke);				// Top
+	BakeBox(x - half, y + h - half, x + w + half, y + h + half, stroke);		// Bottom
+	BakeBox(x - half, y + half, x + half, y + h - half, stroke);				// Left
+	BakeBox(x + w - half, y + half, x + w + half, y + h - half, stroke);		// Right
+}
+/*______________________________________________________________
+@brief Bakes a horizontal or vertical line with flat ends
+______________________________________________________________*/
+void BakeLine(float x1, float y1, float x2, float y2, CP_Color stroke, float stroke_weight) {
+	float half = stroke_weight / 2;
+	if (y1 == y2) BakeBox(fminf(x1, x2), y1 - half, fmaxf(x1, x2), y1 + half, stroke);
+	else BakeBox(x1 - half, fminf(y1, y2), x1 + half, fmaxf(y1, y2), stroke);
 }
 /*______________________________________________________________
 @brief Render other(aesthetics) stuff thats inside the grid
 ______________________________________________________________*/
 void RenderGridCells(void) {
-	// Zombie near warning timer
-	exclaim_elapsed_time += CP_System_GetDt();
+	// Zombie near warning, blinks on every row at once
+	_Bool exclaim_shown = TweenProgress(exclaim_blink) > 0.5f;
 
 	for (short y = 0; y < TOTAL_YGRID; ++y) {
 		// Draw a exclamation mark on rows with enemies about to kill the player
-		if ((GetAliveEnemyFromGrid(0, y) && GetAliveEnemyFromGrid(0, y)->type != WALL) || // Check the 3 columns closest to the player for enemies
-			(GetAliveEnemyFromGrid(1, y) && GetAliveEnemyFromGrid(1, y)->type != WALL) ||
-			(GetAliveEnemyFromGrid(2, y) && GetAliveEnemyFromGrid(2, y)->type != WALL)) {
+		if (HasZombieInRow(y, 0, 2)) { // Check the 3 columns closest to the player for enemies
 
 			// If there any, draw a exclamation mark ! on the left end of the row
-			CP_Settings_Fill(MENU_RED);
-			CP_Settings_TextSize(cellLength * 0.85f);
-			CP_Settings_TextAlignment(CP_TEXT_ALIGN_H_CENTER, CP_TEXT_ALIGN_V_MIDDLE);
-
-			if (exclaim_elapsed_time > exclaim_blink_speed) {
-				CP_Font_DrawText("!", GridXToPosX(-1), GridYToPosY(y));
-
-				if (exclaim_elapsed_time > exclaim_blink_speed * 2) {
-					exclaim_elapsed_time = 0.0f;
-				}
+			if (exclaim_shown) {
+				QueueGlyph(LAYER_GRID_MARKS, '!', GridXToPosX(-1), GridYToPosY(y), cellLength * 0.85f, MENU_RED);
 			}
 		}
 
 		for (short x = 0; x < TOTAL_XGRID - 1; ++x) {
-			//Draw grid line
-			CP_Settings_Fill(GRID_COLOR);
-			CP_Settings_Stroke(BLACK);
-			CP_Settings_StrokeWeight(cellLength * 0.1f);
-			CP_Settings_RectMode(CP_POSITION_CENTER);
-			CP_Graphics_DrawRect(GridXToPosX(x), GridYToPosY(y), cellLength, cellLength);
-			CP_Settings_RectMode(CP_POSITION_CORNER);
-
-			// Draw a dot in the cell if there is not zombie in it
+			// Draw a dot in the cell if there is not zombie in it, the cell itself is in the baked board
 			if (HasLiveEnemyInCell(x, y))continue;
-			CP_Settings_RectMode(CP_POSITION_CENTER);
-			CP_Settings_Fill(MENU_WHITE);
-			CP_Settings_StrokeWeight(cellLength * 0.05f);
-			CP_Graphics_DrawRect(GridXToPosX(x), GridYToPosY(y), cellLength * 0.15f, cellLength * 0.15f);
-			CP_Settings_RectMode(CP_POSITION_CORNER);
+			float dot_length = cellLength * 0.15f;
+			RenderQueueRect(LAYER_GRID_DOTS, GridXToPosX(x) - dot_length / 2, GridYToPosY(y) - dot_length / 2, dot_length, dot_length,
+				MENU_WHITE, BLACK, cellLength * 0.05f);
 		}
 	}
+	RenderQueueFlush();
 }
 
 void grid_update(void){
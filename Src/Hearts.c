@@ -14,21 +14,25 @@ ________________________________________________________________________________
 #include "UIManager.h"
 #include "ColorTable.h"
 #include "Grid.h"
+#include "WaveSystem.h" // For the hearts left in the game state
+#include "Tween.h" // For the hearts going up and down and the You Lose fade
+#include "AssetLoader.h" // For the heart image
 
 HeartContainer heart_stats[MAX_HEART_COUNT];
 CP_Image heart_image;
 TextOnlyHearts life_text;
 TextOnlyHearts lose_text;
 RectHearts lose_bg;
+_Bool lose_started;	// The You Lose title card is fading in and its timer goes to the Game Over screen, set when it is first drawn
+float lose_alpha;	// Of the You Lose title card, faded in
 
 /*----------------------------------------------------------------------------
 @brief Initializes the life image load, and fills in the HeartContainer struct
 for the data of each heart to be initialized
 ------------------------------------------------------------------------------*/
 void InitializeLife(void) {
-	heart_image = CP_Image_Load("Assets/Heart.png");
+	heart_image = GetAssetImage("Assets/Heart.png");
 	for (int i = 0; i < MAX_HEART_COUNT; ++i) {
-		heart_stats[i].heartAlive = 1; // Boolean True
 		heart_stats[i].xpos = CP_System_GetWindowWidth() / 4.f + (CP_System_GetWindowWidth() / 7.5f) * HEART_SPACING * i; // Spaces out the hearts by the size of the heart and adding the additional spacing
 		heart_stats[i].ypos = (CP_System_GetWindowHeight() / 10.f - GetCellSize());
 		heart_stats[i].size = CP_System_GetWindowWidth() / (CP_System_GetWindowWidth() * HEART_SIZE) * GetWidthScale();
@@ -55,23 +59,40 @@ void InitializeLife(void) {
 	lose_text.xpos = CP_System_GetWindowWidth() / 2.f;
 	lose_text.ypos = CP_System_GetWindowHeight() / 2.f;
 	lose_text.words = "YOU DIED!";
+	lose_started = FALSE;
+
+	AnimationLife();
+}
+
+/*----------------------------------------------------------------------------
+@brief Called when the You Lose title card has been up long enough, goes to the
+Game Over screen
+------------------------------------------------------------------------------*/
+void GoToGameOver(void* data) {
+	(void)data;
+	CP_Engine_SetNextGameState(GameOverInit, GameOverUpdate, GameOverExit);
 }
 
 /*----------------------------------------------------------------------------
 @brief Initializes the You Lose rendering and transistions to the Game Over screen
 after a few seconds
 ------------------------------------------------------------------------------*/
-static float time_elapsed_lose = 0.f;
 void YouLoseTitleRender(void) {
 	float bg_transistion_time_max = 2.f;
 	float stay_time_max = 5.8f;
 
-	time_elapsed_lose += CP_System_GetDt();
+	// Fade in the title card, and go to the Game Over screen once it stayed for a while
+	if (!lose_started) {
+		lose_started = TRUE;
+		TweenFloat(&lose_alpha, 0.f, 255.f, bg_transistion_time_max, EASE_LINEAR, TWEEN_ONCE);
+		Tween lose_timer = TweenTimer(stay_time_max * 0.9f, TWEEN_ONCE);
+		// Out of tweens, the timer would never end, so the Game Over screen is gone to now
+		if (lose_timer == TWEEN_NONE) GoToGameOver(NULL);
+		else TweenOnComplete(lose_timer, GoToGameOver, NULL);
+	}
 
 	// BG Drawing
-	float bg_transistion_time = time_elapsed_lose / bg_transistion_time_max;
-	float stay_time = time_elapsed_lose / stay_time_max;
-	int alpha_bg = CP_Math_ClampInt((int)(255 * bg_transistion_time), 0, 255);
+	int alpha_bg = (int)lose_alpha;
 	// Draw BG
 	CP_Settings_RectMode(CP_POSITION_CENTER);
 	CP_Settings_Stroke(GRID_COLOR);
@@ -83,11 +104,6 @@ void YouLoseTitleRender(void) {
 	CP_Settings_TextSize(lose_text.font_size); // Size of text
 	CP_Settings_TextAlignment(CP_TEXT_ALIGN_H_CENTER, CP_TEXT_ALIGN_V_MIDDLE); // Origin of text is it's absolute center
 	CP_Font_DrawText(lose_text.words, lose_text.xpos, lose_text.ypos);
-
-	if (stay_time >= 0.9f) {
-		time_elapsed_lose = 0.f;
-		CP_Engine_SetNextGameState(GameOverInit, GameOverUpdate, GameOverExit);
-	}
 }
 
 //-----------------------
@@ -98,31 +114,16 @@ void YouLoseTitleRender(void) {
 @brief Function to allow for the gaining of life
 ------------------------------------------------------------------------------*/
 void GainLife(int gain_life) {
-	for (int i = 0; i < MAX_HEART_COUNT; ++i) {
-		if (heart_stats[i].heartAlive == 0) {
-			heart_stats[i].heartAlive = 1;
-			heart_stats[i].alpha = 255;
-			break;
-		}
-	}
+	SimGainHearts(GetGameState(), gain_life);
 	PlaySound(GAINHEART, CP_SOUND_GROUP_SFX);
 }
 
 /*----------------------------------------------------------------------------
-@brief Function to allow for the losing of life
+@brief Function to allow for the losing of life, the lose sound is played by the
+wave system when the game state loses a heart
 ------------------------------------------------------------------------------*/
 void LoseLife(int lose_life) {
-	int i = 0;
-	float total_flicker_time = 5.f;
-	if (i < MAX_HEART_COUNT && heart_stats[0].heartAlive != 0) {
-		while (heart_stats[i].heartAlive == 1) {
-			++i;
-		}
-		if (i == 0) ++i;
-		heart_stats[i - 1].heartAlive = 0;
-		heart_stats[i - 1].alpha = 0;
-	}
-	PlaySound(LOSE, CP_SOUND_GROUP_SFX);
+	SimLoseHearts(GetGameState(), lose_life);
 	// TO DO : Add Lose Life Animation
 }
 
@@ -135,12 +136,7 @@ void LoseLife(int lose_life) {
 play the Game Over sound
 ------------------------------------------------------------------------------*/
 int CheckLoseCondition(void) {
-	// Sum the total of heartAlive in heart_stats to total_life
-	int total_life = 0;
-	for (int i = 0; i < MAX_HEART_COUNT; ++i) {
-		total_life += heart_stats[i].heartAlive;
-	}
-	if (total_life == 0) {
+	if (SimIsGameLost(GetGameState())) {
 		PlaySound(GAMEOVER, CP_SOUND_GROUP_SFX);
 		return 1;
 	}
@@ -157,7 +153,8 @@ after a few seconds
 ------------------------------------------------------------------------------*/
 void DrawLife(void) {
 	for (int i = 0; i < MAX_HEART_COUNT; ++i) {
-		if (heart_stats[i].heartAlive == 1) {
+		// Hearts are lost from the right, so the first few hearts are the ones left
+		if (i < GetGameState()->hearts) {
 			CP_Image_DrawAdvanced(heart_image, heart_stats[i].xpos, heart_stats[i].ypos, (float)IMAGE_HEART_LENGTH * heart_stats[i].size, (float)IMAGE_HEART_LENGTH * heart_stats[i].size, heart_stats[i].alpha, heart_stats[i].rotation);
 		}
 	}
@@ -172,43 +169,18 @@ void RenderHeartText(void) {
 	CP_Font_DrawText(life_text.words, life_text.xpos, life_text.ypos); // Draw text
 }
 
-/*----------------------------------------------------------------------------
-@brief Function for Bezier Curve
-@param Place the tick time here, to have a smoother animation
-------------------------------------------------------------------------------*/
-float BezierCurve(float t) {
-	return t * t * (3.0f - 2.0f * t);
-}
-
-// AnimationLife variables
-static float time_elapsed = 0;
-static int up_tick_marker = 1;
-static int down_tick_marker = 0;
-static float duration = 0.75f; // 0.75 Seconds to loop
+static float duration = 0.75f; // 0.75 Seconds to go up, and as long to come back down
 
 /*----------------------------------------------------------------------------
-@brief Animates the hearts to go up and down
+@brief Starts the hearts going up and down, eased at both ends for a smoother
+animation
 ------------------------------------------------------------------------------*/
 void AnimationLife(void) {
-	float tick = time_elapsed / duration;
-	// To check whether the heart needs to go down or up
-	if (up_tick_marker == 1) time_elapsed += CP_System_GetDt();
-	else if (down_tick_marker == 1) time_elapsed -= CP_System_GetDt();
-
+	float bottom = CP_System_GetWindowWidth() / 22.f;
 	// Animate each heart
 	for (int i = 0; i < MAX_HEART_COUNT; ++i) {
-		heart_stats[i].ypos = CP_Math_LerpFloat(CP_System_GetWindowWidth() / 22.f, (CP_System_GetWindowWidth() / 22.f) - (CP_System_GetWindowWidth() / 22.f) * 0.1f, BezierCurve(tick));
-	}
-	// Check if it should be down ticking or up ticking
-	if (time_elapsed >= duration) {
-		down_tick_marker = 1;
-		up_tick_marker = 0;
+		TweenFloat(&heart_stats[i].ypos, bottom, bottom - bottom * 0.1f, duration, EASE_SMOOTHSTEP, TWEEN_PING_PONG);
 	}
-	else if (time_elapsed <= 0) {
-		up_tick_marker = 1;
-		down_tick_marker = 0;
-	}
-
 }
 
 /*----------------------------------------------------------------------------
@@ -222,13 +194,12 @@ void UpdateLife(void) {
 	RenderHeartText();
 	DrawLife();
 
-	AnimationLife();
 	if (CheckLoseCondition() == 1) YouLoseTitleRender();
 }
 
 /*----------------------------------------------------------------------------
-@brief Clear the heart image that was loaded previously
+@brief Clear the heart image, it is kept by the asset loader
 ------------------------------------------------------------------------------*/
 void ClearHearts(void) {
-	CP_Image_Free(&heart_image);
+	heart_image = NULL;
 }
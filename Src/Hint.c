@@ -0,0 +1,103 @@
+/*!
+@file	  Hint.c
+@date     17/10/2026
+@brief    This source file contains the hint shown when the player presses H on their turn. The solver scores every
+		  placement of the hand at depth 1 (quick enough for a single frame) and the best one is drawn over the grid
+		  until the piece is played. There are 4 functions in this file,
+
+		  HintInit - Called by Gamelevel during its initialization, subscribes the hint to the player's turn.
+		  HintProcessInput - Subscribed to the player update event, works out the hint when H is pressed.
+		  RenderHint - Draws the cells the hinted piece covers, the cell to drop it on and marks the piece in the hand.
+		  ClearHint - Subscribed to the player end event, hides the hint once the board has changed.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#include <stdio.h>			// For the hint text
+
+#include "ColorTable.h"		// For the hint colors
+#include "Grid.h"			// For cell positions
+#include "WaveSystem.h"		// For the game state
+#include "SimSolver.h"		// For finding the best placement
+#include "TPlayer.h"		// For the hand slot positions
+#include "GameLoop.h"		// For subscribing to the player's turn
+#include "Hint.h"
+
+#define HINT_THREAD_COUNT 1		// A depth 1 search is done well within a frame on the game thread, starting threads would cost more
+
+SimSolverPlacement hint;		// The placement shown
+_Bool is_hint_shown;			// If there is a hint to draw for this turn
+
+#pragma region
+void HintProcessInput(void);
+#pragma endregion Forward Declarations
+
+/*______________________________________________________________
+@brief Called by Gamelevel during its initialization, subscribes the hint to the player's turn.
+*/
+void HintInit(void){
+	is_hint_shown = FALSE;
+	SubscribeEvent(PLAYER_UPDATE, HintProcessInput, DEFAULT_PRIORITY);
+	SubscribeEvent(PLAYER_END, ClearHint, DEFAULT_PRIORITY);
+}
+
+/*______________________________________________________________
+@brief Subscribed to the player update event, works out the best placement when H is pressed.
+*/
+void HintProcessInput(void){
+	if (!CP_Input_KeyTriggered(KEY_H)) return;
+
+	SimSolverSettings settings;
+	SimSolverDefaultSettings(&settings);
+	settings.threadCount = HINT_THREAD_COUNT;
+	is_hint_shown = SimSolve(GetGameState(), &settings, &hint, 1) > 0;
+}
+
+/*______________________________________________________________
+@brief Draws the cells the hinted piece covers, a dot on the cell to drop it on, and outlines the piece to
+	   play in the hand with how many times to turn it.
+*/
+void RenderHint(void){
+	if (!is_hint_shown) return;
+
+	SimState* game_state = GetGameState();
+	float cell_size = GetCellSize();
+
+	// Cells covered by the piece, cells off the playing area are left out
+	SimBitboard covered;
+	SimCell cells[TOTAL_XGRID * TOTAL_YGRID];
+	SimGetPieceMask(game_state->hand[hint.move.slot], hint.move.rotation, hint.move.x, hint.move.y, &covered);
+	int cell_count = SimBitboardGetCells(&covered, cells);
+
+	CP_Settings_RectMode(CP_POSITION_CORNER);
+	CP_Settings_StrokeWeight(cell_size * 0.05f);
+	CP_Settings_Stroke(HINT_COLOR);
+	CP_Settings_Fill(HINT_FILL_COLOR);
+	for (int i = 0; i < cell_count; ++i) {
+		CP_Graphics_DrawRect(GridXToPosX(cells[i].x) - cell_size / 2.0f, GridYToPosY(cells[i].y) - cell_size / 2.0f, cell_size, cell_size);
+	}
+
+	// The cell the piece is held by when dropping it
+	CP_Settings_Fill(HINT_COLOR);
+	CP_Graphics_DrawCircle(GridXToPosX(hint.move.x), GridYToPosY(hint.move.y), cell_size * 0.2f);
+
+	// Outline the piece to play in the hand
+	CP_Vector slot_pos = GetHandSlotPosition(hint.move.slot);
+	CP_Settings_NoFill();
+	CP_Graphics_DrawRect(slot_pos.x, slot_pos.y, hand_slot_length, hand_slot_length);
+
+	// How many right clicks to turn it, drawn just above the slot
+	char buffer[25] = { 0 };
+	hint.move.rotation == 0 ? sprintf_s(buffer, 25, "HINT") : sprintf_s(buffer, 25, "HINT: TURN x%d", hint.move.rotation);
+	CP_Settings_Fill(HINT_COLOR);
+	CP_Settings_TextSize(cell_size * 0.25f);
+	CP_Settings_TextAlignment(CP_TEXT_ALIGN_H_LEFT, CP_TEXT_ALIGN_V_BOTTOM);
+	CP_Font_DrawText(buffer, slot_pos.x, slot_pos.y);
+}
+
+/*______________________________________________________________
+@brief Subscribed to the player end event, the hint is only good for the hand and board it was worked out on.
+*/
+void ClearHint(void){
+	is_hint_shown = FALSE;
+}
@@ -6,7 +6,6 @@
 
 @license  Copyright  2022 DigiPen, All rights reserved.
 ________________________________________________________________________________________________________*/
-#include <stdio.h>
 #include <cprocessing.h>
 #include "MainMenu.h"
 #include "Options.h"
@@ -17,6 +16,7 @@ ________________________________________________________________________________
 #include "gamelevel.h"
 #include "Utils.h"
 #include "SoundManager.h"
+#include "AssetLoader.h"
 
 Button startBtn;
 Button settingBtn;
@@ -58,12 +58,14 @@ Timer buttonBlink = {
 #pragma endregion
 
 #pragma region LOGO_SHINE_ANIMATION
-// 13 Frame animation.
-CP_Image logoAnim[13];
-CP_Image logo;
+// 13 Frame animation, in one sprite sheet.
+#define LOGO_FRAMES 13
+SpriteSheet const* logoSheet = NULL;
+// Frame of the sheet drawn as the logo.
+int logoFrame = 0;
 _Bool isShining = FALSE;
 
-int frameLength = sizeof(logoAnim) / sizeof(logoAnim[0]);
+int frameLength = 0;
 int currentAnimFrame = 0;
 
 Timer animIntervalTimer = {
@@ -82,6 +84,7 @@ void InitLogoAnim(void);
 void InitMenuButtons(void);
 void InitSelectPointer(void);
 
+void DrawLogo(void);
 void DrawSelectPointer(void);
 
 void HandleLogoAnim(void);
@@ -99,7 +102,6 @@ void ExitGame(void);
 void MainMenuInit(void) {
 	// Initialize frames of logo animation.
 	InitLogoAnim();
-	logo = logoAnim[0];
 	// Populate buttons with positional, size and text values.
 	InitMenuButtons();
 	// Create select pointer using pixel data.
@@ -109,10 +111,11 @@ void MainMenuInit(void) {
 }
 
 void MainMenuUpdate(void) {
+	// The first menu frame is when the player can first do something.
+	ReportTimeToInteractive();
 	CP_Graphics_ClearBackground(MENU_BLACK);
 
-	// Drawn 25% from top.
-	CP_Image_Draw(logo, GetWindowWidth() / 2, GetWindowHeight() / 4, (float)CP_Image_GetWidth(logo) * GetWidthScale() * .8f, (float)CP_Image_GetHeight(logo) * GetHeightScale() * .8f, 255);
+	DrawLogo();
 
 	// Render UI elements and handling UI interactions.
 	UIManagerUpdate();
@@ -127,29 +130,27 @@ void MainMenuUpdate(void) {
 }
 
 void MainMenuExit(void) {
-	CP_Image_Free(&logo);
-	CP_Image_Free(*&logoAnim);
+	// The logo's sprite sheet is kept by the asset loader for the next visit.
 	CP_Image_Free(&selectPointer);
 	transitionBtn = NULL;
 	FreeUIManager();
 }
 
 void InitLogoAnim(void){
-	// Initalize animation per frame.
-	// Buffer to store converted integer value.
-	char str[3];
-	// Starting file path.
-	char filePath[] = "Assets/LogoAnim/Logo_00.png";
-	// Loop through every frame.
-	for (int i = 0; i < frameLength; ++i){
-		// Converts int to char.
-		sprintf_s(str, 3, "%02d", i);
-		// Rename file path for current frame.
-		filePath[21] = str[0];
-		filePath[22] = str[1];
-		// Cache file path for current frame in animation array.
-		logoAnim[i] = CP_Image_Load(filePath);
-	}
+	// Every frame packed into one image, the same sheet every visit.
+	logoSheet = GetAssetSheet("Assets/LogoAnim/Logo_%02d.png", LOGO_FRAMES);
+	frameLength = logoSheet ? logoSheet->frame_count : 0;
+	// Start from the first frame.
+	logoFrame = 0;
+}
+
+void DrawLogo(void){
+	if (!logoSheet) return;
+	// Part of the sheet the current frame is in.
+	SpriteFrame const* frame = &logoSheet->frames[logoFrame];
+	// Drawn 25% from top.
+	CP_Image_DrawSubImage(logoSheet->image, GetWindowWidth() / 2, GetWindowHeight() / 4, (float)logoSheet->frame_width * GetWidthScale() * .8f, (float)logoSheet->frame_height * GetHeightScale() * .8f,
+		frame->u0, frame->v0, frame->u1, frame->v1, 255);
 }
 
 void HandleLogoAnim(void){
@@ -165,9 +166,9 @@ void HandleLogoAnim(void){
 
 		// Interval between frames.
 		if (frameIntervalTimer.elaspedTime >= frameIntervalTimer.time){
-			// Update logo to anim frame image.
+			// Update logo to anim frame.
 			frameIntervalTimer.elaspedTime = 0;
-			logo = logoAnim[currentAnimFrame++];
+			logoFrame = currentAnimFrame++;
 		}
 		else {
 			// Tick timer.
@@ -209,7 +210,7 @@ void InitMenuButtons(void) {
 
 	TextData textData = {
 	.color = MENU_WHITE,
-	.font = CP_Font_Load("Assets/PressStart2P-Regular.ttf"),
+	.font = GetAssetFont("Assets/PressStart2P-Regular.ttf"),
 	.textSize = 80 * GetHeightScale(),
 	// Text will be drawn on the X Y pos of btn rect (which is top left corner),
 	// So we shift text to top left.
@@ -14,6 +14,7 @@ ________________________________________________________________________________
 #include "UIManager.h"
 #include "MainMenu.h"
 #include "Utils.h"
+#include "AssetLoader.h"
 
 Text settingsTxt;
 Button backBtn;
@@ -114,7 +115,7 @@ void InitSettingsTexts(void){
 	/*==============================Text Settings========================*/
 	TextData baseTextData = {
 		.color = MENU_WHITE,
-		.font = CP_Font_Load("Assets/PressStart2P-Regular.ttf"),
+		.font = GetAssetFont("Assets/PressStart2P-Regular.ttf"),
 		.hAlign = CP_TEXT_ALIGN_H_CENTER,
 		.vAlign = CP_TEXT_ALIGN_V_MIDDLE,
 	};
@@ -203,8 +204,8 @@ void InitSettingsSliders(void){
 	float sliderOffset = GetWindowHeight() / 10;
 
 	// Load and cache images of slider and knob.
-	CP_Image sliderImg = CP_Image_Load("Assets/Slider.png");
-	CP_Image knobImg = CP_Image_Load("Assets/Knob.png");
+	CP_Image sliderImg = GetAssetImage("Assets/Slider.png");
+	CP_Image knobImg = GetAssetImage("Assets/Knob.png");
 
 	// Offset of knob from ends of slider.
 	float knobOffset = (float)CP_Image_GetWidth(sliderImg) / 12 * GetWidthScale();
@@ -266,7 +267,7 @@ void InitSettingsButtons(void){
 
 	TextData backBtnTextData = {
 		.color = MENU_WHITE,
-		.font = CP_Font_Load("Assets/PressStart2P-Regular.ttf"),
+		.font = GetAssetFont("Assets/PressStart2P-Regular.ttf"),
 		.textSize = 70 * GetHeightScale(),
 		.hAlign = CP_TEXT_ALIGN_H_CENTER,
 		.vAlign = CP_TEXT_ALIGN_V_MIDDLE,
@@ -283,8 +284,8 @@ void InitSettingsButtons(void){
 	/*==============================================================*/
 
 	/*=================Window Size Button===========================*/
-	CP_Image windowSizeUpBtn = CP_Image_Load("Assets/WindowSizeUpBtn.png");
-	CP_Image windowSizeDownBtn = CP_Image_Load("Assets/WindowSizeDownBtn.png");
+	CP_Image windowSizeUpBtn = GetAssetImage("Assets/WindowSizeUpBtn.png");
+	CP_Image windowSizeDownBtn = GetAssetImage("Assets/WindowSizeDownBtn.png");
 	float windowSizeBtnOffet = (float)GetWindowHeight() / 4;
 
 	GraphicData windowSizeBtnGraphicData = {
@@ -4,65 +4,268 @@
 @date     18/11/2022
 @brief    This source file for the handling of particles in game
 
+          Particles are stored as one array per field (structure of arrays, ParticleStreams) and only the first
+          liveParticleCount of them are alive, a particle that dies is replaced by the last one. The update moves 4
+          particles at a time with SSE where the compiler targets it, so it costs nothing with no particles and
+          stays a straight run over the arrays with many.
+
+          The arrays are one allocation that doubles when it is full, up to the particle budget. With the budget
+          reached a new particle replaces the oldest decorative one, or the oldest gameplay one if it is gameplay
+          too and there are no decorative ones left, else it is dropped. Every priority keeps its particles in a
+          list from oldest to newest to find them (olderParticle and newerParticle).
+
+          The animations are tables of frames with their length worked out when compiled (PARTICLE_ANIMATION), and
+          the rainbow of the RGB particles is a table of HUE_TABLE_SIZE colors over the particle's life, made the
+          first time a color is used, so drawing a particle is two lookups.
+
 @license  Copyright  2022 DigiPen, All rights reserved.
 ________________________________________________________________________________________________________*/
 
 #include "Particles.h"
+#include <stdlib.h>           //the particles are allocated as they are needed
 #include "Screenshake.h"        
 #include "SoundManager.h"       
 #include "WaveSystem.h"         //for access to enemies
 #include "Grid.h"               //for grid coordinate conversions
 #include "Wizard.h"
-
-//Particle Array. Will use some form of Object Pooling.
-//ParticleCount defined in particles.h, 1001. 
-Particle particleArray[PARTICLECOUNT];
-int particleIndex =0;
+#include "GlyphAtlas.h"         //particles are drawn from the glyph atlas
+#include "Tween.h"              //the lerped particles are moved by tweens
+
+//SSE is always there on x64 and on x86 builds that target it, anywhere else the update is plain C
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define PARTICLE_SIMD 1
+#else
+#define PARTICLE_SIMD 0
+#endif
+
+#define PARTICLE_START_CAPACITY 1024     //Particles there is room for when the first one is made, a multiple of 4
+#define NO_PARTICLE -1
+#define MAGIC_PARTICLE_TRAVEL_TIME 0.4f   //Seconds the player's magic takes to reach the cell the piece was placed on
+
+//The particles, one array per field, all in one allocation. Only the first liveParticleCount are alive.
+typedef struct ParticleStreams{
+    ParticleAnimation const** animation;
+    float* x;
+    float* y;
+    float* xVelocity;
+    float* yVelocity;
+    float* gravity;             //gravityScale*9.81, added to the y velocity every second
+    float* lifeTime;
+    float* timeBeforeActive;
+    float* cachedLifeTime;
+    float* size;
+    CP_Color* color;
+    int* olderParticle;         //The particle of the same priority made before this one, NO_PARTICLE if it is the oldest
+    int* newerParticle;         //The particle of the same priority made after this one, NO_PARTICLE if it is the newest
+    unsigned char* priority;
+    _Bool* isRGB;
+    _Bool* isLoop;
+} ParticleStreams;
+
+ParticleStreams particles;
+void* particleMemory = NULL;
+int liveParticleCount = 0;
+int particleCapacity = 0;       //Always a multiple of 4, so the update never reads past the arrays
+int particleBudget = PARTICLE_BUDGET;
+
+int oldestParticle[PARTICLE_PRIORITY_COUNT] = { NO_PARTICLE, NO_PARTICLE };
+int newestParticle[PARTICLE_PRIORITY_COUNT] = { NO_PARTICLE, NO_PARTICLE };
+ParticlePoolStats poolStats;
 
 Particle lerpedParticleArray[LERPPARTICLECOUNT];
 int lerpParticleIndex = 0;
+Tween lerpedParticleTweens[LERPPARTICLECOUNT][3];   //The x, y and lifetime of each lerped particle
 
 //=========== PARTICLE ANIMATIONS ===========
-char* SparkleAnimString = "x+*\".";
-char* ZombieDeathAnimString = "ZZZZ    ZZZZ    ZZZZ    ZZZNNzznncu*\'`";
-char* LeaperDeathAnimString = "LLLL    LLLL    LLLL    LLL[[ii;;::*\'`";
-char* GraveDeathAnimString = "GGGG    GGGG    GGGG    zznncu*\'`";
-char* BreakerDeathAnimString = "BBBB    BBBB    BBBB    BBB33bbcccu*\'`";
-char* TankDeathAnimString = "TTTT    TTTT    TTTT    TTTYYwwnncu*\'`";
-char* WallDeathAnimString = "XXXX    XXXX    XXXX    XXXvvwwnncu*\'`";
-char* ZombieAnim = "ZzZzZzZzZzZzZzZz";
-char* ZombieSpawnAnimString = "@Oo*\'";
+ParticleAnimation const SparkleAnim = PARTICLE_ANIMATION("x+*\".");
+ParticleAnimation const ZombieDeathAnim = PARTICLE_ANIMATION("ZZZZ    ZZZZ    ZZZZ    ZZZNNzznncu*\'`");
+ParticleAnimation const LeaperDeathAnim = PARTICLE_ANIMATION("LLLL    LLLL    LLLL    LLL[[ii;;::*\'`");
+ParticleAnimation const GraveDeathAnim = PARTICLE_ANIMATION("GGGG    GGGG    GGGG    zznncu*\'`");
+ParticleAnimation const BreakerDeathAnim = PARTICLE_ANIMATION("BBBB    BBBB    BBBB    BBB33bbcccu*\'`");
+ParticleAnimation const TankDeathAnim = PARTICLE_ANIMATION("TTTT    TTTT    TTTT    TTTYYwwnncu*\'`");
+ParticleAnimation const WallDeathAnim = PARTICLE_ANIMATION("XXXX    XXXX    XXXX    XXXvvwwnncu*\'`");
+ParticleAnimation const ZombieAnim = PARTICLE_ANIMATION("ZzZzZzZzZzZzZzZz");
+ParticleAnimation const ZombieSpawnAnim = PARTICLE_ANIMATION("@Oo*\'");
+
+//=========== RAINBOW ===========
+//The colors of LerpedHSLColor over a particle's life for a few starting colors, made when a color is first used.
+//The RGB particles all start from MENU_RED, so it is almost always the first table.
+#define HUE_TABLE_SIZE 256
+#define HUE_TABLE_COUNT 4
+
+typedef struct HueTable{
+    CP_Color start;
+    CP_Color colors[HUE_TABLE_SIZE];    //colors[i] is the color at time step i/(HUE_TABLE_SIZE-1)
+} HueTable;
+
+HueTable hueTables[HUE_TABLE_COUNT];
+int hueTableCount = 0;
+int nextHueTable = 0;       //Once all tables are made, the one made over next
 
 //Particle delay used for the lerped particle
 float particleDelay = 0;
 
+#pragma region
+_Bool GrowParticles(void);
+int EvictParticle(ParticlePriority priority);
+void LinkParticle(int index, ParticlePriority priority);
+void UnlinkParticle(int index);
+void IntegrateParticles(float dt);
+void RemoveParticle(int index);
+void StopLerpedParticle(int slot);
+void QueueParticleFrame(float x, float y, float size, CP_Color color, _Bool isRGB, ParticleAnimation const* animation, float timeStep);
+HueTable const* GetHueTable(CP_Color start);
+#pragma endregion Forward Declarations
+
 //Function that handles creating of particle. Calling this will add the particle to the array
-void CreateParticle(float xPos, float yPos, float lifeTime, float size,float gravityScale, CP_Color color,CP_Vector force,const char* animString,BOOL isRGB,float timeBeforeActive){
+void CreateParticle(float xPos, float yPos, float lifeTime, float size,float gravityScale, CP_Color color,CP_Vector force,ParticleAnimation const* animation,BOOL isRGB,float timeBeforeActive,ParticlePriority priority){
+    //Particles that would never be drawn are not kept
+    if(lifeTime <= 0) return;
+
+    int index;
+    if(liveParticleCount < particleCapacity && liveParticleCount < particleBudget){
+        index = liveParticleCount++;
+    } else if(liveParticleCount < particleBudget && GrowParticles()){
+        index = liveParticleCount++;
+    } else{
+        //Out of budget, an older particle that matters less makes room
+        index = EvictParticle(priority);
+        if(index == NO_PARTICLE){
+            ++poolStats.dropped;
+            return;
+        }
+    }
+    LinkParticle(index,priority);
+    if(liveParticleCount > poolStats.peak) poolStats.peak = liveParticleCount;
+
+    //The force is the velocity, gravity is added to it every frame
+    particles.x[index] = xPos;
+    particles.y[index] = yPos;
+    particles.xVelocity[index] = force.x;
+    particles.yVelocity[index] = force.y;
+    particles.gravity[index] = gravityScale * 9.81f;
+    particles.lifeTime[index] = lifeTime;
+    particles.timeBeforeActive[index] = timeBeforeActive;
+    particles.cachedLifeTime[index] = lifeTime;
+    particles.size[index] = size;
+    particles.color[index] = color;
+    particles.animation[index] = animation;
+    particles.isRGB[index] = isRGB;
+    particles.isLoop[index] = FALSE;
+}
 
-    Particle newParticle = {
-        .x = xPos,
-        .y = yPos,
-        .lifeTime = lifeTime,
-        .cachedLifeTime = lifeTime,
-        .size = size,
-        .gravityScale = gravityScale,
-        .color = color,
-        .xVelocity = 0,
-        .yVelocity = 0,
-        .force = force,
-        .animString = animString,
-        .isRGB = isRGB,
-        .timeBeforeActive = timeBeforeActive,
-        .isLoop = FALSE
-    };
+//Sets the most particles that can be alive at once. Lowering it below what is alive takes effect as they die.
+void SetParticleBudget(int budget){
+    particleBudget = budget < 4 ? 4 : budget;
+}
 
-    //particle%PARTICLECOUNT will loop over to the start of the array
-    particleArray[particleIndex%PARTICLECOUNT] = newParticle;
-    particleIndex++;
+//Returns the counters of the particle pool.
+ParticlePoolStats GetParticlePoolStats(void){
+    ParticlePoolStats stats = poolStats;
+    stats.live = liveParticleCount;
+    stats.capacity = particleCapacity;
+    stats.budget = particleBudget;
+    return stats;
 }
 
-//Adds lerped particle to the particle array for use.
-void CreateLerpedParticle(float xPos, float yPos,float endX,float endY,float lifeTime, float size, const char* animString){
+//Doubles the room for particles, up to the budget. Returns FALSE if there is no more room to be had.
+_Bool GrowParticles(void){
+    int capacity = particleCapacity ? particleCapacity * 2 : PARTICLE_START_CAPACITY;
+    if(capacity > particleBudget) capacity = (particleBudget + 3) & ~3;
+    if(capacity <= particleCapacity) return FALSE;
+
+    //Pointers first then the 4 byte fields then the bytes, so every array is aligned for what is in it
+    size_t count = (size_t)capacity;
+    size_t bytes = count * (sizeof(char*) + 9 * sizeof(float) + sizeof(CP_Color) + 2 * sizeof(int) + 3);
+    unsigned char* memory = malloc(bytes);
+    if(memory == NULL) return FALSE;
+
+    ParticleStreams grown;
+    unsigned char* next = memory;
+    grown.animation = (ParticleAnimation const**)next; next += count * sizeof(char*);
+    grown.x = (float*)next; next += count * sizeof(float);
+    grown.y = (float*)next; next += count * sizeof(float);
+    grown.xVelocity = (float*)next; next += count * sizeof(float);
+    grown.yVelocity = (float*)next; next += count * sizeof(float);
+    grown.gravity = (float*)next; next += count * sizeof(float);
+    grown.lifeTime = (float*)next; next += count * sizeof(float);
+    grown.timeBeforeActive = (float*)next; next += count * sizeof(float);
+    grown.cachedLifeTime = (float*)next; next += count * sizeof(float);
+    grown.size = (float*)next; next += count * sizeof(float);
+    grown.color = (CP_Color*)next; next += count * sizeof(CP_Color);
+    grown.olderParticle = (int*)next; next += count * sizeof(int);
+    grown.newerParticle = (int*)next; next += count * sizeof(int);
+    grown.priority = next; next += count;
+    grown.isRGB = (_Bool*)next; next += count;
+    grown.isLoop = (_Bool*)next;
+
+    //The update reads the last group of 4 whole, so what is past the live particles has to be numbers
+    memset(memory, 0, bytes);
+    if(particleMemory != NULL){
+        size_t live = (size_t)liveParticleCount;
+        memcpy(grown.animation, particles.animation, live * sizeof(ParticleAnimation const*));
+        memcpy(grown.x, particles.x, live * sizeof(float));
+        memcpy(grown.y, particles.y, live * sizeof(float));
+        memcpy(grown.xVelocity, particles.xVelocity, live * sizeof(float));
+        memcpy(grown.yVelocity, particles.yVelocity, live * sizeof(float));
+        memcpy(grown.gravity, particles.gravity, live * sizeof(float));
+        memcpy(grown.lifeTime, particles.lifeTime, live * sizeof(float));
+        memcpy(grown.timeBeforeActive, particles.timeBeforeActive, live * sizeof(float));
+        memcpy(grown.cachedLifeTime, particles.cachedLifeTime, live * sizeof(float));
+        memcpy(grown.size, particles.size, live * sizeof(float));
+        memcpy(grown.color, particles.color, live * sizeof(CP_Color));
+        memcpy(grown.olderParticle, particles.olderParticle, live * sizeof(int));
+        memcpy(grown.newerParticle, particles.newerParticle, live * sizeof(int));
+        memcpy(grown.priority, particles.priority, live);
+        memcpy(grown.isRGB, particles.isRGB, live);
+        memcpy(grown.isLoop, particles.isLoop, live);
+        free(particleMemory);
+    }
+    particleMemory = memory;
+    particles = grown;
+    particleCapacity = capacity;
+    return TRUE;
+}
+
+//Takes out the oldest particle that matters less than or as much as a new one of the priority. Returns where it was for
+//the new one to go, NO_PARTICLE if every particle alive matters more.
+int EvictParticle(ParticlePriority priority){
+    for(int evicted = PARTICLE_DECORATIVE; evicted <= (int)priority; ++evicted){
+        int index = oldestParticle[evicted];
+        if(index == NO_PARTICLE) continue;
+        UnlinkParticle(index);
+        ++poolStats.evicted[evicted];
+        return index;
+    }
+    return NO_PARTICLE;
+}
+
+//Adds the particle as the newest of its priority.
+void LinkParticle(int index, ParticlePriority priority){
+    particles.priority[index] = (unsigned char)priority;
+    particles.olderParticle[index] = newestParticle[priority];
+    particles.newerParticle[index] = NO_PARTICLE;
+    if(newestParticle[priority] != NO_PARTICLE) particles.newerParticle[newestParticle[priority]] = index;
+    else oldestParticle[priority] = index;
+    newestParticle[priority] = index;
+}
+
+//Takes the particle out of the list of its priority.
+void UnlinkParticle(int index){
+    int priority = particles.priority[index];
+    int older = particles.olderParticle[index];
+    int newer = particles.newerParticle[index];
+    if(older != NO_PARTICLE) particles.newerParticle[older] = newer;
+    else oldestParticle[priority] = newer;
+    if(newer != NO_PARTICLE) particles.olderParticle[newer] = older;
+    else newestParticle[priority] = older;
+}
+
+//Adds lerped particle to the particle array for use. Its position and lifetime are tweened, so every lerped particle
+//moves on its own until it dies.
+void CreateLerpedParticle(float xPos, float yPos,float endX,float endY,float lifeTime, float size, ParticleAnimation const* animation){
+    int slot = lerpParticleIndex%LERPPARTICLECOUNT;
     Particle newPartice = {
         .x = xPos,
         .y = yPos,
@@ -76,61 +279,96 @@ void CreateLerpedParticle(float xPos, float yPos,float endX,float endY,float lif
         .xVelocity =endX,
         .yVelocity =endY,
         .force = CP_Vector_Zero(),
-        .animString = animString,
+        .animation = animation,
         .isRGB = TRUE,
         .timeBeforeActive = 0,
         .isLoop = FALSE
     };
-    lerpedParticleArray[lerpParticleIndex%20]=newPartice;
+    //The oldest lerped particle is replaced, its tweens would still be writing to it
+    StopLerpedParticle(slot);
+    lerpedParticleArray[slot]=newPartice;
     lerpParticleIndex++;
-}
 
-//Updates the lerped particles, needs to be called every frame!
-void UpdateLerpParticle(void){
-    //Index-1 because we want the most recent particle
-    Particle* lerpedParticle = &lerpedParticleArray[(lerpParticleIndex-1)%20];
-    if(lerpedParticle->lifeTime >0){
-
-        //Gets frame count and time step by mapping number of frames to particle lifetime using lerp.
-        float elapsedLifeTime = lerpedParticle->cachedLifeTime-lerpedParticle->lifeTime;
-        float timeStep = elapsedLifeTime/lerpedParticle->cachedLifeTime;
-        int totalFrames = (int)strlen(lerpedParticle->animString);
-
-        //For a small hack, I store the endx and endy positions in velocity.
-        lerpedParticle->x = CP_Math_LerpFloat(lerpedParticle->cachedX,lerpedParticle->xVelocity,timeStep);
-        lerpedParticle->y = CP_Math_LerpFloat(lerpedParticle->cachedY,lerpedParticle->yVelocity,timeStep);
+    //For a small hack, I store the endx and endy positions in velocity.
+    Particle* lerpedParticle = &lerpedParticleArray[slot];
+    lerpedParticleTweens[slot][0] = TweenFloat(&lerpedParticle->x,xPos,endX,lifeTime,EASE_LINEAR,TWEEN_ONCE);
+    lerpedParticleTweens[slot][1] = TweenFloat(&lerpedParticle->y,yPos,endY,lifeTime,EASE_LINEAR,TWEEN_ONCE);
+    lerpedParticleTweens[slot][2] = TweenFloat(&lerpedParticle->lifeTime,lifeTime,0.f,lifeTime,EASE_LINEAR,TWEEN_ONCE);
+}
 
-        lerpedParticle->lifeTime-=CP_System_GetDt();
+//Stops the tweens of a lerped particle.
+void StopLerpedParticle(int slot){
+    for(int tween = 0; tween < 3; ++tween){
+        StopTween(lerpedParticleTweens[slot][tween]);
+        lerpedParticleTweens[slot][tween] = TWEEN_NONE;
     }
 }
 
-//Function that updates a given particle. Used in Update effects forloop. Handles particle movement and lifetime.
-void UpdateParticle(Particle* particlePointer){
-
-    //Checks if there's a delay for the particle before it can be shown.     
-    if(particlePointer->timeBeforeActive > 0){
-        particlePointer->timeBeforeActive-=CP_System_GetDt();
-        return;
-    } 
-    if(particlePointer->lifeTime > 0){
-        //Add velocity first THEN add position for SI Euler. 
-        //Doing the other way around is Explicit Euler and inaccurate!
-        particlePointer->xVelocity= particlePointer->force.x;
-        particlePointer->yVelocity= particlePointer->force.y;
-
-        particlePointer->x += particlePointer->xVelocity;
-        particlePointer->y += particlePointer->yVelocity;
-
-        particlePointer->lifeTime -= CP_System_GetDt();
-        particlePointer->force.y += particlePointer->gravityScale * 9.81f*CP_System_GetDt();
-        //If the particle loops, it has infinite lifetime. 
-        if(particlePointer->isLoop && particlePointer->lifeTime <= 0){
-            particlePointer->lifeTime = particlePointer->cachedLifeTime;
-        }
+//Moves every live particle by a frame. Velocity is added to position first THEN gravity to velocity, for SI Euler.
+//Particles waiting for their delay only count it down. 4 particles are done at a time with SSE, the arrays have room
+//past the last live particle so the last 4 can be done whole, what is done to the dead ones there does not matter.
+void IntegrateParticles(float dt){
+    int count = (liveParticleCount + 3) & ~3;
+#if PARTICLE_SIMD
+    __m128 step = _mm_set1_ps(dt);
+    __m128 zero = _mm_setzero_ps();
+    for(int i = 0; i < count; i += 4){
+        __m128 delay = _mm_loadu_ps(&particles.timeBeforeActive[i]);
+        __m128 active = _mm_cmple_ps(delay, zero);
+        __m128 activeStep = _mm_and_ps(active, step);
+        _mm_storeu_ps(&particles.timeBeforeActive[i], _mm_sub_ps(delay, _mm_andnot_ps(active, step)));
+
+        __m128 xVelocity = _mm_loadu_ps(&particles.xVelocity[i]);
+        __m128 yVelocity = _mm_loadu_ps(&particles.yVelocity[i]);
+        _mm_storeu_ps(&particles.x[i], _mm_add_ps(_mm_loadu_ps(&particles.x[i]), _mm_and_ps(active, xVelocity)));
+        _mm_storeu_ps(&particles.y[i], _mm_add_ps(_mm_loadu_ps(&particles.y[i]), _mm_and_ps(active, yVelocity)));
+        _mm_storeu_ps(&particles.lifeTime[i], _mm_sub_ps(_mm_loadu_ps(&particles.lifeTime[i]), activeStep));
+        _mm_storeu_ps(&particles.yVelocity[i], _mm_add_ps(yVelocity, _mm_mul_ps(_mm_loadu_ps(&particles.gravity[i]), activeStep)));
     }
-    else{
-        // catch any errors here
+#else
+    for(int i = 0; i < count; ++i){
+        if(particles.timeBeforeActive[i] > 0){
+            particles.timeBeforeActive[i] -= dt;
+            continue;
+        }
+        particles.x[i] += particles.xVelocity[i];
+        particles.y[i] += particles.yVelocity[i];
+        particles.lifeTime[i] -= dt;
+        particles.yVelocity[i] += particles.gravity[i] * dt;
     }
+#endif
+}
+
+//Takes the particle out, it is replaced by the last live one.
+void RemoveParticle(int index){
+    int last = --liveParticleCount;
+    UnlinkParticle(index);
+    if(index == last) return;
+
+    //The list of the last particle now finds it where it was moved to
+    int priority = particles.priority[last];
+    int older = particles.olderParticle[last];
+    int newer = particles.newerParticle[last];
+    if(older != NO_PARTICLE) particles.newerParticle[older] = index;
+    else oldestParticle[priority] = index;
+    if(newer != NO_PARTICLE) particles.olderParticle[newer] = index;
+    else newestParticle[priority] = index;
+    particles.olderParticle[index] = older;
+    particles.newerParticle[index] = newer;
+    particles.priority[index] = (unsigned char)priority;
+    particles.x[index] = particles.x[last];
+    particles.y[index] = particles.y[last];
+    particles.xVelocity[index] = particles.xVelocity[last];
+    particles.yVelocity[index] = particles.yVelocity[last];
+    particles.gravity[index] = particles.gravity[last];
+    particles.lifeTime[index] = particles.lifeTime[last];
+    particles.timeBeforeActive[index] = particles.timeBeforeActive[last];
+    particles.cachedLifeTime[index] = particles.cachedLifeTime[last];
+    particles.size[index] = particles.size[last];
+    particles.color[index] = particles.color[last];
+    particles.animation[index] = particles.animation[last];
+    particles.isRGB[index] = particles.isRGB[last];
+    particles.isLoop[index] = particles.isLoop[last];
 }
 
 //Spawns a radial particle with variance in angle, force and particle count
@@ -142,25 +380,25 @@ void RadialParticleVaried(float x, float y){
         float randomForceVariance = CP_Random_RangeFloat(1.f,4.f);
         float angle = (float)(360/randomParticleCount)*i+(CP_Random_Gaussian()*2.f);
         CP_Vector forceDirection = CP_Vector_Scale(AngleToVector(angle),randomForceVariance);
-        CreateParticle(x,y,.5f, GetCellSize()/3,1.f, MENU_GRAY, forceDirection,SparkleAnimString,FALSE,0);
+        CreateParticle(x,y,.5f, GetCellSize()/3,1.f, MENU_GRAY, forceDirection,&SparkleAnim,FALSE,0,PARTICLE_DECORATIVE);
     }
 }
 
 //Spawns a radial particle with user defined color
 void RadialParticleColor(float x, float y,int particleCount,float force,CP_Color color){
-    for(short i =0; i<particleCount;++i){
+    for(int i =0; i<particleCount;++i){
         float angle = (float)360/particleCount*i;
         CP_Vector forceDirection = CP_Vector_Scale(AngleToVector(angle),force);
-        CreateParticle(x,y,1.0f,GetCellSize()/3,0.f,color,forceDirection,SparkleAnimString,FALSE,particleDelay);
+        CreateParticle(x,y,1.0f,GetCellSize()/3,0.f,color,forceDirection,&SparkleAnim,FALSE,particleDelay,PARTICLE_DECORATIVE);
     }
 }
 
 //Spawns a radial particle with RGB colors
 void RadialParticleRGB(float x, float y,int particleCount,float force){
-    for(short i =0; i<particleCount;++i){
+    for(int i =0; i<particleCount;++i){
         float angle = (float)360/particleCount*i;
         CP_Vector forceDirection = CP_Vector_Scale(AngleToVector(angle),force);
-        CreateParticle(x,y,1.0f,GetCellSize()/3,0.f,MENU_RED,forceDirection,SparkleAnimString,TRUE,particleDelay);
+        CreateParticle(x,y,1.0f,GetCellSize()/3,0.f,MENU_RED,forceDirection,&SparkleAnim,TRUE,particleDelay,PARTICLE_DECORATIVE);
     }
 }
 
@@ -169,127 +407,174 @@ void ZombieDeathParticle(float x, float y,ZombieType type){
     //Stronger enemies give a bigger screenshake when they die
     switch (type){
     case ZOMBIE:
-        CreateParticle(x,y,1.8f,GetCellSize()/3,0,MENU_RED,CP_Vector_Zero(),ZombieDeathAnimString,FALSE,0);
+        CreateParticle(x,y,1.8f,GetCellSize()/3,0,MENU_RED,CP_Vector_Zero(),&ZombieDeathAnim,FALSE,0,PARTICLE_GAMEPLAY);
         trauma+=0.3f;
         break;
     case LEAPER:
-        CreateParticle(x,y,1.8f,GetCellSize()/3,0,MENU_RED,CP_Vector_Zero(),LeaperDeathAnimString,FALSE,0);
+        CreateParticle(x,y,1.8f,GetCellSize()/3,0,MENU_RED,CP_Vector_Zero(),&LeaperDeathAnim,FALSE,0,PARTICLE_GAMEPLAY);
         trauma+=0.3f;
         break;
     case TANK:
-        CreateParticle(x,y,1.8f,GetCellSize()/3,0,MENU_RED,CP_Vector_Zero(),TankDeathAnimString,FALSE,0);
+        CreateParticle(x,y,1.8f,GetCellSize()/3,0,MENU_RED,CP_Vector_Zero(),&TankDeathAnim,FALSE,0,PARTICLE_GAMEPLAY);
         trauma+=0.5f;
         break;
     case BREAKER:
-        CreateParticle(x,y,1.8f,GetCellSize()/3,0,MENU_RED,CP_Vector_Zero(),BreakerDeathAnimString,FALSE,0);
+        CreateParticle(x,y,1.8f,GetCellSize()/3,0,MENU_RED,CP_Vector_Zero(),&BreakerDeathAnim,FALSE,0,PARTICLE_GAMEPLAY);
         trauma+=0.5f;
         break;
     case GRAVE:
-        CreateParticle(x,y,1.8f,GetCellSize()/3,0,GREEN,CP_Vector_Zero(),GraveDeathAnimString,FALSE,0);
+        CreateParticle(x,y,1.8f,GetCellSize()/3,0,GREEN,CP_Vector_Zero(),&GraveDeathAnim,FALSE,0,PARTICLE_GAMEPLAY);
         trauma+=0.5f;
         break;
     default:
-        CreateParticle(x,y,1.8f,GetCellSize()/3,0,MENU_RED,CP_Vector_Zero(),ZombieDeathAnimString,FALSE,0);
+        CreateParticle(x,y,1.8f,GetCellSize()/3,0,MENU_RED,CP_Vector_Zero(),&ZombieDeathAnim,FALSE,0,PARTICLE_GAMEPLAY);
         break;
     }
 }
 
 //Spawns the spawn particle of zombies.
 void ZombieSpawnParticle(float x, float y){
-    CreateParticle(x,y,0.5f,GetCellSize(),0.1f,MENU_RED,CP_Vector_Zero(),ZombieSpawnAnimString,TRUE,0);
+    CreateParticle(x,y,0.5f,GetCellSize(),0.1f,MENU_RED,CP_Vector_Zero(),&ZombieSpawnAnim,TRUE,0,PARTICLE_GAMEPLAY);
 }
 
 //Shoots a particle from the player to the cell where piece is placed.
 void PlayerMagicParticle(float endX, float endY){
-    CreateLerpedParticle(GetWizardPosition().x,GetWizardPosition().y,endX,endY,particleDelay,GetCellSize(),SparkleAnimString);
+    CreateLerpedParticle(GetWizardPosition().x,GetWizardPosition().y,endX,endY,MAGIC_PARTICLE_TRAVEL_TIME,GetCellSize(),&SparkleAnim);
 }
 
 //Spawns the particle of the zombie moving to the player 
 void ZombieToPlayerParticle(float x,float y){
     CP_Vector dirToPlayer = CP_Vector_Set((CP_System_GetWindowWidth()*0.05f)-x,(GetGridPlayingArea()/2)+GetGridTopBuffer() - y);
     dirToPlayer = CP_Vector_Normalize(dirToPlayer);
-    CreateParticle(x,y,2.f,GetCellSize()/3,0,MENU_RED,dirToPlayer,ZombieAnim,TRUE,0);
+    CreateParticle(x,y,2.f,GetCellSize()/3,0,MENU_RED,dirToPlayer,&ZombieAnim,TRUE,0,PARTICLE_GAMEPLAY);
     trauma+=0.5f;
 }
 
 //Handles the creation of particles with delay
 void CreateParticleEmission(float x, float y,int burstCount, float duration){
-    for(short i=0; i<burstCount; ++i){
+    for(int i=0; i<burstCount; ++i){
             for(short j =0; j<20;++j){
                 float angle = (float)360/20*j;
                 CP_Vector forceDirection = CP_Vector_Scale(AngleToVector(angle),8.f);
-                CreateParticle(x,y,1.0f,GetCellSize()/3,0.f,MENU_RED,forceDirection,SparkleAnimString,TRUE,(duration/(float)burstCount)*i);
+                CreateParticle(x,y,1.0f,GetCellSize()/3,0.f,MENU_RED,forceDirection,&SparkleAnim,TRUE,(duration/(float)burstCount)*i,PARTICLE_DECORATIVE);
             }
     }
 }
 
-//Function that handles the animation and drawing of the particle to screen. Sets the color but not the alignment.
+//Function that handles the animation of the particle, the frame is queued to be drawn from the glyph atlas on the next flush.
 void DrawParticle(Particle* particlePointer){
     if((particlePointer->lifeTime >= 0)&& particlePointer->timeBeforeActive <=0){
-
-        CP_Settings_TextAlignment(CP_TEXT_ALIGN_H_CENTER,CP_TEXT_ALIGN_V_MIDDLE);
-        CP_Settings_TextSize(particlePointer->size);
-        
-        //Gets frame count and time step by mapping number of frames to particle lifetime using lerp.
+        //Gets time step by mapping the particle lifetime to 0-1.
         float elapsedLifeTime = particlePointer->cachedLifeTime-particlePointer->lifeTime;
         float timeStep = elapsedLifeTime/particlePointer->cachedLifeTime;
-        int totalFrames = (int)strlen(particlePointer->animString);
-        int frameCount = (int)CP_Math_LerpFloat(0,(float)(totalFrames),timeStep);
-
-        //Note : Lerp 2 values at one time for Razer RGB. (for future reference)
-        
-        if(particlePointer->isRGB){
-            CP_Settings_Fill(LerpedHSLColor(particlePointer->color,timeStep));
-        } else{
-            CP_Settings_Fill(particlePointer->color);
-        }
-        //Char array size of 2, where 0 is the frame and 1 is '\0'
-        char singleCharFrame[2];
-        //memcpy is better than array=array.
-        memcpy(&singleCharFrame,&particlePointer->animString[frameCount],1);
-        singleCharFrame[1]='\0';    //set the null char if not drawtext will have undefined behaviour reading indefinitely
-        CP_Font_DrawText(*&singleCharFrame, particlePointer->x, particlePointer->y);
+        QueueParticleFrame(particlePointer->x,particlePointer->y,particlePointer->size,particlePointer->color,particlePointer->isRGB,particlePointer->animation,timeStep);
     }
 }
 
+//Queues the frame of the animation at timeStep (0-1 of the particle's life) to be drawn from the glyph atlas.
+void QueueParticleFrame(float x, float y, float size, CP_Color color, _Bool isRGB, ParticleAnimation const* animation, float timeStep){
+    //Gets frame by mapping number of frames to the time step.
+    int frame = (int)(animation->frameCount * timeStep);
+
+    //Note : Lerp 2 values at one time for Razer RGB. (for future reference)
+
+    //At the very end of its life the frame is the '\0', which draws nothing
+    if(isRGB) color = LerpedHSLColor(color,timeStep);
+    QueueGlyph(LAYER_PARTICLES,animation->frames[frame],x,y,size,color);
+}
+
 //Function that is required to be called to update all particles. If particles don't work, check that this is in update loop.
 void UpdateEffects(void){
     // if(CP_Input_MouseTriggered(1)){
     //     // RadialParticleVaried(CP_Input_GetMouseX(),CP_Input_GetMouseY());
     //     PlayerMagicParticle(CP_Input_GetMouseX(),CP_Input_GetMouseY());
     // }
-    //Main loop for handling particle movement and rendering.
-    //Important to loop through the whole array because the index wraps around.
-    for(short i =0; i< PARTICLECOUNT; ++i){
-        if(particleArray[i].lifeTime <=0) continue; //an attempt at optimisation to skip dead particles.
-        UpdateParticle(&particleArray[i]);
-        DrawParticle(&particleArray[i]);
-    }
-    //Loops through the lerp particles
-    if(lerpParticleIndex >0){
-        for(short i =0; i<20;++i){
-            if(lerpedParticleArray[i].lifeTime <=0) continue;
-            UpdateLerpParticle();
-            DrawParticle(&lerpedParticleArray[i]);
+    //The time step is the same for every particle this frame
+    float dt = CP_System_GetDt();
+    IntegrateParticles(dt);
+
+    //Draws the live particles and takes out the ones that died. A particle that is removed is replaced by the last one,
+    //which has not been looked at yet, so the same index is looked at again.
+    for(int i = 0; i < liveParticleCount; ){
+        if(particles.lifeTime[i] <= 0 && particles.isLoop[i]){
+            //If the particle loops, it has infinite lifetime.
+            particles.lifeTime[i] = particles.cachedLifeTime[i];
+        }
+        if(particles.lifeTime[i] >= 0 && particles.timeBeforeActive[i] <= 0){
+            float timeStep = (particles.cachedLifeTime[i] - particles.lifeTime[i]) / particles.cachedLifeTime[i];
+            QueueParticleFrame(particles.x[i],particles.y[i],particles.size[i],particles.color[i],particles.isRGB[i],particles.animation[i],timeStep);
         }
+        if(particles.lifeTime[i] <= 0){
+            RemoveParticle(i);
+            continue;
+        }
+        ++i;
+    }
+    //Draws the lerp particles, the tweens have moved them already
+    for(int i =0; i<LERPPARTICLECOUNT;++i){
+        if(lerpedParticleArray[i].lifeTime <=0) continue;
+        DrawParticle(&lerpedParticleArray[i]);
     }
+    //Draws all the particles queued above
+    RenderQueueFlush();
 }
 
 //Resets the particles and their indexes. Used when exiting game to menu
 void ResetParticles(void){
-    particleIndex =0;
+    //The room for particles is kept for the next game, FreeParticles gives it back
+    liveParticleCount =0;
+    for(int priority = 0; priority < PARTICLE_PRIORITY_COUNT; ++priority){
+        oldestParticle[priority] = NO_PARTICLE;
+        newestParticle[priority] = NO_PARTICLE;
+    }
+    memset(&poolStats,0,sizeof(poolStats));
     lerpParticleIndex =0;
-    memset(particleArray,0,sizeof(Particle)*(PARTICLECOUNT));
+    for(int slot = 0; slot < LERPPARTICLECOUNT; ++slot) StopLerpedParticle(slot);
 	memset(lerpedParticleArray,0,sizeof(Particle)*LERPPARTICLECOUNT);
 }
 
-//Retuns color from lerping of hues to make rainbow color effect.
+//Resets the particles and frees the room for them. Used when exiting the game level, the next particle allocates again
+void FreeParticles(void){
+    ResetParticles();
+    free(particleMemory);
+    particleMemory = NULL;
+    memset(&particles,0,sizeof(particles));
+    particleCapacity = 0;
+}
+
+//Retuns color from lerping of hues to make rainbow color effect, looked up from the hue table of the color.
 //Check if this works if color is white. I think it doesn't
 CP_Color LerpedHSLColor(CP_Color color,float timeStep){
-    CP_ColorHSL startColor = CP_ColorHSL_FromColor(color);
+    HueTable const* table = GetHueTable(color);
+    int index = (int)(timeStep * (HUE_TABLE_SIZE - 1) + 0.5f);
+    if(index < 0) index = 0;
+    if(index > HUE_TABLE_SIZE - 1) index = HUE_TABLE_SIZE - 1;
+    return table->colors[index];
+}
+
+//Returns the hue table starting from the color, making it if it is not there. The colors are lerped the same way the
+//rainbow always was, from the color to its hue-1 in HSL.
+HueTable const* GetHueTable(CP_Color start){
+    for(int i = 0; i < hueTableCount; ++i){
+        CP_Color tableStart = hueTables[i].start;
+        if(tableStart.r == start.r && tableStart.g == start.g && tableStart.b == start.b && tableStart.a == start.a) return &hueTables[i];
+    }
+
+    HueTable* table;
+    if(hueTableCount < HUE_TABLE_COUNT){
+        table = &hueTables[hueTableCount++];
+    } else{
+        table = &hueTables[nextHueTable];
+        nextHueTable = (nextHueTable + 1) % HUE_TABLE_COUNT;
+    }
+    table->start = start;
+    CP_ColorHSL startColor = CP_ColorHSL_FromColor(start);
     CP_ColorHSL endColor = CP_ColorHSL_Create(startColor.h-1,startColor.s,startColor.l,startColor.a);
-    CP_ColorHSL HSLColor = CP_ColorHSL_Lerp(startColor,endColor,timeStep);
-    return CP_Color_FromColorHSL(HSLColor);
+    for(int i = 0; i < HUE_TABLE_SIZE; ++i){
+        CP_ColorHSL HSLColor = CP_ColorHSL_Lerp(startColor,endColor,(float)i / (HUE_TABLE_SIZE - 1));
+        table->colors[i] = CP_Color_FromColorHSL(HSLColor);
+    }
+    return table;
 }
 
 //Helper math function to convert angles to vector.
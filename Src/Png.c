@@ -0,0 +1,411 @@
+/*!
+@file	  Png.c
+@date     17/10/2026
+@brief    This source file contains the png decoder, see Png.h. The IDAT chunks are put together and inflated into the
+		  filtered rows, which are unfiltered in place and then turned into RGBA. Nothing here touches CProcessing, so
+		  it is safe to call from any thread. There are 9 functions in this file,
+
+		  PngDecode - Turns the bytes of a png file into RGBA pixels.
+
+		  ReadBigEndian - Reads a 4 byte number the way png stores them.
+		  ReadBits - Reads bits from the deflate stream, lowest bit first.
+		  BuildHuffman - Makes a huffman table from the code lengths.
+		  DecodeSymbol - Reads one huffman coded symbol.
+		  InflateBlock - Inflates one compressed block with its tables.
+		  Inflate - Inflates a zlib stream into a buffer of a known size.
+		  Paeth - The paeth filter's guess of a byte.
+		  Unfilter - Undoes the filter of every row.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "Png.h"
+
+#ifndef TRUE
+#define TRUE 1
+#endif
+#ifndef FALSE
+#define FALSE 0
+#endif
+
+#define HUFFMAN_MAX_BITS 15
+#define HUFFMAN_MAX_SYMBOLS 288
+
+/*______________________________________________________________
+@brief A canonical huffman table, how many codes there are of each length and the symbols in code order.
+*/
+typedef struct Huffman {
+	unsigned short counts[HUFFMAN_MAX_BITS + 1];
+	unsigned short symbols[HUFFMAN_MAX_SYMBOLS];
+} Huffman;
+
+/*______________________________________________________________
+@brief Where the inflate is in its input and output.
+*/
+typedef struct InflateState {
+	unsigned char const* in;
+	size_t in_size;
+	size_t in_pos;
+	unsigned int bit_buffer;
+	int bit_count;
+	unsigned char* out;
+	size_t out_size;
+	size_t out_pos;
+	_Bool failed;		// Ran out of input or output, or a bad code
+} InflateState;
+
+// Lengths and distances of the length and distance symbols, with how many extra bits are read after them
+static unsigned short const length_base[29] = { 3,4,5,6,7,8,9,10,11,13,15,17,19,23,27,31,35,43,51,59,67,83,99,115,131,163,195,227,258 };
+static unsigned char const length_extra[29] = { 0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0 };
+static unsigned short const distance_base[30] = { 1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577 };
+static unsigned char const distance_extra[30] = { 0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13 };
+// The order the code length code lengths are stored in
+static unsigned char const code_length_order[19] = { 16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15 };
+
+#pragma region
+unsigned int ReadBigEndian(unsigned char const* bytes);
+unsigned int ReadBits(InflateState* state, int count);
+void BuildHuffman(Huffman* huffman, unsigned char const* lengths, int count);
+int DecodeSymbol(InflateState* state, Huffman const* huffman);
+void InflateBlock(InflateState* state, Huffman const* lengths, Huffman const* distances);
+_Bool Inflate(unsigned char const* in, size_t in_size, unsigned char* out, size_t out_size);
+unsigned char Paeth(int left, int up, int up_left);
+_Bool Unfilter(unsigned char* rows, int width, int height, int bytes_per_pixel);
+#pragma endregion Forward Declarations
+
+unsigned char* PngDecode(unsigned char const* data, size_t size, int* width, int* height){
+	static unsigned char const signature[8] = { 0x89,'P','N','G','\r','\n',0x1A,'\n' };
+	if (size < 33 || memcmp(data, signature, 8) != 0 || memcmp(data + 12, "IHDR", 4) != 0) return NULL;
+
+	int image_width = (int)ReadBigEndian(data + 16);
+	int image_height = (int)ReadBigEndian(data + 20);
+	int bit_depth = data[24], color_type = data[25], interlace = data[28];
+	if (image_width <= 0 || image_height <= 0 || image_width > 16384 || image_height > 16384) return NULL;
+	if (bit_depth != 8 || interlace != 0) return NULL;
+
+	int channels;
+	switch (color_type) {
+	case 0: channels = 1; break;	// Gray
+	case 2: channels = 3; break;	// RGB
+	case 3: channels = 1; break;	// Palette
+	case 4: channels = 2; break;	// Gray and alpha
+	case 6: channels = 4; break;	// RGBA
+	default: return NULL;
+	}
+
+	// Palette entries are opaque unless the tRNS chunk says otherwise
+	unsigned char palette[256][4];
+	memset(palette, 0xFF, sizeof(palette));
+	int palette_count = 0;
+
+	// The IDAT chunks are one zlib stream split up, they are put back together first
+	size_t compressed_size = 0;
+	for (size_t pos = 8; pos + 12 <= size; ) {
+		size_t length = ReadBigEndian(data + pos);
+		if (length > size - pos - 12) return NULL;
+		if (memcmp(data + pos + 4, "IDAT", 4) == 0) compressed_size += length;
+		if (memcmp(data + pos + 4, "IEND", 4) == 0) break;
+		pos += length + 12;
+	}
+	unsigned char* compressed = malloc(compressed_size ? compressed_size : 1);
+	if (!compressed) return NULL;
+	compressed_size = 0;
+	for (size_t pos = 8; pos + 12 <= size; ) {
+		size_t length = ReadBigEndian(data + pos);
+		unsigned char const* chunk = data + pos + 8;
+		if (memcmp(data + pos + 4, "IDAT", 4) == 0) {
+			memcpy(compressed + compressed_size, chunk, length);
+			compressed_size += length;
+		}
+		else if (memcmp(data + pos + 4, "PLTE", 4) == 0) {
+			palette_count = (int)(length / 3 > 256 ? 256 : length / 3);
+			for (int entry = 0; entry < palette_count; ++entry) memcpy(palette[entry], chunk + entry * 3, 3);
+		}
+		else if (memcmp(data + pos + 4, "tRNS", 4) == 0 && color_type == 3) {
+			for (size_t entry = 0; entry < length && entry < 256; ++entry) palette[entry][3] = chunk[entry];
+		}
+		else if (memcmp(data + pos + 4, "IEND", 4) == 0) {
+			break;
+		}
+		pos += length + 12;
+	}
+	if (color_type == 3 && palette_count == 0) {
+		free(compressed);
+		return NULL;
+	}
+
+	// Every row starts with its filter byte
+	size_t row_size = (size_t)image_width * channels + 1;
+	size_t filtered_size = row_size * image_height;
+	unsigned char* rows = malloc(filtered_size);
+	unsigned char* pixels = malloc((size_t)image_width * image_height * 4);
+	_Bool decoded = rows && pixels && Inflate(compressed, compressed_size, rows, filtered_size) && Unfilter(rows, image_width, image_height, channels);
+	free(compressed);
+	if (!decoded) {
+		free(rows);
+		free(pixels);
+		return NULL;
+	}
+
+	for (int y = 0; y < image_height; ++y) {
+		unsigned char const* row = rows + row_size * y + 1;
+		unsigned char* pixel = pixels + (size_t)image_width * 4 * y;
+		if (color_type == 6) {
+			memcpy(pixel, row, (size_t)image_width * 4);
+			continue;
+		}
+		for (int x = 0; x < image_width; ++x, pixel += 4, row += channels) {
+			switch (color_type) {
+			case 0:
+				pixel[0] = pixel[1] = pixel[2] = row[0];
+				pixel[3] = 0xFF;
+				break;
+			case 2:
+				memcpy(pixel, row, 3);
+				pixel[3] = 0xFF;
+				break;
+			case 3:
+				memcpy(pixel, palette[row[0]], 4);
+				break;
+			case 4:
+				pixel[0] = pixel[1] = pixel[2] = row[0];
+				pixel[3] = row[1];
+				break;
+			default:
+				break;
+			}
+		}
+	}
+	free(rows);
+
+	*width = image_width;
+	*height = image_height;
+	return pixels;
+}
+
+unsigned int ReadBigEndian(unsigned char const* bytes){
+	return (unsigned int)bytes[0] << 24 | (unsigned int)bytes[1] << 16 | (unsigned int)bytes[2] << 8 | bytes[3];
+}
+
+unsigned int ReadBits(InflateState* state, int count){
+	while (state->bit_count < count) {
+		if (state->in_pos == state->in_size) {
+			state->failed = TRUE;
+			return 0;
+		}
+		state->bit_buffer |= (unsigned int)state->in[state->in_pos++] << state->bit_count;
+		state->bit_count += 8;
+	}
+	unsigned int bits = state->bit_buffer & ((1u << count) - 1);
+	state->bit_buffer >>= count;
+	state->bit_count -= count;
+	return bits;
+}
+
+void BuildHuffman(Huffman* huffman, unsigned char const* lengths, int count){
+	memset(huffman->counts, 0, sizeof(huffman->counts));
+	for (int symbol = 0; symbol < count; ++symbol) ++huffman->counts[lengths[symbol]];
+	huffman->counts[0] = 0;
+
+	// Where the codes of each length start in symbols
+	unsigned short offsets[HUFFMAN_MAX_BITS + 1];
+	offsets[1] = 0;
+	for (int bits = 1; bits < HUFFMAN_MAX_BITS; ++bits) offsets[bits + 1] = offsets[bits] + huffman->counts[bits];
+	for (int symbol = 0; symbol < count; ++symbol) {
+		if (lengths[symbol]) huffman->symbols[offsets[lengths[symbol]]++] = (unsigned short)symbol;
+	}
+}
+
+int DecodeSymbol(InflateState* state, Huffman const* huffman){
+	// Codes of a length are consecutive, so the code read so far is checked against the range of each length
+	int code = 0, first = 0, index = 0;
+	for (int bits = 1; bits <= HUFFMAN_MAX_BITS; ++bits) {
+		code |= (int)ReadBits(state, 1);
+		int count = huffman->counts[bits];
+		if (code - first < count) return huffman->symbols[index + code - first];
+		index += count;
+		first = (first + count) << 1;
+		code <<= 1;
+	}
+	state->failed = TRUE;
+	return -1;
+}
+
+void InflateBlock(InflateState* state, Huffman const* lengths, Huffman const* distances){
+	while (!state->failed) {
+		int symbol = DecodeSymbol(state, lengths);
+		if (symbol < 256) {
+			if (symbol < 0 || state->out_pos == state->out_size) {
+				state->failed = TRUE;
+				return;
+			}
+			state->out[state->out_pos++] = (unsigned char)symbol;
+			continue;
+		}
+		if (symbol == 256) return;
+
+		symbol -= 257;
+		if (symbol >= 29) {
+			state->failed = TRUE;
+			return;
+		}
+		size_t length = length_base[symbol] + ReadBits(state, length_extra[symbol]);
+		int distance_symbol = DecodeSymbol(state, distances);
+		if (distance_symbol < 0 || distance_symbol >= 30) {
+			state->failed = TRUE;
+			return;
+		}
+		size_t distance = distance_base[distance_symbol] + ReadBits(state, distance_extra[distance_symbol]);
+		if (distance > state->out_pos || length > state->out_size - state->out_pos) {
+			state->failed = TRUE;
+			return;
+		}
+		// A copy overlapping what it writes repeats the last distance bytes. Everything from where it copies from is
+		// that repeat, so each copy can be as long as everything copied so far, doubling each time.
+		unsigned char* out = state->out + state->out_pos;
+		unsigned char const* from = out - distance;
+		state->out_pos += length;
+		for (size_t span = distance; length > 0; ) {
+			size_t chunk = span < length ? span : length;
+			memcpy(out, from, chunk);
+			out += chunk;
+			length -= chunk;
+			span += chunk;
+		}
+	}
+}
+
+_Bool Inflate(unsigned char const* in, size_t in_size, unsigned char* out, size_t out_size){
+	// The zlib header, deflate with a window of at most 32k and no preset dictionary
+	if (in_size < 2 || (in[0] & 0x0F) != 8 || (in[0] >> 4) > 7 || (in[0] << 8 | in[1]) % 31 != 0 || (in[1] & 0x20)) return FALSE;
+
+	InflateState state = { in, in_size, 2, 0, 0, out, out_size, 0, FALSE };
+	Huffman lengths, distances;
+	unsigned char code_lengths[HUFFMAN_MAX_SYMBOLS + 32];
+
+	_Bool last_block = FALSE;
+	while (!last_block && !state.failed) {
+		last_block = (_Bool)ReadBits(&state, 1);
+		unsigned int type = ReadBits(&state, 2);
+		if (type == 0) {
+			// Stored, starts on a byte with its length and the length's complement
+			state.bit_buffer = 0;
+			state.bit_count = 0;
+			if (state.in_size - state.in_pos < 4) return FALSE;
+			size_t length = state.in[state.in_pos] | state.in[state.in_pos + 1] << 8;
+			size_t complement = state.in[state.in_pos + 2] | state.in[state.in_pos + 3] << 8;
+			state.in_pos += 4;
+			if (length != (~complement & 0xFFFF) || length > state.in_size - state.in_pos || length > state.out_size - state.out_pos) return FALSE;
+			memcpy(state.out + state.out_pos, state.in + state.in_pos, length);
+			state.in_pos += length;
+			state.out_pos += length;
+		}
+		else if (type == 1) {
+			// Fixed tables
+			int symbol = 0;
+			for (; symbol < 144; ++symbol) code_lengths[symbol] = 8;
+			for (; symbol < 256; ++symbol) code_lengths[symbol] = 9;
+			for (; symbol < 280; ++symbol) code_lengths[symbol] = 7;
+			for (; symbol < 288; ++symbol) code_lengths[symbol] = 8;
+			BuildHuffman(&lengths, code_lengths, 288);
+			for (symbol = 0; symbol < 30; ++symbol) code_lengths[symbol] = 5;
+			BuildHuffman(&distances, code_lengths, 30);
+			InflateBlock(&state, &lengths, &distances);
+		}
+		else if (type == 2) {
+			// Tables stored in the block, their code lengths are huffman coded too
+			int length_count = (int)ReadBits(&state, 5) + 257;
+			int distance_count = (int)ReadBits(&state, 5) + 1;
+			int code_length_count = (int)ReadBits(&state, 4) + 4;
+			if (length_count > 286 || distance_count > 30) return FALSE;
+
+			unsigned char code_length_lengths[19] = { 0 };
+			for (int index = 0; index < code_length_count; ++index) code_length_lengths[code_length_order[index]] = (unsigned char)ReadBits(&state, 3);
+			Huffman code_length_huffman;
+			BuildHuffman(&code_length_huffman, code_length_lengths, 19);
+
+			int index = 0;
+			while (index < length_count + distance_count && !state.failed) {
+				int symbol = DecodeSymbol(&state, &code_length_huffman);
+				if (symbol < 0) return FALSE;
+				if (symbol < 16) {
+					code_lengths[index++] = (unsigned char)symbol;
+					continue;
+				}
+				// Repeats of the last length, or of zero
+				unsigned char repeated = 0;
+				int repeat;
+				if (symbol == 16) {
+					if (index == 0) return FALSE;
+					repeated = code_lengths[index - 1];
+					repeat = 3 + (int)ReadBits(&state, 2);
+				}
+				else if (symbol == 17) {
+					repeat = 3 + (int)ReadBits(&state, 3);
+				}
+				else {
+					repeat = 11 + (int)ReadBits(&state, 7);
+				}
+				if (index + repeat > length_count + distance_count) return FALSE;
+				while (repeat--) code_lengths[index++] = repeated;
+			}
+			if (state.failed || code_lengths[256] == 0) return FALSE;
+			BuildHuffman(&lengths, code_lengths, length_count);
+			BuildHuffman(&distances, code_lengths + length_count, distance_count);
+			InflateBlock(&state, &lengths, &distances);
+		}
+		else {
+			return FALSE;
+		}
+	}
+	return !state.failed && state.out_pos == state.out_size;
+}
+
+unsigned char Paeth(int left, int up, int up_left){
+	int to_left = abs(up - up_left), to_up = abs(left - up_left), to_up_left = abs(left + up - 2 * up_left);
+	if (to_left <= to_up && to_left <= to_up_left) return (unsigned char)left;
+	return (unsigned char)(to_up <= to_up_left ? up : up_left);
+}
+
+_Bool Unfilter(unsigned char* rows, int width, int height, int bytes_per_pixel){
+	size_t row_size = (size_t)width * bytes_per_pixel;
+	size_t bpp = (size_t)bytes_per_pixel;
+	// The row above the first is all zeros, which makes up the same as none and paeth the same as left
+	unsigned char* zeros = calloc(row_size, 1);
+	if (!zeros) return FALSE;
+	unsigned char const* up = zeros;
+
+	_Bool unfiltered = TRUE;
+	for (int y = 0; y < height && unfiltered; ++y) {
+		unsigned char* row = rows + (row_size + 1) * y;
+		unsigned char filter = *row++;
+		// A loop for each filter, the first pixel has nothing to its left
+		size_t x;
+		switch (filter) {
+		case 0:
+			break;
+		case 1:
+			for (x = bpp; x < row_size; ++x) row[x] = (unsigned char)(row[x] + row[x - bpp]);
+			break;
+		case 2:
+			for (x = 0; x < row_size; ++x) row[x] = (unsigned char)(row[x] + up[x]);
+			break;
+		case 3:
+			for (x = 0; x < bpp; ++x) row[x] = (unsigned char)(row[x] + (up[x] >> 1));
+			for (; x < row_size; ++x) row[x] = (unsigned char)(row[x] + ((row[x - bpp] + up[x]) >> 1));
+			break;
+		case 4:
+			for (x = 0; x < bpp; ++x) row[x] = (unsigned char)(row[x] + up[x]);
+			for (; x < row_size; ++x) row[x] = (unsigned char)(row[x] + Paeth(row[x - bpp], up[x], up[x - bpp]));
+			break;
+		default:
+			unfiltered = FALSE;
+			break;
+		}
+		up = row;
+	}
+	free(zeros);
+	return unfiltered;
+}
@@ -0,0 +1,241 @@
+/*!
+@file	  Profiler.c
+@date     17/10/2026
+@brief    This source file contains the frame profiler, see Profiler.h. Zones are timed with QueryPerformanceCounter on
+		  windows and the monotonic clock everywhere else.
+
+		  Trace file layout (Chrome trace event format), one complete ("X") event per zone, times in microseconds:
+		  {"traceEvents":[{"name":"Grid","ph":"X","ts":16.7,"dur":0.2,"pid":1,"tid":1}, ...]}
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Profiler.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#define MAX_PROFILE_DEPTH 32		// Zones that can be started inside each other
+
+/*______________________________________________________________
+@brief A zone that has been started and not ended yet.
+*/
+typedef struct OpenZone {
+	long long start;
+	ProfileZone zone;
+} OpenZone;
+
+/*______________________________________________________________
+@brief A zone that has ended, kept for the trace.
+*/
+typedef struct TraceEvent {
+	long long start;
+	long long duration;
+	ProfileZone zone;
+} TraceEvent;
+
+static char const* const zone_names[PROFILE_ZONE_COUNT] = {
+	"Frame", "Tweens", "CameraShake", "Grid", "Enemies", "GameLoop", "Effects", "Hand", "Hint", "WaveText", "MouseIcon",
+	"EnemyInfo", "Wizard", "Life", "WinCheck", "Clear",
+	"PLAYER_START", "PLAYER_UPDATE", "PLAYER_END", "ZOMBIE_START", "ZOMBIE_UPDATE", "ZOMBIE_END"
+};
+
+_Bool is_profiling = 0;
+long long ticks_per_second = 0;
+long long trace_origin = 0;					// Ticks when the profiler was reset, the trace starts at 0 from there
+
+OpenZone open_zones[MAX_PROFILE_DEPTH];
+int open_zone_count = 0;
+int skipped_zone_count = 0;					// Zones started past MAX_PROFILE_DEPTH, their ends are skipped too
+
+long long frame_ticks[PROFILE_ZONE_COUNT];	// Time in each zone this frame
+_Bool zone_entered[PROFILE_ZONE_COUNT];		// If the zone was entered this frame
+
+float zone_history[PROFILE_ZONE_COUNT][PROFILE_HISTORY];	// Milliseconds of the last frames each zone was entered in
+int history_count[PROFILE_ZONE_COUNT];
+int history_next[PROFILE_ZONE_COUNT];
+
+TraceEvent* trace = NULL;					// Ring of the last PROFILE_TRACE_SIZE zones, allocated when first enabled
+int trace_count = 0;
+int trace_next = 0;
+
+#pragma region
+static long long GetTicks(void);
+static int CompareFloats(void const* a, void const* b);
+static FILE* OpenFile(char const* path, char const* mode);
+#pragma endregion Forward Declarations
+
+void ProfilerSetEnabled(_Bool enabled) {
+	if (enabled && !is_profiling) {
+#ifdef _WIN32
+		LARGE_INTEGER frequency;
+		QueryPerformanceFrequency(&frequency);
+		ticks_per_second = frequency.QuadPart;
+#else
+		ticks_per_second = 1000000000LL;
+#endif
+		// Without the memory for it there is no trace, the stats still work
+		if (trace == NULL) trace = malloc(sizeof(TraceEvent) * PROFILE_TRACE_SIZE);
+		ProfilerReset();
+	}
+	is_profiling = enabled;
+}
+
+_Bool ProfilerIsEnabled(void) {
+	return is_profiling;
+}
+
+void ProfilerReset(void) {
+	open_zone_count = 0;
+	skipped_zone_count = 0;
+	memset(frame_ticks, 0, sizeof(frame_ticks));
+	memset(zone_entered, 0, sizeof(zone_entered));
+	memset(history_count, 0, sizeof(history_count));
+	memset(history_next, 0, sizeof(history_next));
+	trace_count = 0;
+	trace_next = 0;
+	trace_origin = GetTicks();
+}
+
+void ProfilerBeginFrame(void) {
+	if (!is_profiling) return;
+	// Zones left open by the last frame are dropped, they would never end
+	open_zone_count = 0;
+	skipped_zone_count = 0;
+	memset(frame_ticks, 0, sizeof(frame_ticks));
+	memset(zone_entered, 0, sizeof(zone_entered));
+	ProfilerBegin(PROFILE_FRAME);
+}
+
+void ProfilerEndFrame(void) {
+	if (!is_profiling) return;
+	ProfilerEnd(PROFILE_FRAME);
+
+	float ms_per_tick = 1000.0f / (float)ticks_per_second;
+	for (int zone = 0; zone < PROFILE_ZONE_COUNT; ++zone) {
+		if (!zone_entered[zone]) continue;
+		zone_history[zone][history_next[zone]] = (float)frame_ticks[zone] * ms_per_tick;
+		history_next[zone] = (history_next[zone] + 1) % PROFILE_HISTORY;
+		if (history_count[zone] < PROFILE_HISTORY) ++history_count[zone];
+	}
+}
+
+void ProfilerBegin(ProfileZone zone) {
+	if (!is_profiling) return;
+	if (open_zone_count == MAX_PROFILE_DEPTH) {
+		++skipped_zone_count;
+		return;
+	}
+	open_zones[open_zone_count].zone = zone;
+	open_zones[open_zone_count].start = GetTicks();
+	++open_zone_count;
+}
+
+void ProfilerEnd(ProfileZone zone) {
+	if (!is_profiling) return;
+	long long end = GetTicks();
+	if (skipped_zone_count > 0) {
+		--skipped_zone_count;
+		return;
+	}
+	// An end that does not match the last begin means the pairs are wrong somewhere, the zone is not counted
+	if (open_zone_count == 0 || open_zones[open_zone_count - 1].zone != zone) return;
+
+	OpenZone const* open = &open_zones[--open_zone_count];
+	frame_ticks[zone] += end - open->start;
+	zone_entered[zone] = 1;
+
+	if (trace == NULL) return;
+	TraceEvent* event = &trace[trace_next];
+	event->start = open->start;
+	event->duration = end - open->start;
+	event->zone = zone;
+	trace_next = (trace_next + 1) % PROFILE_TRACE_SIZE;
+	if (trace_count < PROFILE_TRACE_SIZE) ++trace_count;
+}
+
+//Sorts a copy of the history for the p99, it is only asked for while the stats are shown
+_Bool ProfilerGetStats(ProfileZone zone, ProfileStats* stats) {
+	memset(stats, 0, sizeof(ProfileStats));
+	int count = history_count[zone];
+	if (count == 0) return 0;
+
+	float sorted[PROFILE_HISTORY];
+	memcpy(sorted, zone_history[zone], sizeof(float) * (size_t)count);
+	qsort(sorted, (size_t)count, sizeof(float), CompareFloats);
+
+	float total = 0.0f;
+	for (int i = 0; i < count; ++i) total += sorted[i];
+
+	stats->last = zone_history[zone][(history_next[zone] + PROFILE_HISTORY - 1) % PROFILE_HISTORY];
+	stats->min = sorted[0];
+	stats->avg = total / (float)count;
+	stats->p99 = sorted[(count * 99 + 99) / 100 - 1];
+	stats->frames = count;
+	return 1;
+}
+
+char const* ProfilerGetZoneName(ProfileZone zone) {
+	return zone >= 0 && zone < PROFILE_ZONE_COUNT ? zone_names[zone] : "?";
+}
+
+_Bool ProfilerSaveTrace(char const* path) {
+	FILE* file = OpenFile(path, "w");
+	if (!file) return 0;
+
+	double us_per_tick = 1e6 / (double)(ticks_per_second > 0 ? ticks_per_second : 1);
+	int first = trace_count < PROFILE_TRACE_SIZE ? 0 : trace_next;
+	fprintf(file, "{\"traceEvents\":[\n");
+	for (int i = 0; i < trace_count; ++i) {
+		TraceEvent const* event = &trace[(first + i) % PROFILE_TRACE_SIZE];
+		fprintf(file, "{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":1}%s\n",
+			zone_names[event->zone], (double)(event->start - trace_origin) * us_per_tick, (double)event->duration * us_per_tick,
+			i + 1 < trace_count ? "," : "");
+	}
+	fprintf(file, "],\"displayTimeUnit\":\"ms\"}\n");
+	return fclose(file) == 0;
+}
+
+double ProfilerGetSeconds(void) {
+#ifdef _WIN32
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	return (double)GetTicks() / (double)frequency.QuadPart;
+#else
+	return (double)GetTicks() / 1000000000.0;
+#endif
+}
+
+static long long GetTicks(void) {
+#ifdef _WIN32
+	LARGE_INTEGER ticks;
+	QueryPerformanceCounter(&ticks);
+	return ticks.QuadPart;
+#else
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return (long long)time.tv_sec * 1000000000LL + time.tv_nsec;
+#endif
+}
+
+static int CompareFloats(void const* a, void const* b) {
+	float left = *(float const*)a, right = *(float const*)b;
+	return (left > right) - (left < right);
+}
+
+static FILE* OpenFile(char const* path, char const* mode) {
+#ifdef _MSC_VER
+	FILE* file = NULL;
+	if (fopen_s(&file, path, mode) != 0) return NULL;
+	return file;
+#else
+	return fopen(path, mode);
+#endif
+}
@@ -0,0 +1,215 @@
+/*!
+@file	  RenderQueue.c
+@date     17/10/2026
+@brief    This source file contains the render queue, see RenderQueue.h. Everything queued is put in the bucket of its
+		  look (layer, fill, stroke and stroke weight for rects, layer and image for images). A frame only has a few
+		  looks, so finding the bucket is a short search, and the flush draws the buckets layer by layer with a
+		  counting sort instead of sorting every rect. LAYER_HELD is left in the order it was queued. Sub images keep
+		  their tint per draw, so the many colors of the particles do not each need a look. There are 7 functions in this file,
+
+		  RenderQueueRect - Queues a rect with its fill, stroke and stroke weight.
+		  RenderQueueImage - Queues an image.
+		  RenderQueueSubImage - Queues a part of an image, tinted.
+		  RenderQueueFlush - Draws everything queued bucket by bucket, and empties the queue.
+
+		  FindLook - Returns the bucket of a look, adding it if it is new.
+		  PackColor - Turns a color into a number, so looks can be compared in one go.
+		  UnpackColor - Turns the number back into a color.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#include "RenderQueue.h"
+
+#define MAX_LOOKS 64			// Different looks queued before a flush, more flushes early
+
+/*______________________________________________________________
+@brief Everything a rect or image is drawn with, what is queued is drawn look by look.
+*/
+typedef struct RenderLook {
+	RenderLayer layer;
+	CP_Image image;				// NULL for rects
+	_Bool sub_image;			// Drawn with CP_Image_DrawSubImage and the tint
+	unsigned int fill;			// Packed, for rects
+	unsigned int stroke;
+	float stroke_weight;
+	int count;					// Queued with this look since the last flush
+} RenderLook;
+
+/*______________________________________________________________
+@brief A rect or image waiting for the flush.
+*/
+typedef struct QueuedDraw {
+	int look;
+	float x, y, w, h;
+	int alpha;					// For images
+	float u0, v0, u1, v1;		// For sub images
+	unsigned int tint;			// Packed, for sub images, the alpha is left out as it is drawn with the alpha
+} QueuedDraw;
+
+RenderLook looks[MAX_LOOKS];
+int look_count = 0;
+int last_look = -1;				// Things are mostly queued a few of the same look in a row, so it is checked first
+
+QueuedDraw queued_draws[RENDER_QUEUE_SIZE];
+int queued_count = 0;
+int draw_order[RENDER_QUEUE_SIZE];	// The queued draws sorted by look, worked out on the flush
+
+#pragma region
+int FindLook(RenderLayer layer, CP_Image image, _Bool sub_image, unsigned int fill, unsigned int stroke, float stroke_weight);
+unsigned int PackColor(CP_Color color);
+CP_Color UnpackColor(unsigned int color);
+#pragma endregion Forward Declarations
+
+void RenderQueueRect(RenderLayer layer, float x, float y, float w, float h, CP_Color fill, CP_Color stroke, float stroke_weight){
+	if (queued_count == RENDER_QUEUE_SIZE) RenderQueueFlush();
+	int look = FindLook(layer, NULL, FALSE, PackColor(fill), PackColor(stroke), stroke_weight);
+
+	QueuedDraw* draw = &queued_draws[queued_count++];
+	draw->look = look;
+	draw->x = x;
+	draw->y = y;
+	draw->w = w;
+	draw->h = h;
+}
+
+void RenderQueueImage(RenderLayer layer, CP_Image image, float x, float y, float w, float h, int alpha){
+	if (image == NULL) return;
+	if (queued_count == RENDER_QUEUE_SIZE) RenderQueueFlush();
+	int look = FindLook(layer, image, FALSE, 0, 0, 0.0f);
+
+	QueuedDraw* draw = &queued_draws[queued_count++];
+	draw->look = look;
+	draw->x = x;
+	draw->y = y;
+	draw->w = w;
+	draw->h = h;
+	draw->alpha = alpha;
+}
+
+void RenderQueueSubImage(RenderLayer layer, CP_Image image, float x, float y, float w, float h, float u0, float v0, float u1, float v1, CP_Color tint){
+	if (image == NULL) return;
+	if (queued_count == RENDER_QUEUE_SIZE) RenderQueueFlush();
+	int look = FindLook(layer, image, TRUE, 0, 0, 0.0f);
+
+	QueuedDraw* draw = &queued_draws[queued_count++];
+	draw->look = look;
+	draw->x = x;
+	draw->y = y;
+	draw->w = w;
+	draw->h = h;
+	draw->alpha = tint.a;
+	draw->u0 = u0;
+	draw->v0 = v0;
+	draw->u1 = u1;
+	draw->v1 = v1;
+	draw->tint = PackColor(tint) | 0xFF;
+}
+
+void RenderQueueFlush(void){
+	if (queued_count == 0) return;
+
+	// Where each look starts in the draw order, layer by layer and in the order the looks were first queued
+	int look_start[MAX_LOOKS];
+	int layer_start[RENDER_LAYER_COUNT];
+	int start = 0;
+	for (int layer = 0; layer < RENDER_LAYER_COUNT; ++layer) {
+		layer_start[layer] = start;
+		for (int look = 0; look < look_count; ++look) {
+			if (looks[look].layer != (RenderLayer)layer) continue;
+			look_start[look] = start;
+			start += looks[look].count;
+		}
+	}
+	// Draws of the same look keep the order they were queued in, the held piece keeps it across its looks too
+	for (int index = 0; index < queued_count; ++index) {
+		int look = queued_draws[index].look;
+		if (looks[look].layer == LAYER_HELD) draw_order[layer_start[LAYER_HELD]++] = index;
+		else draw_order[look_start[look]++] = index;
+	}
+
+	// Whatever was set before the flush is not known, so the first rect sets everything
+	RenderLook const* current = NULL;
+	CP_Settings_RectMode(CP_POSITION_CORNER);
+	_Bool is_tinted = FALSE;
+	unsigned int tint = 0;
+
+	for (int index = 0; index < queued_count; ++index) {
+		QueuedDraw const* draw = &queued_draws[draw_order[index]];
+		RenderLook const* look = &looks[draw->look];
+		if (look->sub_image) {
+			if (!is_tinted || draw->tint != tint) {
+				CP_Settings_Tint(UnpackColor(draw->tint));
+				is_tinted = TRUE;
+				tint = draw->tint;
+			}
+			CP_Image_DrawSubImage(look->image, draw->x, draw->y, draw->w, draw->h, draw->u0, draw->v0, draw->u1, draw->v1, draw->alpha);
+			continue;
+		}
+		if (look->image) {
+			// Whole images are not tinted
+			if (is_tinted) {
+				CP_Settings_NoTint();
+				is_tinted = FALSE;
+			}
+			CP_Image_Draw(look->image, draw->x, draw->y, draw->w, draw->h, draw->alpha);
+			continue;
+		}
+
+		if (look != current) {
+			if (!current || look->fill != current->fill) {
+				CP_Settings_Fill(UnpackColor(look->fill));
+			}
+			if (!current || look->stroke != current->stroke) {
+				CP_Settings_Stroke(UnpackColor(look->stroke));
+			}
+			if (!current || look->stroke_weight != current->stroke_weight) {
+				CP_Settings_StrokeWeight(look->stroke_weight);
+			}
+			current = look;
+		}
+		CP_Graphics_DrawRect(draw->x, draw->y, draw->w, draw->h);
+	}
+	if (is_tinted) CP_Settings_NoTint();
+
+	queued_count = 0;
+	look_count = 0;
+	last_look = -1;
+}
+
+int FindLook(RenderLayer layer, CP_Image image, _Bool sub_image, unsigned int fill, unsigned int stroke, float stroke_weight){
+	if (last_look >= 0) {
+		RenderLook* look = &looks[last_look];
+		if (look->layer == layer && look->image == image && look->sub_image == sub_image && look->fill == fill && look->stroke == stroke && look->stroke_weight == stroke_weight) {
+			++look->count;
+			return last_look;
+		}
+	}
+	for (int index = 0; index < look_count; ++index) {
+		RenderLook* look = &looks[index];
+		if (look->layer == layer && look->image == image && look->sub_image == sub_image && look->fill == fill && look->stroke == stroke && look->stroke_weight == stroke_weight) {
+			++look->count;
+			return last_look = index;
+		}
+	}
+
+	// Out of looks, what is queued so far is drawn first
+	if (look_count == MAX_LOOKS) RenderQueueFlush();
+	RenderLook* look = &looks[look_count];
+	look->layer = layer;
+	look->image = image;
+	look->sub_image = sub_image;
+	look->fill = fill;
+	look->stroke = stroke;
+	look->stroke_weight = stroke_weight;
+	look->count = 1;
+	return last_look = look_count++;
+}
+
+unsigned int PackColor(CP_Color color){
+	return (unsigned int)color.r << 24 | (unsigned int)color.g << 16 | (unsigned int)color.b << 8 | color.a;
+}
+
+CP_Color UnpackColor(unsigned int color){
+	return CP_Color_Create(color >> 24, (color >> 16) & 0xFF, (color >> 8) & 0xFF, color & 0xFF);
+}
@@ -0,0 +1,967 @@
+/*!
+@file	  SimCore.c
+@date     16/10/2026
+@brief    This source file contains the rules of the game with no CProcessing or windows dependency. It was pulled out
+		  of WaveSystem.c, EnemyStats.c and TManager.c so that games can be stepped without a window (e.g. for balancing),
+		  those files now forward to the functions here using the game's SimState.
+
+		  The wave system algorithm is the same as before (see WaveSystem.c). Every random number comes from the
+		  state's own streams (see SimRandom.h) so a game can be replayed from its seed, and anything the game wants
+		  to show is sent out through SimNotify.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#include <math.h>
+#include <string.h>		// For memset
+#include "SimCore.h"
+#ifdef _MSC_VER
+#include <intrin.h>		// For _BitScanForward/_BitScanReverse
+#endif
+
+//-----ENEMYTYPE-----//
+//cost,speed,health,damage,sprite,type
+#define ZOMBIE_PREFAB 1,1,1,2,"Z",ZOMBIE
+#define LEAPER_PREFAB 5,3,1,1,"L",LEAPER
+#define TANK_PREFAB 10,1,3,2,"T",TANK
+#define WALLBREAKER_PREFAB 15,1,2,3,"B",BREAKER
+#define GRAVE_PREFAB 18,0,1,0,"G",GRAVE
+//-----WALL-----//
+#define WALL_PREFAB 0,0,3,0,"|x|",WALL//Not enemy, special type for player to use
+
+static EnemyInfo enemyPool[ENEMYPOOL];
+static int enemyPoolIndex = 0;
+static SimEnemyStats enemyStats[ZOMBIE_TYPE_LENGTH];		//The same stats as the prefabs, by type for the board to look up
+static SimPieceShape pieceShapes[TOTAL_PIECES][ROTATION_TYPE_LENGTH];	//Every orientation of every piece, see SimInitPieceShapes
+
+#pragma region
+static void SimCreateEnemy(int cost, int speed, int health, int damage, const char* sprite, ZombieType type);
+static int RandomRange(SimState* sim, SimRandomStream stream, int lower, int upper);
+static uint32_t HashBytes(uint32_t hash, void const* data, size_t size);
+static uint32_t HashInt(uint32_t hash, int value);
+static void SimNotify(SimState* sim, SimEventType type, int slot);
+static _Bool IsCellInGrid(int x, int y);
+static void OccupyCell(SimState* sim, int slot);
+static void VacateCell(SimState* sim, int slot);
+static void SetEnemyCell(SimState* sim, int slot, int x, int y);
+static void PlaceEnemy(SimState* sim, int slot, EnemyInfo const* enemy, int x, int y);
+static void DespawnEnemy(SimState* sim, int slot);
+static void ResetSlots(SimState* sim);
+static int AllocateSlot(SimState* sim);
+static void FreeSlot(SimState* sim, int slot);
+static int GetLiveSlotsByCell(SimState const* sim, short* slots);
+static uint16_t RowSpan(int fromX, int toX);
+static int LowestBit(uint32_t bits);
+static int HighestBit(uint32_t bits);
+static void FillBag(SimState* sim, int bag);
+static void ShuffleBag(SimState* sim, int bag);
+static void ParsePieceShape(PieceType type, int shape[SHAPE_BOUNDS][SHAPE_BOUNDS], int* x_length, int* y_length);
+static void BuildPieceShape(PieceType type, int rotation, SimPieceShape* piece);
+#pragma endregion Forward Declarations
+
+//______________________________________________________________
+// Enemy prefabs
+
+/*______________________________________________________________
+@brief Initialises the enemy pool. Edit this to add more enemy types
+______________________________________________________________*/
+void SimInitEnemyPool(void){
+	enemyPoolIndex = 0;
+	//Create zombie type to spawn
+	SimCreateEnemy(WALL_PREFAB);
+	SimCreateEnemy(ZOMBIE_PREFAB);
+	SimCreateEnemy(LEAPER_PREFAB);
+	SimCreateEnemy(TANK_PREFAB);
+	SimCreateEnemy(WALLBREAKER_PREFAB);
+	SimCreateEnemy(GRAVE_PREFAB);
+}
+
+/*______________________________________________________________
+@brief Function that creates enemies and adds them to the enemy pool
+______________________________________________________________*/
+static void SimCreateEnemy(int cost, int speed, int health, int damage, const char* sprite, ZombieType type){
+	EnemyInfo newEnemy = {
+		.Cost = cost,
+		.Health = health,
+		.damage = damage,
+		.MaxHealth = health,
+		.CharSprite = (char*)sprite,
+		.MovementSpeed = speed,
+		.type = type,
+		.moveCooldown = FALSE
+	};
+	enemyPool[enemyPoolIndex] = newEnemy;
+	enemyPoolIndex++;
+
+	SimEnemyStats stats = {
+		.Cost = cost,
+		.MovementSpeed = speed,
+		.damage = damage,
+		.MaxHealth = health,
+		.CharSprite = (char*)sprite
+	};
+	enemyStats[type] = stats;
+}
+
+//Returns the total count of enemies in the enemy pool
+int SimGetEnemyCount(void){
+	return enemyPoolIndex;
+}
+
+//Returns the EnemyInfo in the stored index
+EnemyInfo* SimGetEnemyPrefab(int index){
+	return &enemyPool[index];
+}
+
+//Returns the stats shared by every enemy of the type
+SimEnemyStats const* SimGetEnemyStats(ZombieType type){
+	return &enemyStats[type];
+}
+
+//______________________________________________________________
+// Game state
+
+//Clears the state for a new game, the wave and bags are left for the caller to fill.
+void SimInit(SimState* sim, SimHooks const* hooks, uint64_t seed){
+	memset(sim,0,sizeof(SimState));
+	if(hooks) sim->hooks = *hooks;
+	sim->currentWave = 1;
+	sim->hearts = MAX_HEART_COUNT;
+	ResetSlots(sim);
+
+	sim->seed = seed;
+	for(int stream = 0; stream < SIM_RANDOM_STREAM_LENGTH; ++stream){
+		SimRandomSeed(&sim->random[stream],seed,(uint32_t)stream);
+	}
+}
+
+//Starts a whole new game in one go, used when there is no game level around to do the initialising in its own order.
+void SimNewGame(SimState* sim, SimHooks const* hooks, uint64_t seed){
+	SimInit(sim,hooks,seed);
+	SimFillBags(sim);
+	SimFillHand(sim);
+	SimGenerateWave(sim);
+}
+
+//Copies the state without the hooks, they point outside the state and are only good for the game that set them
+void SimSaveSnapshot(SimState const* sim, SimSnapshot* snapshot){
+	memcpy(&snapshot->state,sim,sizeof(SimState));
+	memset(&snapshot->state.hooks,0,sizeof(SimHooks));
+}
+
+//Copies the state back over the game, keeping the game's own hooks
+void SimRestoreSnapshot(SimState* sim, SimSnapshot const* snapshot){
+	SimHooks hooks = sim->hooks;
+	memcpy(sim,&snapshot->state,sizeof(SimState));
+	sim->hooks = hooks;
+}
+
+//Hashes the board cell by cell, so where each object sits in waveObjects doesn't matter, then the rest of the state
+uint32_t SimHashState(SimState const* sim){
+	uint32_t hash = 2166136261u;	//FNV-1a offset basis
+	for(int y = 0; y < TOTAL_YGRID; ++y){
+		for(int x = 0; x < TOTAL_XGRID; ++x){
+			int slot = SimGetSlot(sim,x,y);
+			if(slot < 0){
+				hash = HashInt(hash,-1);
+				continue;
+			}
+			hash = HashInt(hash,sim->waveObjects.type[slot]);
+			hash = HashInt(hash,sim->waveObjects.health[slot]);
+			hash = HashInt(hash,sim->waveObjects.moveCooldown[slot]);
+		}
+	}
+
+	//Only the enemies still to spawn, the rest of the queue is left over from earlier in the wave
+	for(int i = sim->waveIndex; i < sim->enemySpawnIndex; ++i){
+		hash = HashInt(hash,sim->enemiesToSpawn[i % MAXENEMYCOUNT]);
+	}
+	hash = HashInt(hash,sim->enemySpawnIndex);
+	hash = HashInt(hash,sim->waveIndex);
+	hash = HashInt(hash,sim->waveCredits);
+	hash = HashInt(hash,sim->currentWave);
+	hash = HashInt(hash,sim->enemiesKilled);
+
+	hash = HashInt(hash,sim->hearts);
+	for(int i = 0; i < HAND_SIZE; ++i) hash = HashInt(hash,sim->hand[i]);
+	for(int i = 0; i < PEEK_SIZE; ++i) hash = HashInt(hash,sim->peekHand[i]);
+	for(int bag = 0; bag < TOTAL_BAGS; ++bag){
+		for(int i = 0; i < TOTAL_PIECES; ++i) hash = HashInt(hash,sim->piecesBag[bag][i]);
+	}
+	hash = HashInt(hash,sim->currentBag);
+	hash = HashInt(hash,sim->currentIndex);
+
+	for(int stream = 0; stream < SIM_RANDOM_STREAM_LENGTH; ++stream){
+		for(int i = 0; i < 4; ++i) hash = HashInt(hash,(int)sim->random[stream].state[i]);
+	}
+	return hash;
+}
+
+//FNV-1a over the bytes
+static uint32_t HashBytes(uint32_t hash, void const* data, size_t size){
+	unsigned char const* bytes = (unsigned char const*)data;
+	for(size_t i = 0; i < size; ++i){
+		hash ^= bytes[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+//Hashes the int as 4 little endian bytes, so the hash is the same on every platform
+static uint32_t HashInt(uint32_t hash, int value){
+	unsigned char bytes[4] = { (unsigned char)value, (unsigned char)(value >> 8), (unsigned char)(value >> 16), (unsigned char)(value >> 24) };
+	return HashBytes(hash,bytes,sizeof(bytes));
+}
+
+//Returns a random number between lower and upper (inclusive) from the game's stream
+static int RandomRange(SimState* sim, SimRandomStream stream, int lower, int upper){
+	return SimRandomRange(&sim->random[stream],lower,upper);
+}
+
+//Lets the presentation side know something happened to the enemy in the slot (-1 for none), if it's listening.
+static void SimNotify(SimState* sim, SimEventType type, int slot){
+	if(!sim->hooks.OnEvent)return;
+	if(slot < 0){
+		sim->hooks.OnEvent(type,NULL,sim->hooks.userData);
+		return;
+	}
+	EnemyInfo enemy;
+	SimGetEnemyInSlot(sim,slot,&enemy);
+	sim->hooks.OnEvent(type,&enemy,sim->hooks.userData);
+}
+
+//______________________________________________________________
+// Wave system
+
+//Generates the wave by deducting credits and populating the array of enemies to spawn
+void SimGenerateWave(SimState* sim){
+	// Formula made in desmos, curve is a nice S curve.
+	sim->waveCredits = (int)(12.0f / (0.5f + powf(expf((float)-sim->currentWave+10), 0.2f)));
+
+	while(sim->waveCredits > 0){
+		//Index 0 is the wall so we exclude it from the random selection
+		int randomEnemyIndex = RandomRange(sim,SIM_RANDOM_WAVE,1,enemyPoolIndex-1);
+		EnemyInfo const* prefab = &enemyPool[randomEnemyIndex];
+
+		//Check if Credits-Enemy cost is valid. (it loops and tries again if it isn't)
+		//NOTE: Because there's no break, there MUST be an enemy with at least 1 for it's cost.
+		if((sim->waveCredits-prefab->Cost)>=0){
+			sim->enemiesToSpawn[sim->enemySpawnIndex % MAXENEMYCOUNT] = (unsigned char)randomEnemyIndex;
+			sim->waveCredits -= prefab->Cost;
+			sim->enemySpawnIndex++;
+		}
+	}
+}
+
+//Starts the next wave
+void SimNextWave(SimState* sim){
+	//Check if it's the last wave
+	if(sim->currentWave >= WAVES_TO_WIN) return;
+	//reset array for enemies to spawn
+	memset(sim->enemiesToSpawn,0,sizeof(sim->enemiesToSpawn));
+	sim->waveIndex = 0;
+	sim->enemySpawnIndex = 0;
+	//Once the wave is done spawning, it waits for more turns
+	sim->currentWave++;
+	SimGenerateWave(sim);				//generates the next wave
+}
+
+//The zombie's turn, moves the enemies on the board then spawns in the next few enemies of the wave.
+void SimZombieTurn(SimState* sim){
+	SimWaveObjects* objects = &sim->waveObjects;
+	//MOVES ENEMIES, row by row from the front so an enemy always moves before the ones behind it
+	short slots[WAVEOBJECTCOUNT];
+	int liveCount = GetLiveSlotsByCell(sim,slots);
+	for(int i = 0; i < liveCount; ++i){
+		int slot = slots[i];
+		if(!objects->isAlive[slot]) continue;	//A wall broken earlier this turn
+		if(objects->moveCooldown[slot]){
+			objects->moveCooldown[slot] = FALSE;
+			continue;
+		}
+		if(enemyStats[objects->type[slot]].MovementSpeed >0){
+			SimMoveEnemy(sim,slot);
+		}
+	}
+	//=========================== SPAWNING OF ENEMIES HERE ===========================
+	//Gets the number of enemies left to spawn
+	int enemiesRemainingToSpawn = sim->enemySpawnIndex-sim->waveIndex;
+	//Gets a random number that is either the column size or the enemies left to spawn, whichever is lesser.
+	int maxSpawnCount = (TOTAL_YGRID-1) < enemiesRemainingToSpawn ? (TOTAL_YGRID-1) : enemiesRemainingToSpawn;
+	int randEnemyCount = RandomRange(sim,SIM_RANDOM_SPAWN,1,maxSpawnCount);
+	int currCount = 0;
+	//As long as there are still enemies to spawn, we continue
+	if(sim->waveIndex < sim->enemySpawnIndex){
+		//We loop through all the enemies we CAN spawn
+		while(currCount < randEnemyCount){
+			EnemyInfo enemy = enemyPool[sim->enemiesToSpawn[sim->waveIndex % MAXENEMYCOUNT]];
+			SimSpawnEnemy(sim,&enemy);
+			currCount++;//gotta increment
+			//If we finish spawning all the enemies, it means this wave has ended
+			if(sim->waveIndex >= sim->enemySpawnIndex){
+				SimNextWave(sim);
+				break;
+			}
+		}
+	}
+	else{
+		//extra catch just in case
+		SimNextWave(sim);
+	}
+}
+
+//Spawns random enemy in cell occupied by grave enemies
+void SimSpawnTombEnemies(SimState* sim){
+	SimWaveObjects* objects = &sim->waveObjects;
+	//Graves hatch in board order so which grave gets which enemy doesn't depend on the slots they were given
+	short slots[WAVEOBJECTCOUNT];
+	int liveCount = GetLiveSlotsByCell(sim,slots);
+	for(int i = 0; i < liveCount; ++i){
+		int slot = slots[i];
+		SimEnemyStats const* stats = &enemyStats[objects->type[slot]];
+		if(stats->MovementSpeed <=0 && stats->Cost >0){
+			//Need to use SimGetEnemyCount()-2 so you don't get graves that spawn graves
+			EnemyInfo const* newEnemy = &enemyPool[RandomRange(sim,SIM_RANDOM_GRAVE,1,enemyPoolIndex-2)];
+			//replace tombstone with random enemy, it keeps the same slot and xy pos, only the cell's type mask changes
+			VacateCell(sim,slot);
+			objects->type[slot] = (unsigned char)newEnemy->type;
+			OccupyCell(sim,slot);
+			objects->health[slot] = (short)newEnemy->Health;
+			objects->moveCooldown[slot] = TRUE;
+			SimNotify(sim,SIM_GRAVE_HATCHED,slot);
+		}
+	}
+}
+
+//Spawns enemies to the grid, used by the zombie turn to spawn enemies into the grid.
+void SimSpawnEnemy(SimState* sim, EnemyInfo* enemy){
+	//Grave enemies have a different spawning positon to other zombies.
+	if(enemy->type == GRAVE) enemy->x = RandomRange(sim,SIM_RANDOM_SPAWN,TOTAL_XGRID-4,TOTAL_XGRID-2);
+	else enemy->x = TOTAL_XGRID-1;
+	//The Y position of all zombies are randomised
+	enemy->y = RandomRange(sim,SIM_RANDOM_SPAWN,0,TOTAL_YGRID-1);
+	if(SimHasLiveEnemy(sim,enemy->x,enemy->y))return;
+	int slot = AllocateSlot(sim);
+	if(slot < 0)return;
+	enemy->isAlive = TRUE;
+	PlaceEnemy(sim,slot,enemy,enemy->x,enemy->y);
+	sim->waveIndex++;
+	SimNotify(sim,SIM_ENEMY_SPAWNED,slot);
+}
+
+//Spawns a specific enemy in the specified cell if it is unoccupied. Used in tutorial for scripted spawns.
+void SimSpawnEnemyInCell(SimState* sim, int x, int y, EnemyInfo const* enemy){
+	//Cells outside the board can't be indexed, so nothing can be spawned there
+	if(!IsCellInGrid(x,y) || SimHasLiveEnemy(sim,x,y)) return;
+	int slot = AllocateSlot(sim);
+	if(slot < 0)return;
+	PlaceEnemy(sim,slot,enemy,x,y);
+}
+
+//Creates a wall in unoccupied cell.
+void SimCreateWall(SimState* sim, int x, int y){
+	if(!IsCellInGrid(x,y) || SimHasLiveEnemy(sim,x,y))return;
+	int slot = AllocateSlot(sim);
+	if(slot < 0)return;
+	PlaceEnemy(sim,slot,&enemyPool[0],x,y);
+	SimNotify(sim,SIM_WALL_BUILT,slot);
+}
+
+//Sends damage to enemy in specified cell. Called by tetromino pieces.
+void SimSendDamage(SimState* sim, int x, int y, int damage){
+	//Make sure the thing we want to send damage to is in the playing area
+	if(!SimIsInPlayingArea(x,y))return;
+	//Make sure it's not null/dead lol
+	int slot = SimGetSlot(sim,x,y);
+	if (slot < 0) return;
+	if (sim->waveObjects.type[slot] == WALL) return;
+	sim->waveObjects.health[slot]-=(short)damage;
+	if(sim->waveObjects.health[slot] <=0){
+		DespawnEnemy(sim,slot);
+		sim->enemiesKilled++;
+		SimNotify(sim,SIM_ENEMY_KILLED,slot);
+	}
+}
+
+//Function for zombies to deal damage to walls
+void SimZombieDealDamage(SimState* sim, int x, int y, int damage){
+	//Make sure the thing we want to send damage to is in the playing area
+	if(!SimIsInPlayingArea(x,y))return;
+	//Make sure it's not null/dead lol
+	int slot = SimGetSlot(sim,x,y);
+	if (slot < 0) return;
+	sim->waveObjects.health[slot]-=(short)damage;
+	if(sim->waveObjects.health[slot] <=0){
+		DespawnEnemy(sim,slot);
+		SimNotify(sim,SIM_WALL_DESTROYED,slot);
+	}
+}
+
+/*______________________________________________________________
+@brief Enemy movement in the play area
+______________________________________________________________*/
+void SimMoveEnemy(SimState* sim, int slot){
+	SimWaveObjects* objects = &sim->waveObjects;
+	SimEnemyStats const* stats = &enemyStats[objects->type[slot]];
+	if(stats->MovementSpeed<=0)return;
+	int x = objects->x[slot];
+	int y = objects->y[slot];
+	//Check the cells the enemy passes through this turn, the first one taken in front of them blocks the way
+	uint16_t path = sim->occupied.rows[y] & RowSpan(x-stats->MovementSpeed,x-1);
+	if(path){
+		int blockX = HighestBit(path);
+		if(sim->typeMasks[WALL].rows[y] >> blockX & 1u){		//if it's a wall
+			SimZombieDealDamage(sim,blockX,y,stats->damage);	//Zombie deals damage to zombie
+			if(!(sim->occupied.rows[y] >> blockX & 1u)){		//Check if the wall is still there
+				SetEnemyCell(sim,slot,blockX,y);				//Moves into the wall's space if not there
+				SimNotify(sim,SIM_WALL_BREACHED,slot);
+				return;
+			}
+		}
+		SetEnemyCell(sim,slot,blockX+1,y);						//stop right behind it
+		return;
+	}
+
+	//If the enemy has reach last x element, it'll die and damage player
+
+	SetEnemyCell(sim,slot,x-stats->MovementSpeed,y);//enemy position in next turn
+
+	if (objects->x[slot] < 0 && objects->isAlive[slot])
+	{
+		DespawnEnemy(sim,slot);//enemy is ded(LOLXD)
+		SimNotify(sim,SIM_PLAYER_HIT,slot);
+		SimLoseHearts(sim,1); // LOSE ONE LIFE FOR EACH ENEMY ENTERING THE WALL
+	}
+
+	SimNotify(sim,SIM_ENEMY_MOVED,slot);
+}
+
+//Returns the slot of the live enemy in the specified grid. Returns -1 if otherwise.
+int SimGetSlot(SimState const* sim, int x, int y){
+	if(!IsCellInGrid(x,y))return -1;
+	return sim->cellObjects[x][y]-1;
+}
+
+//Puts the hot data of the slot back together with its type's stats
+void SimGetEnemyInSlot(SimState const* sim, int slot, EnemyInfo* enemy){
+	SimWaveObjects const* objects = &sim->waveObjects;
+	SimEnemyStats const* stats = &enemyStats[objects->type[slot]];
+	enemy->x = objects->x[slot];
+	enemy->y = objects->y[slot];
+	enemy->Cost = stats->Cost;
+	enemy->MovementSpeed = stats->MovementSpeed;
+	enemy->damage = stats->damage;
+	enemy->Health = objects->health[slot];
+	enemy->MaxHealth = stats->MaxHealth;
+	enemy->CharSprite = stats->CharSprite;
+	enemy->type = (ZombieType)objects->type[slot];
+	enemy->moveCooldown = objects->moveCooldown[slot];
+	enemy->isAlive = objects->isAlive[slot];
+}
+
+//Copies the live enemy in the specified grid. Returns FALSE if there is none.
+_Bool SimGetEnemy(SimState const* sim, int x, int y, EnemyInfo* enemy){
+	int slot = SimGetSlot(sim,x,y);
+	if(slot < 0)return FALSE;
+	SimGetEnemyInSlot(sim,slot,enemy);
+	return TRUE;
+}
+
+//Checks if the enemy in the specified cell is alive.
+_Bool SimHasLiveEnemy(SimState const* sim, int x, int y){
+	return SimBitboardTest(&sim->occupied,x,y);
+}
+
+//Checks if the thing in the specified cell is a wall
+_Bool SimHasWall(SimState const* sim, int x, int y){
+	return SimBitboardTest(&sim->typeMasks[WALL],x,y);
+}
+
+//Checks a span of the row for anything live that isn't a wall
+_Bool SimHasZombieInRow(SimState const* sim, int y, int fromX, int toX){
+	if(y < 0 || y >= TOTAL_YGRID)return FALSE;
+	return ((sim->occupied.rows[y] & ~sim->typeMasks[WALL].rows[y]) & RowSpan(fromX,toX)) ? TRUE : FALSE;
+}
+
+//Every live cell without a wall in it
+void SimGetZombieMask(SimState const* sim, SimBitboard* mask){
+	for(int y = 0; y < TOTAL_YGRID; ++y){
+		mask->rows[y] = sim->occupied.rows[y] & ~sim->typeMasks[WALL].rows[y];
+	}
+}
+
+//Returns true if all enemies are dead, false if otherwise. Only walls can be left on the board.
+_Bool SimIsAllEnemiesDead(SimState const* sim){
+	for(int y = 0; y < TOTAL_YGRID; ++y){
+		if(sim->occupied.rows[y] & ~sim->typeMasks[WALL].rows[y])return FALSE;
+	}
+	return TRUE;
+}
+
+//Returns true if the cell is on the board but not in the spawn column
+_Bool SimIsInPlayingArea(int x, int y){
+	return (x >= 0 && x < TOTAL_XGRID-1 && y >= 0 && y < TOTAL_YGRID) ? TRUE : FALSE;
+}
+
+//Resets the board and the wave stats
+void SimResetGame(SimState* sim){
+	sim->enemySpawnIndex = 0;
+	sim->waveIndex = 0;
+	sim->currentWave = 1;
+	sim->enemiesKilled = 0;
+	memset(&sim->waveObjects,0,sizeof(sim->waveObjects));
+	memset(sim->cellObjects,0,sizeof(sim->cellObjects));
+	memset(&sim->occupied,0,sizeof(sim->occupied));
+	memset(sim->typeMasks,0,sizeof(sim->typeMasks));
+	memset(sim->enemiesToSpawn,0,sizeof(sim->enemiesToSpawn));
+	ResetSlots(sim);
+}
+
+//Returns true if the cell index is within the board (including the spawn column)
+static _Bool IsCellInGrid(int x, int y){
+	return (x >= 0 && x < TOTAL_XGRID && y >= 0 && y < TOTAL_YGRID) ? TRUE : FALSE;
+}
+
+//Points the cell lookup and bitboards at the waveObjects slot, the slot's x, y and type must already be set.
+static void OccupyCell(SimState* sim, int slot){
+	int x = sim->waveObjects.x[slot];
+	int y = sim->waveObjects.y[slot];
+	if(!IsCellInGrid(x,y))return;
+	sim->cellObjects[x][y] = (short)(slot+1);
+	sim->occupied.rows[y] |= (uint16_t)(1u << x);
+	sim->typeMasks[sim->waveObjects.type[slot]].rows[y] |= (uint16_t)(1u << x);
+}
+
+//Clears the cell lookup and bitboards for the waveObjects slot, only if the cell is still pointing at that slot.
+static void VacateCell(SimState* sim, int slot){
+	int x = sim->waveObjects.x[slot];
+	int y = sim->waveObjects.y[slot];
+	if(!IsCellInGrid(x,y))return;
+	if(sim->cellObjects[x][y] == slot+1){
+		sim->cellObjects[x][y] = 0;
+		sim->occupied.rows[y] &= (uint16_t)~(1u << x);
+		sim->typeMasks[sim->waveObjects.type[slot]].rows[y] &= (uint16_t)~(1u << x);
+	}
+}
+
+//Moves the enemy to the specified cell and keeps the cell lookup in sync. Cells outside the grid are left unindexed.
+static void SetEnemyCell(SimState* sim, int slot, int x, int y){
+	VacateCell(sim,slot);
+	sim->waveObjects.x[slot] = (signed char)x;
+	sim->waveObjects.y[slot] = (signed char)y;
+	if(sim->waveObjects.isAlive[slot]) OccupyCell(sim,slot);
+}
+
+//Fills in a freshly allocated slot from the enemy (only its type, health and cooldown are kept) and puts it in the cell.
+static void PlaceEnemy(SimState* sim, int slot, EnemyInfo const* enemy, int x, int y){
+	SimWaveObjects* objects = &sim->waveObjects;
+	objects->x[slot] = (signed char)x;
+	objects->y[slot] = (signed char)y;
+	objects->health[slot] = (short)enemy->Health;
+	objects->type[slot] = (unsigned char)enemy->type;
+	objects->moveCooldown[slot] = enemy->moveCooldown;
+	objects->isAlive[slot] = TRUE;
+	OccupyCell(sim,slot);
+}
+
+//Kills the enemy without any effects and frees up its cell and slot. The slot keeps its data until it is spawned over.
+static void DespawnEnemy(SimState* sim, int slot){
+	if(!sim->waveObjects.isAlive[slot])return;
+	VacateCell(sim,slot);
+	sim->waveObjects.isAlive[slot] = FALSE;
+	FreeSlot(sim,slot);
+}
+
+//______________________________________________________________
+// Wave object slots
+
+//Marks every slot as free with none live, slot 0 is handed out first.
+static void ResetSlots(SimState* sim){
+	for(short i = 0; i < WAVEOBJECTCOUNT; ++i){
+		sim->freeSlots[i] = WAVEOBJECTCOUNT-1-i;
+	}
+	sim->freeCount = WAVEOBJECTCOUNT;
+	sim->liveCount = 0;
+}
+
+//Takes a free slot and adds it to the live list, -1 if every slot is taken. The caller fills it in with PlaceEnemy.
+static int AllocateSlot(SimState* sim){
+	if(sim->freeCount <= 0)return -1;
+	short slot = sim->freeSlots[--sim->freeCount];
+	sim->livePositions[slot] = sim->liveCount;
+	sim->liveSlots[sim->liveCount++] = slot;
+	return slot;
+}
+
+//Gives the slot back, the last live slot is moved into its place in the live list.
+static void FreeSlot(SimState* sim, int slot){
+	short position = sim->livePositions[slot];
+	short last = sim->liveSlots[--sim->liveCount];
+	sim->liveSlots[position] = last;
+	sim->livePositions[last] = position;
+	sim->freeSlots[sim->freeCount++] = (short)slot;
+}
+
+/*______________________________________________________________
+@brief Copies the live slots into slots, sorted by row and then column, the same order as walking the board.
+	   Only objects on the board are live so there are at most a board's worth, insertion sort is plenty.
+@return the number of slots written
+*/
+static int GetLiveSlotsByCell(SimState const* sim, short* slots){
+	SimWaveObjects const* objects = &sim->waveObjects;
+	for(short i = 0; i < sim->liveCount; ++i){
+		short slot = sim->liveSlots[i];
+		int key = objects->y[slot]*TOTAL_XGRID + objects->x[slot];
+		int j = i;
+		while(j > 0){
+			short before = slots[j-1];
+			if(objects->y[before]*TOTAL_XGRID + objects->x[before] <= key)break;
+			slots[j] = before;
+			--j;
+		}
+		slots[j] = slot;
+	}
+	return sim->liveCount;
+}
+
+//______________________________________________________________
+// Bitboards
+
+//The bits of the columns fromX to toX (inclusive), columns off the board are left out.
+static uint16_t RowSpan(int fromX, int toX){
+	if(fromX < 0) fromX = 0;
+	if(toX > TOTAL_XGRID-1) toX = TOTAL_XGRID-1;
+	if(fromX > toX)return 0;
+	return (uint16_t)(((1u << (toX+1)) - 1u) & ~((1u << fromX) - 1u));
+}
+
+//Index of the lowest set bit, bits can't be 0
+static int LowestBit(uint32_t bits){
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward(&index,bits);
+	return (int)index;
+#else
+	return __builtin_ctz(bits);
+#endif
+}
+
+//Index of the highest set bit, bits can't be 0
+static int HighestBit(uint32_t bits){
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanReverse(&index,bits);
+	return (int)index;
+#else
+	return 31 - __builtin_clz(bits);
+#endif
+}
+
+void SimBitboardSet(SimBitboard* board, int x, int y){
+	if(!IsCellInGrid(x,y))return;
+	board->rows[y] |= (uint16_t)(1u << x);
+}
+
+_Bool SimBitboardTest(SimBitboard const* board, int x, int y){
+	if(!IsCellInGrid(x,y))return FALSE;
+	return (board->rows[y] >> x & 1u) ? TRUE : FALSE;
+}
+
+//Lists the set cells row by row, each row is walked from its lowest set bit
+int SimBitboardGetCells(SimBitboard const* board, SimCell* cells){
+	int count = 0;
+	for(int y = 0; y < TOTAL_YGRID; ++y){
+		uint32_t bits = board->rows[y];
+		while(bits){
+			cells[count].x = LowestBit(bits);
+			cells[count].y = y;
+			++count;
+			bits &= bits - 1;	//Clears the lowest set bit
+		}
+	}
+	return count;
+}
+
+//______________________________________________________________
+// Hearts
+
+//Removes lives from the player
+void SimLoseHearts(SimState* sim, int count){
+	sim->hearts -= count;
+	if(sim->hearts < 0) sim->hearts = 0;
+	SimNotify(sim,SIM_HEART_LOST,-1);
+}
+
+//Gives lives back to the player
+void SimGainHearts(SimState* sim, int count){
+	sim->hearts += count;
+	if(sim->hearts > MAX_HEART_COUNT) sim->hearts = MAX_HEART_COUNT;
+}
+
+//Returns true if there are no hearts left
+_Bool SimIsGameLost(SimState const* sim){
+	return sim->hearts <= 0;
+}
+
+//Returns true if the last wave is done and cleared without dying
+_Bool SimIsGameWon(SimState const* sim){
+	return sim->currentWave >= WAVES_TO_WIN && SimIsAllEnemiesDead(sim) && !SimIsGameLost(sim);
+}
+
+//______________________________________________________________
+// Tetris pieces
+
+/*______________________________________________________________
+@brief Fills and shuffles every bag, and starts drawing from the first one.
+*/
+void SimFillBags(SimState* sim){
+	sim->currentBag = sim->currentIndex = 0;
+
+	for (int index = 0; index < TOTAL_BAGS; ++index) {
+		FillBag(sim, index);
+		ShuffleBag(sim, index);
+	}
+}
+
+/*______________________________________________________________
+@brief Draws the next Tetris Piece from the queue, the queue will never run out of pieces.
+
+@return PieceType - The next Tetris Piece in queue.
+*/
+PieceType SimDrawFromBag(SimState* sim){
+	PieceType drawn_piece = sim->piecesBag[sim->currentBag][sim->currentIndex++];
+
+	// If the queue is running low, swap bags and shuffle in more pieces.
+	if (sim->currentIndex > TOTAL_PIECES - 1) {
+		ShuffleBag(sim, sim->currentBag);
+		sim->currentBag = (sim->currentBag + 1) % TOTAL_BAGS;
+		sim->currentIndex = 0;
+	}
+
+	return drawn_piece;
+}
+
+/*______________________________________________________________
+@brief Fills the chosen bag with a copy of every Tetris Piece possible.
+*/
+static void FillBag(SimState* sim, int bag){
+	for (int index = 0; index < TOTAL_PIECES; ++index) {
+		sim->piecesBag[bag][index] = (PieceType)index;
+	}
+}
+
+/*______________________________________________________________
+@brief Shuffles the chosen bag, the Fisher-Yates shuffle is used for the shuffling process.
+*/
+static void ShuffleBag(SimState* sim, int bag){
+	PieceType (*current_bag) = &sim->piecesBag[bag][0];
+	for (int index = TOTAL_PIECES - 1; index > 0; --index) {
+		int rand_index = RandomRange(sim, SIM_RANDOM_BAG, 0, index);
+
+		PieceType rand_piece = current_bag[rand_index];
+		current_bag[rand_index] = current_bag[index];
+		current_bag[index] = rand_piece;
+	}
+}
+
+/*______________________________________________________________
+@brief Fills the player's hand first, then the peek queue (the upcoming pieces).
+*/
+void SimFillHand(SimState* sim){
+	for (int index = 0; index < HAND_SIZE; ++index) {
+		sim->hand[index] = SimDrawFromBag(sim);
+	}
+	for (int index = 0; index < PEEK_SIZE; ++index) {
+		sim->peekHand[index] = SimDrawFromBag(sim);
+	}
+}
+
+/*______________________________________________________________
+@brief Removes the piece from the player's hand, shifts the pieces behind fowards and draws the next piece.
+*/
+void SimRemoveFromHand(SimState* sim, int slot){
+	for (int index = slot; index < HAND_SIZE - 1; ++index) {
+		sim->hand[index] = sim->hand[index + 1];
+	}
+
+	// Move the next piece from the peek queue into the hand
+	sim->hand[HAND_SIZE - 1] = sim->peekHand[0];
+
+	// Shift the peek queue piece foward
+	for (int index = 0; index < PEEK_SIZE - 1; ++index) {
+		sim->peekHand[index] = sim->peekHand[index + 1];
+	}
+
+	// Draw another piece from the queue
+	sim->peekHand[PEEK_SIZE - 1] = SimDrawFromBag(sim);
+}
+
+/*______________________________________________________________
+@brief Reads the shape of the piece type into shape[x][y], same format as CreatePiece in TManager.c
+*/
+static void ParsePieceShape(PieceType type, int shape[SHAPE_BOUNDS][SHAPE_BOUNDS], int* x_length, int* y_length){
+	char *shape_data = "";
+	switch (type) {
+	case I_PIECE: shape_data = I_PIECE_SHAPE; break;
+	case O_PIECE: shape_data = O_PIECE_SHAPE; break;
+	case T_PIECE: shape_data = T_PIECE_SHAPE; break;
+	case L_PIECE: shape_data = L_PIECE_SHAPE; break;
+	case J_PIECE: shape_data = J_PIECE_SHAPE; break;
+	case Z_PIECE: shape_data = Z_PIECE_SHAPE; break;
+	case S_PIECE: shape_data = S_PIECE_SHAPE; break;
+	}
+
+	int index_x = 0, index_y = 0;
+	*x_length = 0;
+	for (char *current = shape_data; *current != '\0'; ++current) {
+		switch(*current) {
+		case '#': shape[index_x][index_y] = 1; ++index_x; break;
+		case '\n': ++index_y;
+				   *x_length = (*x_length > index_x) ? *x_length : index_x;
+				   index_x = 0; break;
+		default: ++index_x;
+		}
+	}
+
+	*x_length = (*x_length > index_x) ? *x_length : index_x;
+	*y_length = index_y + 1;
+}
+
+/*______________________________________________________________
+@brief Works out the piece in one orientation, this follows what the piece held in TPlayerHeld.c always did:
+	   the piece is centred in a SHAPE_BOUNDS grid, rotated right around it, then offset from the centre.
+*/
+static void BuildPieceShape(PieceType type, int rotation, SimPieceShape* piece){
+	int shape[SHAPE_BOUNDS][SHAPE_BOUNDS] = { 0 };
+	int rotated[SHAPE_BOUNDS][SHAPE_BOUNDS] = { 0 };
+	int x_length, y_length;
+	ParsePieceShape(type, shape, &x_length, &y_length);
+
+	int centre = SHAPE_BOUNDS / 2;
+	int start_x = centre - x_length / 2;
+	int start_y = centre + y_length / 2 - (y_length - 1);
+
+	for (int piece_x = 0; piece_x < x_length; ++piece_x) {
+		for (int piece_y = 0; piece_y < y_length; ++piece_y) {
+			if (!shape[piece_x][piece_y]) continue;
+			int x = start_x + piece_x, y = start_y + piece_y;
+			// Each rotation to the right moves (x, y) to (SHAPE_BOUNDS - 1 - y, x)
+			for (int turn = 0; turn < rotation; ++turn) {
+				int temp = x;
+				x = SHAPE_BOUNDS - 1 - y;
+				y = temp;
+			}
+			rotated[x][y] = 1;
+		}
+	}
+
+	// Rotations aren't balanced around the centre, so the cells are shifted back under the cell held
+	int adjust_x = (rotation == RIGHT || rotation == DOWN);
+	int adjust_y = (rotation == DOWN || rotation == LEFT);
+	int min_x = SHAPE_BOUNDS, min_y = SHAPE_BOUNDS, max_x = -SHAPE_BOUNDS, max_y = -SHAPE_BOUNDS;
+	memset(piece, 0, sizeof(SimPieceShape));
+	for (int y = 0; y < SHAPE_BOUNDS; ++y) {
+		for (int x = 0; x < SHAPE_BOUNDS; ++x) {
+			if (!rotated[x][y]) continue;
+			SimCell* cell = &piece->cells[piece->cellCount++];
+			cell->x = x - centre + adjust_x;
+			cell->y = y - centre + adjust_y;
+			min_x = cell->x < min_x ? cell->x : min_x;
+			min_y = cell->y < min_y ? cell->y : min_y;
+			max_x = cell->x > max_x ? cell->x : max_x;
+			max_y = cell->y > max_y ? cell->y : max_y;
+		}
+	}
+	if (piece->cellCount == 0) return;
+
+	// Pack the cells into a mask starting from the top left covered cell
+	piece->anchorX = -min_x;
+	piece->anchorY = -min_y;
+	piece->width = max_x - min_x + 1;
+	piece->height = max_y - min_y + 1;
+	for (int index = 0; index < piece->cellCount; ++index) {
+		piece->rows[piece->cells[index].y - min_y] |= (uint16_t)(1u << (piece->cells[index].x - min_x));
+	}
+}
+
+/*______________________________________________________________
+@brief Works out all the orientations of every piece once, playing and rotating pieces are just lookups after.
+*/
+void SimInitPieceShapes(void){
+	for (int type = 0; type < TOTAL_PIECES; ++type) {
+		for (int rotation = 0; rotation < ROTATION_TYPE_LENGTH; ++rotation) {
+			BuildPieceShape((PieceType)type, rotation, &pieceShapes[type][rotation]);
+		}
+	}
+}
+
+//Returns the piece in the orientation from the table
+SimPieceShape const* SimGetPieceShape(PieceType type, PieceOrientation orientation){
+	return &pieceShapes[type][orientation];
+}
+
+//Copies the cells out of the table, any number of turns is taken
+int SimGetPieceCells(PieceType type, int rotation, SimCell* cells){
+	SimPieceShape const* piece = &pieceShapes[type][((rotation % 4) + 4) % 4];
+	memcpy(cells, piece->cells, sizeof(SimCell) * piece->cellCount);
+	return piece->cellCount;
+}
+
+//Shifts each row of the piece's mask over to where it is dropped, then clips it to the playing area
+void SimGetPieceMask(PieceType type, int rotation, int x, int y, SimBitboard* mask){
+	memset(mask,0,sizeof(SimBitboard));
+	SimPieceShape const* piece = &pieceShapes[type][((rotation % 4) + 4) % 4];
+	int left = x - piece->anchorX;	//Column of the board the mask starts on
+	int top = y - piece->anchorY;
+	if(left <= -SHAPE_BOUNDS || left >= TOTAL_XGRID)return;
+
+	uint16_t playingArea = RowSpan(0,TOTAL_XGRID-2);
+	for(int row = 0; row < piece->height; ++row){
+		if(top + row < 0 || top + row >= TOTAL_YGRID) continue;
+		uint32_t bits = left >= 0 ? (uint32_t)piece->rows[row] << left : (uint32_t)piece->rows[row] >> -left;
+		mask->rows[top + row] = (uint16_t)(bits & playingArea);
+	}
+}
+
+//Walls go on the empty cells, attacks only on the zombies (never the walls)
+void SimGetPieceTargets(SimState const* sim, int slot, SimBitboard const* covered, SimBitboard* targets){
+	for(int y = 0; y < TOTAL_YGRID; ++y){
+		uint16_t occupied = sim->occupied.rows[y];
+		uint16_t zombies = occupied & ~sim->typeMasks[WALL].rows[y];
+		targets->rows[y] = covered->rows[y] & (slot == 0 ? ~occupied : zombies);
+	}
+}
+
+//______________________________________________________________
+// Turns
+
+//Plays the piece in the hand slot, the wall slot builds walls and the rest send damage.
+_Bool SimPlayPiece(SimState* sim, int slot, int rotation, int x, int y){
+	if(slot < 0 || slot >= HAND_SIZE || !SimIsInPlayingArea(x,y)) return FALSE;
+
+	SimBitboard covered, targets;
+	SimGetPieceMask(sim->hand[slot],rotation,x,y,&covered);
+	SimGetPieceTargets(sim,slot,&covered,&targets);
+
+	SimCell cells[TOTAL_XGRID*TOTAL_YGRID];
+	int cellCount = SimBitboardGetCells(&targets,cells);
+	for(int i = 0; i < cellCount; ++i){
+		slot == 0 ? SimCreateWall(sim,cells[i].x,cells[i].y) : SimSendDamage(sim,cells[i].x,cells[i].y,1);
+	}
+
+	SimRemoveFromHand(sim,slot);
+	return TRUE;
+}
+
+//Ends the player's turn, same order as the PLAYER_END and ZOMBIE_START events in game.
+void SimEndTurn(SimState* sim){
+	SimSpawnTombEnemies(sim);
+	SimZombieTurn(sim);
+}
+
+//Plays a piece and lets the zombies take their turn.
+_Bool SimStepTurn(SimState* sim, int slot, int rotation, int x, int y){
+	if(!SimPlayPiece(sim,slot,rotation,x,y)) return FALSE;
+	SimEndTurn(sim);
+	return TRUE;
+}
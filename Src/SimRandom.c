@@ -0,0 +1,79 @@
+/*!
+@file	  SimRandom.c
+@date     16/10/2026
+@brief    This source file contains the xoshiro128** generator used by the game rules. Ranges are mapped with a
+		  multiply and shift (Lemire's method) and retried in the rare biased case, so every value is equally likely.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#include "SimRandom.h"
+
+#pragma region
+static uint64_t SplitMix64(uint64_t* state);
+static uint32_t RotateLeft(uint32_t value, int count);
+#pragma endregion Forward Declarations
+
+//Seeds the four words of the stream from the game seed, the stream number picks a different starting point.
+void SimRandomSeed(SimRandom* random, uint64_t seed, uint32_t stream){
+	uint64_t mix = seed ^ ((uint64_t)stream * 0xD1B54A32D192ED03ull);
+	uint64_t first = SplitMix64(&mix);
+	uint64_t second = SplitMix64(&mix);
+	random->state[0] = (uint32_t)first;
+	random->state[1] = (uint32_t)(first >> 32);
+	random->state[2] = (uint32_t)second;
+	random->state[3] = (uint32_t)(second >> 32);
+	//An all zero state would only ever give zeros
+	if(!(random->state[0] | random->state[1] | random->state[2] | random->state[3])) random->state[0] = 1;
+}
+
+//xoshiro128**
+uint32_t SimRandomNext(SimRandom* random){
+	uint32_t* s = random->state;
+	uint32_t result = RotateLeft(s[1] * 5, 7) * 9;
+	uint32_t t = s[1] << 9;
+
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = RotateLeft(s[3], 11);
+
+	return result;
+}
+
+//Returns a random int between lower and upper (inclusive)
+int SimRandomRange(SimRandom* random, int lower, int upper){
+	if(upper < lower){
+		int temp = lower;
+		lower = upper;
+		upper = temp;
+	}
+	uint32_t range = (uint32_t)upper - (uint32_t)lower + 1u;
+	if(range == 0) return (int)SimRandomNext(random);	//The whole int range was asked for
+
+	uint64_t scaled = (uint64_t)SimRandomNext(random) * range;
+	uint32_t low = (uint32_t)scaled;
+	if(low < range){
+		//Throw away the few values that would make the lower results more likely
+		uint32_t threshold = (0u - range) % range;
+		while(low < threshold){
+			scaled = (uint64_t)SimRandomNext(random) * range;
+			low = (uint32_t)scaled;
+		}
+	}
+	return (int)((uint32_t)lower + (uint32_t)(scaled >> 32));
+}
+
+//splitmix64, only used to spread the seed over the generator's state
+static uint64_t SplitMix64(uint64_t* state){
+	uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+static uint32_t RotateLeft(uint32_t value, int count){
+	return (value << count) | (value >> (32 - count));
+}
@@ -0,0 +1,222 @@
+/*!
+@file	  SimReplay.c
+@date     17/10/2026
+@brief    This source file contains recording, saving and playing back replays.
+
+		  File layout, every number little endian:
+		  "AMRP", version (4 bytes), seed (8 bytes), action count (4 bytes)
+		  then each action: type, index, rotation, x, y (1 byte each), hash (4 bytes)
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "SimReplay.h"
+
+#define REPLAY_MAGIC "AMRP"
+#define REPLAY_HEADER_SIZE 20
+#define REPLAY_ACTION_SIZE 9
+#define FIRST_CAPACITY 64
+
+#pragma region
+static SimReplayAction* AddAction(SimReplay* replay, SimState const* sim);
+static FILE* OpenFile(char const* path, char const* mode);
+static long GetBytesLeft(FILE* file);
+static EnemyInfo const* GetPrefabOfType(ZombieType type);
+static void PutUint(unsigned char* bytes, uint64_t value, int size);
+static uint64_t GetUint(unsigned char const* bytes, int size);
+#pragma endregion Forward Declarations
+
+void SimReplayInit(SimReplay* replay, uint64_t seed){
+	memset(replay,0,sizeof(SimReplay));
+	replay->seed = seed;
+	replay->pendingMove = -1;
+}
+
+void SimReplayFree(SimReplay* replay){
+	free(replay->actions);
+	SimReplayInit(replay,replay->seed);
+}
+
+_Bool SimReplayRecordMove(SimReplay* replay, SimState const* sim, SimMove const* move){
+	SimReplayAction* action = AddAction(replay,sim);
+	if(!action)return FALSE;
+	action->type = SIM_REPLAY_MOVE;
+	action->index = (unsigned char)move->slot;
+	action->rotation = (unsigned char)(move->rotation % ROTATION_TYPE_LENGTH);
+	action->x = (signed char)move->x;
+	action->y = (signed char)move->y;
+	replay->pendingMove = replay->count - 1;
+	return TRUE;
+}
+
+_Bool SimReplayRecordSpawn(SimReplay* replay, SimState const* sim, int x, int y, ZombieType type){
+	SimReplayAction* action = AddAction(replay,sim);
+	if(!action)return FALSE;
+	action->type = SIM_REPLAY_SPAWN;
+	action->index = (unsigned char)type;
+	action->x = (signed char)x;
+	action->y = (signed char)y;
+	return TRUE;
+}
+
+//The move before is only finished once the next thing happens, the game only plays its zombie turn after the move's events
+void SimReplayFinish(SimReplay* replay, SimState const* sim){
+	if(replay->pendingMove < 0)return;
+	replay->actions[replay->pendingMove].hash = SimHashState(sim);
+	replay->pendingMove = -1;
+}
+
+_Bool SimReplaySave(SimReplay const* replay, char const* path){
+	FILE* file = OpenFile(path,"wb");
+	if(!file)return FALSE;
+
+	unsigned char header[REPLAY_HEADER_SIZE];
+	memcpy(header,REPLAY_MAGIC,4);
+	PutUint(header + 4,SIM_REPLAY_VERSION,4);
+	PutUint(header + 8,replay->seed,8);
+	PutUint(header + 16,(uint64_t)replay->count,4);
+	_Bool written = fwrite(header,sizeof(header),1,file) == 1;
+
+	for(int i = 0; i < replay->count && written; ++i){
+		SimReplayAction const* action = &replay->actions[i];
+		unsigned char bytes[REPLAY_ACTION_SIZE] = { action->type, action->index, action->rotation, (unsigned char)action->x, (unsigned char)action->y };
+		PutUint(bytes + 5,action->hash,4);
+		written = fwrite(bytes,sizeof(bytes),1,file) == 1;
+	}
+	return fclose(file) == 0 && written;
+}
+
+_Bool SimReplayLoad(SimReplay* replay, char const* path){
+	free(replay->actions);
+	SimReplayInit(replay,0);
+	FILE* file = OpenFile(path,"rb");
+	if(!file)return FALSE;
+
+	unsigned char header[REPLAY_HEADER_SIZE];
+	if(fread(header,sizeof(header),1,file) != 1 || memcmp(header,REPLAY_MAGIC,4) != 0 || GetUint(header + 4,4) != SIM_REPLAY_VERSION){
+		fclose(file);
+		return FALSE;
+	}
+	replay->seed = GetUint(header + 8,8);
+	//The count is checked against what is left of the file before anything is allocated, a broken file could say anything
+	int count = (int)GetUint(header + 16,4);
+	long bytesLeft = GetBytesLeft(file);
+	if(count < 0 || bytesLeft < 0 || count > bytesLeft / REPLAY_ACTION_SIZE){
+		fclose(file);
+		return FALSE;
+	}
+	if(count > 0){
+		replay->actions = malloc(sizeof(SimReplayAction) * (size_t)count);
+		if(!replay->actions){
+			fclose(file);
+			return FALSE;
+		}
+		replay->capacity = count;
+	}
+
+	for(int i = 0; i < count; ++i){
+		unsigned char bytes[REPLAY_ACTION_SIZE];
+		if(fread(bytes,sizeof(bytes),1,file) != 1){
+			fclose(file);
+			SimReplayFree(replay);
+			return FALSE;
+		}
+		SimReplayAction* action = &replay->actions[i];
+		action->type = bytes[0];
+		action->index = bytes[1];
+		action->rotation = bytes[2];
+		action->x = (signed char)bytes[3];
+		action->y = (signed char)bytes[4];
+		action->hash = (uint32_t)GetUint(bytes + 5,4);
+	}
+	replay->count = count;
+	fclose(file);
+	return TRUE;
+}
+
+//The game level starts its game in a different order than SimNewGame, but each part draws from its own random stream
+SimReplayResult SimReplayPlay(SimReplay const* replay, SimState* sim, SimHooks const* hooks){
+	SimReplayResult result = { 0, -1, FALSE };
+	SimNewGame(sim,hooks,replay->seed);
+
+	for(int i = 0; i < replay->count; ++i){
+		SimReplayAction const* action = &replay->actions[i];
+		if(action->type == SIM_REPLAY_SPAWN){
+			EnemyInfo const* prefab = GetPrefabOfType((ZombieType)action->index);
+			if(!prefab){
+				result.mismatchAction = i;
+				result.invalidAction = TRUE;
+				return result;
+			}
+			SimSpawnEnemyInCell(sim,action->x,action->y,prefab);
+			continue;
+		}
+
+		if(!SimStepTurn(sim,action->index,action->rotation,action->x,action->y)){
+			result.mismatchAction = i;
+			result.invalidAction = TRUE;
+			return result;
+		}
+		++result.turns;
+		if(SimHashState(sim) != action->hash){
+			result.mismatchAction = i;
+			return result;
+		}
+	}
+	return result;
+}
+
+//Adds an action to the end, growing the array if it is full. Finishes off the move before it first.
+static SimReplayAction* AddAction(SimReplay* replay, SimState const* sim){
+	SimReplayFinish(replay,sim);
+	if(replay->count == replay->capacity){
+		int capacity = replay->capacity > 0 ? replay->capacity * 2 : FIRST_CAPACITY;
+		SimReplayAction* actions = realloc(replay->actions,sizeof(SimReplayAction) * (size_t)capacity);
+		if(!actions)return NULL;
+		replay->actions = actions;
+		replay->capacity = capacity;
+	}
+	SimReplayAction* action = &replay->actions[replay->count++];
+	memset(action,0,sizeof(SimReplayAction));
+	return action;
+}
+
+static FILE* OpenFile(char const* path, char const* mode){
+#ifdef _MSC_VER
+	FILE* file = NULL;
+	if(fopen_s(&file,path,mode) != 0)return NULL;
+	return file;
+#else
+	return fopen(path,mode);
+#endif
+}
+
+//Returns how many bytes there are from where the file is at to its end, -1 if that can not be told
+static long GetBytesLeft(FILE* file){
+	long at = ftell(file);
+	if(at < 0 || fseek(file,0,SEEK_END) != 0)return -1;
+	long end = ftell(file);
+	if(fseek(file,at,SEEK_SET) != 0 || end < at)return -1;
+	return end - at;
+}
+
+//The scripted spawns only ever use the prefabs, so the type is enough to find the enemy again
+static EnemyInfo const* GetPrefabOfType(ZombieType type){
+	for(int i = 0; i < SimGetEnemyCount(); ++i){
+		if(SimGetEnemyPrefab(i)->type == type) return SimGetEnemyPrefab(i);
+	}
+	return NULL;
+}
+
+static void PutUint(unsigned char* bytes, uint64_t value, int size){
+	for(int i = 0; i < size; ++i) bytes[i] = (unsigned char)(value >> (8 * i));
+}
+
+static uint64_t GetUint(unsigned char const* bytes, int size){
+	uint64_t value = 0;
+	for(int i = 0; i < size; ++i) value |= (uint64_t)bytes[i] << (8 * i);
+	return value;
+}
@@ -0,0 +1,357 @@
+/*!
+@file	  SimSolver.c
+@date     17/10/2026
+@brief    This source file contains the placement solver, see SimSolver.h.
+
+		  A placement's score is what it does right away (damage, kills, walls in front of zombies) plus the average over
+		  the sampled zombie turns after it of: the hearts lost, then either the best placement of the next turn (when
+		  searching deeper) or how close the zombies left on the board are to the player.
+
+		  Placements that hit the same cells with the same hand slot play out exactly the same, so every placement is
+		  reduced to its slot and the bitboard of cells it acts on and only the first of each is searched. Sibling
+		  placements are averaged over the same sampled spawns so the differences between them aren't just noise.
+
+		  The pieces still in the bags are hidden from the player too, only which ones are left can be worked out, so
+		  when searching deeper every sample shuffles them again before the placement is played and draws the next one.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#include <float.h>		// For FLT_MAX
+#include <string.h>		// For memset, memcmp
+#include "SimSolver.h"
+#include "SimThreads.h"
+
+//______________________________________________________________
+// Score weights, a heart is worth 100
+
+#define HEART_VALUE 100.0f
+#define LOSS_VALUE 10000.0f			//Losing (or winning) the game outweighs everything else
+#define WIN_VALUE 10000.0f
+#define DAMAGE_VALUE 3.0f			//Per damage dealt to a zombie
+#define KILL_VALUE 6.0f				//On top of the damage, per zombie killed
+#define WALL_VALUE 2.0f				//Per wall built with a zombie coming down its row
+#define THREAT_VALUE 20.0f			//Per health of a zombie one turn away from the player, falls off with the turns squared
+#define DISCOUNT 0.9f				//Each turn further ahead counts for a bit less
+
+#define DEFAULT_DEPTH 1
+#define DEFAULT_SAMPLES 8
+#define DEFAULT_BEAM_WIDTH 8
+#define DEFAULT_SEED 1
+
+#define DEDUPE_TABLE_SIZE 2048		//Power of two, more than twice SIM_SOLVER_MAX_PLACEMENTS
+
+/*______________________________________________________________
+@brief A distinct placement and what it does right away.
+*/
+typedef struct SolverMove{
+	SimMove move;
+	SimBitboard targets;	//The cells it acts on, the empty cells for walls and the zombies for attacks
+	float immediate;		//Score of what it does right away
+	int damage, kills, walls;
+} SolverMove;
+
+/*______________________________________________________________
+@brief The placements at the top of the search, shared by all the workers. Worker n scores placements n, n + threadCount...
+*/
+typedef struct SolveJob{
+	SimState const* sim;
+	SimSolverSettings const* settings;
+	SolverMove const* moves;
+	SimSolverPlacement* placements;		//One for each move, in the same order
+	int moveCount;
+	int threadCount;
+} SolveJob;
+
+typedef struct SolveWorker{
+	SolveJob* job;
+	int index;
+} SolveWorker;
+
+#pragma region
+static void SolveMoves(void* worker);
+static int GenerateMoves(SimState const* sim, SolverMove* moves);
+static void ScoreImmediate(SimState const* sim, SolverMove* move);
+static float EvaluateMove(SimState const* sim, SolverMove const* move, int depth, uint64_t seed, SimSolverSettings const* settings, float* heartsLost);
+static float BestValue(SimState const* sim, int depth, uint64_t seed, SimSolverSettings const* settings);
+static float Threat(SimState const* sim);
+static void SampleStreams(SimState* sim, uint64_t seed, int sample);
+static void ShuffleUnseenPieces(SimState* sim);
+static uint64_t ChildSeed(uint64_t seed, int sample);
+static uint32_t HashTargets(int slot, SimBitboard const* targets);
+#pragma endregion Forward Declarations
+
+void SimSolverDefaultSettings(SimSolverSettings* settings){
+	settings->depth = DEFAULT_DEPTH;
+	settings->samples = DEFAULT_SAMPLES;
+	settings->beamWidth = DEFAULT_BEAM_WIDTH;
+	settings->threadCount = 0;
+	settings->seed = DEFAULT_SEED;
+}
+
+//Scores the placements on the worker threads, then sorts them best first
+int SimSolve(SimState const* sim, SimSolverSettings const* settings, SimSolverPlacement* placements, int maxPlacements){
+	if(SimIsGameLost(sim) || SimIsGameWon(sim) || maxPlacements <= 0)return 0;
+
+	SolverMove moves[SIM_SOLVER_MAX_PLACEMENTS];
+	SimSolverPlacement scored[SIM_SOLVER_MAX_PLACEMENTS];
+	int moveCount = GenerateMoves(sim,moves);
+
+	SimSolverSettings checked = *settings;
+	if(checked.depth < 1) checked.depth = 1;
+	if(checked.samples < 1) checked.samples = 1;
+	int threadCount = checked.threadCount > 0 ? checked.threadCount : SimGetCoreCount();
+	if(threadCount > moveCount) threadCount = moveCount;
+	if(threadCount > SIM_MAX_THREAD_COUNT) threadCount = SIM_MAX_THREAD_COUNT;
+	if(threadCount < 1) threadCount = 1;
+
+	SolveJob job = { sim, &checked, moves, scored, moveCount, threadCount };
+	SolveWorker workers[SIM_MAX_THREAD_COUNT];
+	for(int i = 0; i < threadCount; ++i){
+		workers[i].job = &job;
+		workers[i].index = i;
+	}
+	SimRunThreads(SolveMoves,workers,sizeof(SolveWorker),threadCount);
+
+	//Insertion sort keeps placements with the same score in the order they were found, so the answer never changes
+	for(int i = 1; i < moveCount; ++i){
+		SimSolverPlacement placement = scored[i];
+		int j = i;
+		while(j > 0 && scored[j-1].score < placement.score){
+			scored[j] = scored[j-1];
+			--j;
+		}
+		scored[j] = placement;
+	}
+
+	int count = moveCount < maxPlacements ? moveCount : maxPlacements;
+	memcpy(placements,scored,sizeof(SimSolverPlacement) * count);
+	return count;
+}
+
+//Scores this worker's share of the placements at the top of the search
+static void SolveMoves(void* worker){
+	SolveJob* job = ((SolveWorker*)worker)->job;
+	for(int i = ((SolveWorker*)worker)->index; i < job->moveCount; i += job->threadCount){
+		SolverMove const* move = &job->moves[i];
+		SimSolverPlacement* placement = &job->placements[i];
+		placement->move = move->move;
+		placement->damage = move->damage;
+		placement->kills = move->kills;
+		placement->walls = move->walls;
+		placement->score = EvaluateMove(job->sim,move,job->settings->depth,job->settings->seed,job->settings,&placement->heartsLost);
+	}
+}
+
+/*______________________________________________________________
+@brief Lists every distinct placement of the hand, in slot, rotation, x, y order.
+@return the number of placements written
+*/
+static int GenerateMoves(SimState const* sim, SolverMove* moves){
+	short table[DEDUPE_TABLE_SIZE];		//Index of the placement in each bucket, -1 if empty
+	memset(table,0xff,sizeof(table));
+	int count = 0;
+
+	for(int slot = 0; slot < HAND_SIZE; ++slot){
+		for(int rotation = 0; rotation < ROTATION_TYPE_LENGTH; ++rotation){
+			for(int x = 0; x < TOTAL_XGRID-1; ++x){
+				for(int y = 0; y < TOTAL_YGRID; ++y){
+					SimBitboard covered, targets;
+					SimGetPieceMask(sim->hand[slot],rotation,x,y,&covered);
+					SimGetPieceTargets(sim,slot,&covered,&targets);
+
+					int bucket = (int)(HashTargets(slot,&targets) & (DEDUPE_TABLE_SIZE-1));
+					_Bool seen = FALSE;
+					while(table[bucket] >= 0){
+						SolverMove const* other = &moves[table[bucket]];
+						if(other->move.slot == slot && memcmp(&other->targets,&targets,sizeof(SimBitboard)) == 0){
+							seen = TRUE;
+							break;
+						}
+						bucket = (bucket + 1) & (DEDUPE_TABLE_SIZE-1);
+					}
+					if(seen) continue;
+
+					table[bucket] = (short)count;
+					SolverMove* move = &moves[count++];
+					move->move.slot = slot;
+					move->move.rotation = rotation;
+					move->move.x = x;
+					move->move.y = y;
+					move->targets = targets;
+					ScoreImmediate(sim,move);
+				}
+			}
+		}
+	}
+	return count;
+}
+
+//Damage and kills for attacks (1 damage a cell, like SimSendDamage), walls in front of a zombie for the wall piece
+static void ScoreImmediate(SimState const* sim, SolverMove* move){
+	SimCell cells[TOTAL_XGRID*TOTAL_YGRID];
+	int cellCount = SimBitboardGetCells(&move->targets,cells);
+	move->damage = move->kills = move->walls = 0;
+
+	if(move->move.slot == 0){
+		SimBitboard zombies;
+		SimGetZombieMask(sim,&zombies);
+		int blocking = 0;
+		for(int i = 0; i < cellCount; ++i){
+			++move->walls;
+			if(zombies.rows[cells[i].y] >> (cells[i].x + 1)) ++blocking;	//A zombie further down the row
+		}
+		move->immediate = WALL_VALUE * blocking;
+		return;
+	}
+
+	for(int i = 0; i < cellCount; ++i){
+		int slot = SimGetSlot(sim,cells[i].x,cells[i].y);
+		++move->damage;
+		if(sim->waveObjects.health[slot] <= 1) ++move->kills;
+	}
+	move->immediate = DAMAGE_VALUE * move->damage + KILL_VALUE * move->kills;
+}
+
+/*______________________________________________________________
+@brief Plays the placement on each sample of what the player can not see, then averages the zombie turns after it,
+	   searching on from each if depth is left.
+@param[out] heartsLost the average hearts lost on the zombie turn
+*/
+static float EvaluateMove(SimState const* sim, SolverMove const* move, int depth, uint64_t seed, SimSolverSettings const* settings, float* heartsLost){
+	SimState played = *sim;
+	played.hooks.OnEvent = NULL;
+	//The pieces drawn only matter to a deeper search, else the placement is played once for every sample
+	_Bool searchOn = depth > 1;
+	if(!searchOn) SimPlayPiece(&played,move->move.slot,move->move.rotation,move->move.x,move->move.y);
+
+	float total = 0.0f;
+	int totalHeartsLost = 0;
+	for(int sample = 0; sample < settings->samples; ++sample){
+		//The pieces left are shuffled before the placement when searching on, playing it draws the next one
+		SimState next = played;
+		SampleStreams(&next,seed,sample);
+		if(searchOn){
+			ShuffleUnseenPieces(&next);
+			SimPlayPiece(&next,move->move.slot,move->move.rotation,move->move.x,move->move.y);
+		}
+		int hearts = next.hearts;
+		SimEndTurn(&next);
+
+		int lost = hearts - next.hearts;
+		float value = -HEART_VALUE * lost;
+		if(SimIsGameLost(&next)) value -= LOSS_VALUE;
+		else if(SimIsGameWon(&next)) value += WIN_VALUE;
+		else if(searchOn) value += DISCOUNT * BestValue(&next,depth-1,ChildSeed(seed,sample),settings);
+		else value -= Threat(&next);
+
+		total += value;
+		totalHeartsLost += lost;
+	}
+
+	*heartsLost = (float)totalHeartsLost / settings->samples;
+	return move->immediate + total / settings->samples;
+}
+
+//The score of the best of the beamWidth placements that do the most right away
+static float BestValue(SimState const* sim, int depth, uint64_t seed, SimSolverSettings const* settings){
+	SolverMove moves[SIM_SOLVER_MAX_PLACEMENTS];
+	int count = GenerateMoves(sim,moves);
+	int beam = (settings->beamWidth > 0 && settings->beamWidth < count) ? settings->beamWidth : count;
+
+	//Selection sort, only the first beam placements are needed
+	for(int i = 0; i < beam; ++i){
+		int best = i;
+		for(int j = i + 1; j < count; ++j){
+			if(moves[j].immediate > moves[best].immediate) best = j;
+		}
+		if(best != i){
+			SolverMove temp = moves[i];
+			moves[i] = moves[best];
+			moves[best] = temp;
+		}
+	}
+
+	float bestValue = -FLT_MAX;
+	for(int i = 0; i < beam; ++i){
+		float heartsLost;
+		float value = EvaluateMove(sim,&moves[i],depth,seed,settings,&heartsLost);
+		if(value > bestValue) bestValue = value;
+	}
+	return bestValue;
+}
+
+/*______________________________________________________________
+@brief How soon the zombies on the board will reach the player, weighted by how much health they have.
+	   Walls in the way add the turns it takes the zombie to break them.
+*/
+static float Threat(SimState const* sim){
+	SimWaveObjects const* objects = &sim->waveObjects;
+	float threat = 0.0f;
+	for(int i = 0; i < sim->liveCount; ++i){
+		int slot = sim->liveSlots[i];
+		if(objects->type[slot] == WALL) continue;
+		SimEnemyStats const* stats = SimGetEnemyStats((ZombieType)objects->type[slot]);
+		int speed = stats->MovementSpeed > 0 ? stats->MovementSpeed : 1;
+		int damage = stats->damage > 0 ? stats->damage : 1;
+		int x = objects->x[slot];
+		int y = objects->y[slot];
+
+		int turns = x / speed + 1 + (stats->MovementSpeed <= 0);	//Graves have to hatch first
+		uint32_t walls = sim->typeMasks[WALL].rows[y] & ((1u << x) - 1u);
+		for(int wallX = 0; walls; ++wallX, walls >>= 1){
+			if(!(walls & 1u)) continue;
+			int wallHealth = objects->health[SimGetSlot(sim,wallX,y)];
+			turns += (wallHealth + damage - 1) / damage;
+		}
+		threat += (float)objects->health[slot] / (float)(turns * turns);
+	}
+	return THREAT_VALUE * threat;
+}
+
+//Swaps every random stream for one made from the sample, so no real future spawns or bag shuffles are used
+static void SampleStreams(SimState* sim, uint64_t seed, int sample){
+	uint64_t sampleSeed = seed + (uint64_t)(sample + 1) * 0x9E3779B97F4A7C15ull;
+	SimRandomSeed(&sim->random[SIM_RANDOM_BAG],sampleSeed,SIM_RANDOM_BAG);
+	SimRandomSeed(&sim->random[SIM_RANDOM_WAVE],sampleSeed,SIM_RANDOM_WAVE);
+	SimRandomSeed(&sim->random[SIM_RANDOM_SPAWN],sampleSeed,SIM_RANDOM_SPAWN);
+	SimRandomSeed(&sim->random[SIM_RANDOM_GRAVE],sampleSeed,SIM_RANDOM_GRAVE);
+}
+
+//Fisher-Yates with the sample's bag stream over the pieces not drawn yet: the rest of the bag being drawn from and the
+//whole of the others. They are sorted first, so the samples only depend on which pieces are left, never on the order
+//the game really has them in.
+static void ShuffleUnseenPieces(SimState* sim){
+	for(int bag = 0; bag < TOTAL_BAGS; ++bag){
+		PieceType* pieces = sim->piecesBag[bag];
+		int first = bag == sim->currentBag ? sim->currentIndex : 0;
+		for(int index = first + 1; index < TOTAL_PIECES; ++index){
+			PieceType piece = pieces[index];
+			int insertIndex = index;
+			for(; insertIndex > first && pieces[insertIndex - 1] > piece; --insertIndex) pieces[insertIndex] = pieces[insertIndex - 1];
+			pieces[insertIndex] = piece;
+		}
+		for(int index = TOTAL_PIECES - 1; index > first; --index){
+			int swapIndex = SimRandomRange(&sim->random[SIM_RANDOM_BAG],first,index);
+			PieceType piece = pieces[swapIndex];
+			pieces[swapIndex] = pieces[index];
+			pieces[index] = piece;
+		}
+	}
+}
+
+//The seed of the turn after a sample, every path down the search gets its own spawns
+static uint64_t ChildSeed(uint64_t seed, int sample){
+	return seed * 6364136223846793005ull + (uint64_t)sample + 1442695040888963407ull;
+}
+
+//FNV-1a over the slot and the rows
+static uint32_t HashTargets(int slot, SimBitboard const* targets){
+	uint32_t hash = 2166136261u ^ (uint32_t)slot;
+	hash *= 16777619u;
+	for(int y = 0; y < TOTAL_YGRID; ++y){
+		hash ^= targets->rows[y];
+		hash *= 16777619u;
+	}
+	return hash;
+}
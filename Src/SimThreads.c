@@ -0,0 +1,155 @@
+/*!
+@file	  SimThreads.c
+@date     17/10/2026
+@brief    This source file contains the threads of the headless tools and the solver, see SimThreads.h.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#include <stdlib.h>
+#include "SimThreads.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+/*______________________________________________________________
+@brief What each started thread needs to run its job.
+*/
+typedef struct SimThreadStart{
+	SimThreadJob job;
+	void* item;
+} SimThreadStart;
+
+/*______________________________________________________________
+@brief A background thread, with what it was started with as it needs it while it runs.
+*/
+struct SimThread{
+	SimThreadStart start;
+#ifdef _WIN32
+	HANDLE handle;
+#else
+	pthread_t handle;
+#endif
+};
+
+#ifdef _WIN32
+static DWORD WINAPI ThreadMain(LPVOID start){
+	((SimThreadStart*)start)->job(((SimThreadStart*)start)->item);
+	return 0;
+}
+
+int SimGetCoreCount(void){
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+}
+
+void SimRunThreads(SimThreadJob job, void* items, size_t itemSize, int count){
+	HANDLE threads[SIM_MAX_THREAD_COUNT];
+	SimThreadStart starts[SIM_MAX_THREAD_COUNT];
+	if(count > SIM_MAX_THREAD_COUNT) count = SIM_MAX_THREAD_COUNT;
+	for(int i = 1; i < count; ++i){
+		starts[i].job = job;
+		starts[i].item = (char*)items + itemSize * i;
+		threads[i] = CreateThread(NULL,0,ThreadMain,&starts[i],0,NULL);
+	}
+	if(count > 0) job(items);
+	for(int i = 1; i < count; ++i){
+		if(!threads[i]){
+			job(starts[i].item);	//Could not get a thread, run it here instead
+			continue;
+		}
+		WaitForSingleObject(threads[i],INFINITE);
+		CloseHandle(threads[i]);
+	}
+}
+
+SimThread* SimStartThread(SimThreadJob job, void* item){
+	SimThread* thread = malloc(sizeof(SimThread));
+	if(thread){
+		thread->start.job = job;
+		thread->start.item = item;
+		thread->handle = CreateThread(NULL,0,ThreadMain,&thread->start,0,NULL);
+		if(thread->handle) return thread;
+		free(thread);
+	}
+	job(item);		//Could not get a thread, run it here instead
+	return NULL;
+}
+
+void SimJoinThread(SimThread* thread){
+	if(!thread) return;
+	WaitForSingleObject(thread->handle,INFINITE);
+	CloseHandle(thread->handle);
+	free(thread);
+}
+
+int SimAtomicLoad(int volatile* value){
+	return (int)InterlockedCompareExchange((LONG volatile*)value,0,0);
+}
+
+void SimAtomicStore(int volatile* value, int newValue){
+	InterlockedExchange((LONG volatile*)value,newValue);
+}
+#else
+static void* ThreadMain(void* start){
+	((SimThreadStart*)start)->job(((SimThreadStart*)start)->item);
+	return NULL;
+}
+
+int SimGetCoreCount(void){
+	long count = sysconf(_SC_NPROCESSORS_ONLN);
+	return count > 0 ? (int)count : 1;
+}
+
+void SimRunThreads(SimThreadJob job, void* items, size_t itemSize, int count){
+	pthread_t threads[SIM_MAX_THREAD_COUNT];
+	SimThreadStart starts[SIM_MAX_THREAD_COUNT];
+	_Bool started[SIM_MAX_THREAD_COUNT] = { 0 };
+	if(count > SIM_MAX_THREAD_COUNT) count = SIM_MAX_THREAD_COUNT;
+	for(int i = 1; i < count; ++i){
+		starts[i].job = job;
+		starts[i].item = (char*)items + itemSize * i;
+		started[i] = pthread_create(&threads[i],NULL,ThreadMain,&starts[i]) == 0;
+	}
+	if(count > 0) job(items);
+	for(int i = 1; i < count; ++i){
+		if(!started[i]){
+			job(starts[i].item);	//Could not get a thread, run it here instead
+			continue;
+		}
+		pthread_join(threads[i],NULL);
+	}
+}
+
+SimThread* SimStartThread(SimThreadJob job, void* item){
+	SimThread* thread = malloc(sizeof(SimThread));
+	if(thread){
+		thread->start.job = job;
+		thread->start.item = item;
+		if(pthread_create(&thread->handle,NULL,ThreadMain,&thread->start) == 0) return thread;
+		free(thread);
+	}
+	job(item);		//Could not get a thread, run it here instead
+	return NULL;
+}
+
+void SimJoinThread(SimThread* thread){
+	if(!thread) return;
+	pthread_join(thread->handle,NULL);
+	free(thread);
+}
+
+int SimAtomicLoad(int volatile* value){
+	return __atomic_load_n(value,__ATOMIC_ACQUIRE);
+}
+
+void SimAtomicStore(int volatile* value, int newValue){
+	__atomic_store_n(value,newValue,__ATOMIC_RELEASE);
+}
+#endif
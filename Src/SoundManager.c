@@ -4,14 +4,33 @@
 @date     24/11/2022
 @brief    This header file contains the information about the SoundManger and the functions that can be called for it. 
 
+          The clips are kept in a table indexed by their Clip, so finding one is a lookup. Sounds are not played when
+          asked for, they are queued for the frame and played at the end of it (PlayQueuedSounds). A clip asked for
+          many times in a frame, like every zombie moving on a big wave, is played once and louder. A clip only has
+          so many voices at once, CProcessing does not say when a sound ends so a voice is counted as playing for the
+          length of its wav file, and a clip with all its voices playing is not played again until one ends.
+
 @license  Copyright  2022 DigiPen, All rights reserved.
 ________________________________________________________________________________________________*/
 
 #include "SoundManager.h"
+#include "AssetLoader.h"
+#include <math.h>           //sqrtf, for how much louder a clip asked for many times is
+#include <string.h>
+
+#define SOUND_DEFAULT_LENGTH 1.f    //Seconds a voice is counted as playing if the length of its file is not known
 
-//Sound Array 
+//Sounds asked for in the frame, played at the end of it
+typedef struct SoundRequest{
+    int count;                  //Times it was asked for
+    CP_SOUND_GROUP group;       //Of the first time it was asked for
+    _Bool isPitched;            //If any of them was PlaySoundEx
+} SoundRequest;
+
+//Sound Array, indexed by clip name
 SoundClip SoundArray[SOUNDCOUNT];          //Assuming we have 25 sounds LMAO.
-int SoundIndex = 0;
+SoundRequest soundRequests[SOUNDCOUNT];
+float voiceEnds[SOUNDCOUNT][SOUND_MAX_VOICES];     //When each voice of the clip stops playing, in CP_System_GetSeconds
 
 float volume =1.0f;     //original sound, no modification
 float pitch = 1.0f;     
@@ -21,38 +40,50 @@ _Bool toggleMuteAll = FALSE;
 _Bool toggleMuteSFX = FALSE;
 _Bool toggleMuteBGM = FALSE;
 
+#pragma region
+void LoadSoundClip(char const* path, Clip clipName, float volumeModifier, int maxVoices);
+void QueueSound(Clip clipName, CP_SOUND_GROUP group, _Bool isPitched);
+#pragma endregion Forward Declarations
 
-//Inits sounds to soundclip array.
+//Inits sounds to soundclip array, and plays the queued sounds at the end of every frame from now on.
 void InitSoundManager(void){
-    AddSoundToArray(CP_Sound_Load("Assets/GameBGM.wav"),GAMEBGM,.8f);
-    AddSoundToArray(CP_Sound_Load("Assets/MainMenu.wav"),MAINMENU,.1f);
-    AddSoundToArray(CP_Sound_Load("Assets/EnemyDeathSound.wav"),ENEMYDEATH,1);
-    AddSoundToArray(CP_Sound_Load("Assets/TetrominoExplode.wav"),TETROMINOEXPLODE,1);
-    AddSoundToArray(CP_Sound_Load("Assets/Nuke.wav"),NUKE,1.2f);
-    AddSoundToArray(CP_Sound_Load("Assets/LoseHealth.wav"),LOSE,1.f);
-    AddSoundToArray(CP_Sound_Load("Assets/WinSound.wav"),WIN,1.f);
-    AddSoundToArray(CP_Sound_Load("Assets/MouseClick.wav"),MOUSECLICK,1.f);
-    AddSoundToArray(CP_Sound_Load("Assets/GameOver.wav"),GAMEOVER,.1f);
-    AddSoundToArray(CP_Sound_Load("Assets/GainHealth.wav"), GAINHEART,1.f);
-    AddSoundToArray(CP_Sound_Load("Assets/ZombieSpawn.wav"), ZOMBIESPAWN,.6f);
-    AddSoundToArray(CP_Sound_Load("Assets/ZombieMove.wav"), ZOMBIEMOVE, 1.f);
-    AddSoundToArray(CP_Sound_Load("Assets/WallBuild.wav"), WALLBUILD, .8f);
-    AddSoundToArray(CP_Sound_Load("Assets/GraveSpawn.wav"), GRAVESPAWN, .7f);
-    AddSoundToArray(CP_Sound_Load("Assets/GameWin.wav"), GAMEWIN, .7f);
-    AddSoundToArray(CP_Sound_Load("Assets/Thud.wav"), THUD, .9f);
-    AddSoundToArray(CP_Sound_Load("Assets/WallBreak.wav"), WALLBREAK, .8f);
+    LoadSoundClip("Assets/GameBGM.wav",GAMEBGM,.8f,1);
+    LoadSoundClip("Assets/MainMenu.wav",MAINMENU,.1f,1);
+    LoadSoundClip("Assets/EnemyDeathSound.wav",ENEMYDEATH,1,SOUND_MAX_VOICES);
+    LoadSoundClip("Assets/TetrominoExplode.wav",TETROMINOEXPLODE,1,SOUND_MAX_VOICES);
+    LoadSoundClip("Assets/Nuke.wav",NUKE,1.2f,2);
+    LoadSoundClip("Assets/LoseHealth.wav",LOSE,1.f,SOUND_MAX_VOICES);
+    LoadSoundClip("Assets/WinSound.wav",WIN,1.f,1);
+    LoadSoundClip("Assets/MouseClick.wav",MOUSECLICK,1.f,SOUND_MAX_VOICES);
+    LoadSoundClip("Assets/GameOver.wav",GAMEOVER,.1f,1);
+    LoadSoundClip("Assets/GainHealth.wav", GAINHEART,1.f,SOUND_MAX_VOICES);
+    LoadSoundClip("Assets/ZombieSpawn.wav", ZOMBIESPAWN,.6f,SOUND_MAX_VOICES);
+    LoadSoundClip("Assets/ZombieMove.wav", ZOMBIEMOVE, 1.f,SOUND_MAX_VOICES);
+    LoadSoundClip("Assets/WallBuild.wav", WALLBUILD, .8f,SOUND_MAX_VOICES);
+    LoadSoundClip("Assets/GraveSpawn.wav", GRAVESPAWN, .7f,SOUND_MAX_VOICES);
+    LoadSoundClip("Assets/GameWin.wav", GAMEWIN, .7f,1);
+    LoadSoundClip("Assets/Thud.wav", THUD, .9f,SOUND_MAX_VOICES);
+    LoadSoundClip("Assets/WallBreak.wav", WALLBREAK, .8f,SOUND_MAX_VOICES);
+
+    CP_Engine_SetPostUpdateFunction(PlayQueuedSounds);
+}
 
+//Gets the sound from the asset loader and adds it to the array with the length of its wav file.
+void LoadSoundClip(char const* path, Clip clipName, float volumeModifier, int maxVoices){
+    AddSoundToArray(GetAssetSound(path),clipName,volumeModifier,GetAssetSoundLength(path),maxVoices);
 }
 
 //Adds sound to array of soundclips
-void AddSoundToArray(CP_Sound sound,Clip clipName,float volumeModifier){
+void AddSoundToArray(CP_Sound sound,Clip clipName,float volumeModifier,float length,int maxVoices){
+    if((unsigned)clipName >= SOUNDCOUNT) return;
     SoundClip newSoundClip = {
         .sound = sound,
         .volumeModifier = volumeModifier,
-        .clipName = clipName
+        .clipName = clipName,
+        .length = length > 0 ? length : SOUND_DEFAULT_LENGTH,
+        .maxVoices = maxVoices < 1 ? 1 : maxVoices > SOUND_MAX_VOICES ? SOUND_MAX_VOICES : maxVoices
     };
-    SoundArray[SoundIndex] = newSoundClip;
-    SoundIndex++;
+    SoundArray[clipName] = newSoundClip;
 }
 
 //Stops the current BGM playing and plays provided clip as BGM
@@ -63,32 +94,57 @@ void PlayBGM(Clip clipName){
 
 //Returns sound from SoundArray based off clip name
 CP_Sound GetSound(Clip clipName){
-    for(short i=0; i<SoundIndex; ++i){
-        if (SoundArray[i].clipName == clipName){
-            return SoundArray[i].sound;
-        }
-    }
-    return NULL;
+    return (unsigned)clipName < SOUNDCOUNT ? SoundArray[clipName].sound : NULL;
 }
 
 //Function that returns the current volume of the clip name. Returns 0 if clip is null.
 float GetVolume(Clip clipName){
-    for(short i=0; i<SoundIndex; ++i){
-        if (SoundArray[i].clipName == clipName){
-            return SoundArray[i].volumeModifier;
-        }
-    }
-    return 0;
+    return (unsigned)clipName < SOUNDCOUNT ? SoundArray[clipName].volumeModifier : 0;
 }
 
-//Plays sound set in the enum. Only use either group_SFX or group_MUSIC (Includes pitch variance)
+//Queues sound set in the enum for the end of the frame. Only use either group_SFX or group_MUSIC (Includes pitch variance)
 void PlaySoundEx(Clip clipName,CP_SOUND_GROUP group){
-    CP_Sound_PlayAdvanced(GetSound(clipName),GetVolume(clipName),pitch+(CP_Random_Gaussian()/4.f),FALSE,group);
+    QueueSound(clipName,group,TRUE);
 }
 
-//Plays sound set in the enum. Only use either group_SFX or group_MUSIC
+//Queues sound set in the enum for the end of the frame. Only use either group_SFX or group_MUSIC
 void PlaySound(Clip clipName,CP_SOUND_GROUP group){
-    CP_Sound_PlayAdvanced(GetSound(clipName),GetVolume(clipName),pitch,FALSE,group);
+    QueueSound(clipName,group,FALSE);
+}
+
+//Adds a request for the clip this frame, the same clip asked for again is counted in the same request.
+void QueueSound(Clip clipName, CP_SOUND_GROUP group, _Bool isPitched){
+    if(!GetSound(clipName)) return;
+    SoundRequest* request = &soundRequests[clipName];
+    if(request->count++ == 0){
+        request->group = group;
+        request->isPitched = isPitched;
+    }
+    else request->isPitched |= isPitched;
+}
+
+//Plays the sounds queued this frame, one voice a clip, louder the more times it was asked for. Clips with all their
+//voices still playing are left out.
+void PlayQueuedSounds(void){
+    float now = CP_System_GetSeconds();
+    for(int clip = 0; clip < SOUNDCOUNT; ++clip){
+        SoundRequest* request = &soundRequests[clip];
+        if(request->count == 0) continue;
+        SoundClip const* soundClip = &SoundArray[clip];
+
+        //A voice that ended can be used again
+        for(int voice = 0; voice < soundClip->maxVoices; ++voice){
+            if(voiceEnds[clip][voice] > now) continue;
+            voiceEnds[clip][voice] = now + soundClip->length;
+
+            //N of the same sound at once are about sqrt(N) times as loud when they are not in step
+            float gain = fminf(sqrtf((float)request->count),SOUND_MAX_GAIN);
+            float voicePitch = request->isPitched ? pitch+(CP_Random_Gaussian()/4.f) : pitch;
+            CP_Sound_PlayAdvanced(soundClip->sound,soundClip->volumeModifier*gain,voicePitch,FALSE,request->group);
+            break;
+        }
+        request->count = 0;
+    }
 }
 
 //Function that sets sfx volume. 1.0f default, 0.f is silence.
@@ -118,14 +174,15 @@ void ToggleMuteBGM(void){
     toggleMuteSFX ? CP_Sound_PauseGroup(CP_SOUND_GROUP_MUSIC) : CP_Sound_ResumeGroup(CP_SOUND_GROUP_MUSIC);
 }
 
-//Function that stops all sounds from playing
+//Function that stops all sounds from playing, and the ones queued this frame
 void StopAllSounds(void){
     CP_Sound_StopAll();
+    memset(soundRequests, 0, sizeof(soundRequests));
+    memset(voiceEnds, 0, sizeof(voiceEnds));
 }
 
 //Stops all sounds and frees them. Remember to call on exit.
 void KillSoundManager(void){
-    CP_Sound_StopAll();
-    SoundIndex = 0;
+    StopAllSounds();
     memset(SoundArray, 0, sizeof(SoundClip) * SOUNDCOUNT);
 }
\ No newline at end of file
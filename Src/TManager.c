@@ -3,117 +3,30 @@
 @author	  Ang Jiawei Jarrett (a.jiaweijarrett@digipen.edu)
 @date     18/11/2022
 @brief    TManager's header file handles the interfacing of Tetris pieces and any other files in the project; 
-          This source file contains the implementation of those functions, and stores the array of all the 
-          data of the current tetris pieces in play. There are
+          This source file contains the implementation of those functions. There are
 
           TManagerInit - Initialized at the start of the game level so there'll actually be Tetris Pieces to use.
 
-          DrawFromBag - Draws the next Tetris Piece from the queue, note: the queue will never run out of pieces.
-          FillBag - Fills the chosen bag with a copy of every Tetris Piece possible.
-          ShuffleBag - Shuffles the piece order in the chosen bag, the Fisher�Yates shuffle is used for the shuffling.
-          RandInt - Returns a random int. Used by ShuffleBag to shuffle the pieces Fisher�Yates shuffle.
-
           CreatePiece - Creates a Tetris Piece based on the chosen type.
 
+          The Tetris queue itself (the bags and the shuffling) is part of the game state in SimCore.c.
+
 @license  Copyright © 2022 DigiPen, All rights reserved.
 ________________________________________________________________________________________________________*/
 
-#include <stdlib.h>     // For srand & rand
 #include "TManager.h"
+#include "WaveSystem.h" // For the game state holding the Tetris queue
 #include "ColorTable.h" // For tetris colors
 
-// Markers for which piece is the next piece in queue
-int current_bag;
-int current_index;
-
-PieceType pieces_bag[TOTAL_BAGS][TOTAL_PIECES]; // The Tetris Pieces queue
-
-#pragma region
-void FillBag(int bag);
-void ShuffleBag(int bag);
-int RandInt(int min, int max);
-TetrisPiece CreatePiece(PieceType type);
-#pragma endregion Forward Declarations
-
 //______________________________________________________________
 // All "public" functions (Basically those in the TManager.h)
 
 /*______________________________________________________________
-@brief Please initialize this at the start of the game level so there'll actually be Tetris Pieces to use.
-
-@param[in] rand_seed - Which seed to use to randomly spawn the Tetris pieces. (Use DEFAULT_SPAWN_SEED for debugging)
-*/
-void TManagerInit(int rand_seed){
-    current_bag = current_index = 0;
-
-    srand(rand_seed);
-    CP_Random_Seed(rand_seed);
-
-    for (int index = 0; index < TOTAL_BAGS; ++index) {
-        FillBag(index);
-        ShuffleBag(index);
-    }
-}
-
-/*______________________________________________________________
-@brief Draws the next Tetris Piece from the queue, the queue will never run out of pieces.
-
-@return TetrisPiece - The next Tetris Piece in queue.
-*/
-TetrisPiece DrawFromBag(void){
-    PieceType drawn_piece = pieces_bag[current_bag][current_index++];
-
-    // If the queue is running low, swap bags and shuffle in more pieces.
-    if (current_index > TOTAL_PIECES - 1) {
-        ShuffleBag(current_bag);
-        current_bag = (current_bag + 1) % TOTAL_BAGS;
-        current_index = 0;
-    }
-
-    return CreatePiece(drawn_piece);
-}
-
-//______________________________________________________________
-// Tetris Spawning functions
-
-/*______________________________________________________________
-@brief Fills the chosen bag with a copy of every Tetris Piece possible.
-
-@param[in] bag - The index of the bag to fill, the bags are placed in an array.
-*/
-void FillBag(int bag){
-    PieceType *current_bag = &pieces_bag[bag][0];
-    for (int index = 0; index < TOTAL_PIECES; ++index) {
-        *(current_bag + index) = (PieceType)index;
-    }
-}
-
-/*______________________________________________________________
-@brief Shuffles the chosen bag, the Fisher�Yates shuffle is used for the shuffling process.
-
-@param[in] bag - The index of the bag to shuffle, the bags are placed in an array.
-*/
-void ShuffleBag(int bag){
-    PieceType (*current_bag) = &pieces_bag[bag][0];
-    for (int index = TOTAL_PIECES - 1; index > 0; --index) {
-        int rand_index = RandInt(0, index);
-
-        PieceType rand_piece = current_bag[rand_index];
-        current_bag[rand_index] = current_bag[index];
-        current_bag[index] = rand_piece;
-    }
-}
-
-/*______________________________________________________________
-@brief Returns a random int. Used by ShuffleBag to shuffle the pieces Fisher�Yates shuffle.
-
-@param[in] min - The smallest number (inclusive)
-@param[in] max - The largest number (inclusive)
-
-@return int - A random int between min and max
+@brief Please initialize this at the start of the game level (after InitWaveSystem) so there'll actually be Tetris Pieces to use.
+       The pieces are shuffled with the seed given to InitWaveSystem.
 */
-int RandInt(int min, int max){
-    return rand() % (max - min + 1) + min;
+void TManagerInit(void){
+    SimFillBags(GetGameState());
 }
 
 /*______________________________________________________________
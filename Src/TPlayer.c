@@ -3,7 +3,7 @@
 @author	  Ang Jiawei Jarrett (a.jiaweijarrett@digipen.edu)
 @date     18/11/2022
 @brief    This source file handles the rendering and storing of piece information of the Tetris pieces in the player's
-		  hand and the peek queue. There are 7 functions in this file,
+		  hand and the peek queue. There are 9 functions in this file,
 
 		  TPlayerInit - Needs to be called at the start of the game level so that the player has pieces to play with.
 
@@ -12,7 +12,9 @@
           RemovePieceHeldFromHand - When a Tetris Piece is dropped onto the grid, remove it from the player's hand.
 
 		  RemovePieceHeldFromHand - When a Tetris Piece is dropped onto the grid, remove the piece and update the player's hand.
-		  ArrayShiftFowardFrom - Used by RemovePieceHeldFromHand to shift the pieces to the right of the piece used leftwards.
+		  RefreshHand - Rebuilds the pieces shown from the hand in the game state, used after a piece is played or a snapshot is restored.
+		  GetHandSlotPosition - Returns the top left of a slot in the player's hand, used by the hint to point at it.
+		  UpdateHandPieces - Used by TPlayerInit and RemovePieceHeldFromHand to match the pieces shown to the hand in the game state.
 		  FreeIconImages - Needs to be called on the exit of game level, frees the icons for the attack and defend pieces.
 
 @license  Copyright  2022 DigiPen, All rights reserved.
@@ -23,10 +25,13 @@ ________________________________________________________________________________
 #include "Utils.h"			// For click detection
 #include "SoundManager.h"	// For sound on Tetris interaction
 
-#include "TManager.h"		// For drawing new Tetris pieces
+#include "TManager.h"		// For creating the Tetris pieces to render
+#include "WaveSystem.h"		// For the hand in the game state
 #include "TPlayer.h"	
 #include "TPlayerHeld.h"	// For handling the piece held
 #include "GameLoop.h"		// For player's turn event
+#include "RenderQueue.h"	// For drawing the slots and tiles together
+#include "AssetLoader.h"	// For the icons
 
 PlayerHandSlot hand[HAND_SIZE];			// Array containing information of all pieces on hand
 PlayerHandSlot peek_hand[PEEK_SIZE];	// Array containing information of next few pieces in queue
@@ -37,7 +42,7 @@ CP_Image attack_icon, shield_icon;
 
 #pragma region
 void RecalculateHandRenderPositions(void);
-void ArrayShiftFowardFrom(PlayerHandSlot* array, int start, int end);
+void UpdateHandPieces(void);
 #pragma endregion Forward Declarations
 
 //______________________________________________________________
@@ -49,19 +54,9 @@ void ArrayShiftFowardFrom(PlayerHandSlot* array, int start, int end);
 */
 void TPlayerInit(void){
 	//______________________________________________________________
-	// Fill the player's hand and peek queue
-	// First, fill the player's hand
-	PlayerHandSlot* current;
-	for (int index = 0; index < HAND_SIZE; ++index) {
-		current = &hand[index];
-		current->piece = DrawFromBag();
-	}
-
-	// Second, fill the peek's queue (Basically the upcoming pieces)
-	for (int index = 0; index < PEEK_SIZE; ++index) {
-		current = &peek_hand[index];
-		current->piece = DrawFromBag();
-	}
+	// Fill the player's hand and peek queue (Basically the upcoming pieces)
+	SimFillHand(GetGameState());
+	UpdateHandPieces();
 
 	// Update the positions to draw all the slots
 	RecalculateHandRenderPositions();
@@ -73,8 +68,8 @@ void TPlayerInit(void){
 	TPlayerHeldInit();
 
 	// Load the icons
-	attack_icon = CP_Image_Load("Assets/AttackIcon.png");
-	shield_icon = CP_Image_Load("Assets/ShieldIcon.png");
+	attack_icon = GetAssetImage("Assets/AttackIcon.png");
+	shield_icon = GetAssetImage("Assets/ShieldIcon.png");
 	LoadIconImages(attack_icon, shield_icon); // For player held piece
 }
 
@@ -113,41 +108,33 @@ void TPlayerProcessInput(void){
 void RenderHand(void){
 	PlayerHandSlot* current;
 
-	CP_Settings_RectMode(CP_POSITION_CORNER);
-
 	//______________________________________________________________
-	// Render each piece in the player's hand
+	// Queue each piece in the player's hand, the slots, icons and tiles are each drawn together on the flush
 	for (int index = 0; index < HAND_SIZE; ++index) {
 		current = &hand[index];
 
-		CP_Settings_StrokeWeight(hand_tile_stroke);
-
 		// Render the background square surrounding each piece
-		CP_Settings_Fill(MENU_BLACK);
-		CP_Settings_Stroke(current->piece.color);
-		CP_Graphics_DrawRect(current->pos.x, current->pos.y, hand_slot_length, hand_slot_length);
+		RenderQueueRect(LAYER_HAND_SLOTS, current->pos.x, current->pos.y, hand_slot_length, hand_slot_length,
+			MENU_BLACK, current->piece.color, hand_tile_stroke);
 
 		// Render the icon in the top-left corner
 		if (index == 0) { // If wall piece
-			CP_Image_Draw(shield_icon, current->icon_pos.x, current->icon_pos.y, text_icon_size.x, text_icon_size.y, 255);
+			RenderQueueImage(LAYER_HAND_ICONS, shield_icon, current->icon_pos.x, current->icon_pos.y, text_icon_size.x, text_icon_size.y, 255);
 		}
 		else { // If attack piece
-			CP_Image_Draw(attack_icon, current->icon_pos.x, current->icon_pos.y, text_icon_size.x, text_icon_size.y, 255);
+			RenderQueueImage(LAYER_HAND_ICONS, attack_icon, current->icon_pos.x, current->icon_pos.y, text_icon_size.x, text_icon_size.y, 255);
 		}
 
 		if (IsThisPieceHeld(&current->piece)) continue; // Don't render the piece if it's held
 
-		// Settings for tile rendering
-		CP_Settings_StrokeWeight(hand_tile_stroke);
-		CP_Settings_Fill(current->piece.color);
-		CP_Settings_Stroke(current->piece.color_stroke);
 		// Render each tile in the Tetris Piece
 		float* x_screen_length = &current->piece.x_screen_length;
 		float* y_screen_length = &current->piece.y_screen_length;
 		for (int index_x = 0; index_x < SHAPE_BOUNDS; ++index_x) {
 			for (int index_y = 0; index_y < SHAPE_BOUNDS; ++index_y) {
 				if (current->piece.shape[index_x][index_y]) {
-					CP_Graphics_DrawRect(current->piece.draw_pos.x + index_x * *x_screen_length, current->piece.draw_pos.y + index_y * *y_screen_length, *x_screen_length, *y_screen_length);
+					RenderQueueRect(LAYER_HAND_TILES, current->piece.draw_pos.x + index_x * *x_screen_length, current->piece.draw_pos.y + index_y * *y_screen_length,
+						*x_screen_length, *y_screen_length, current->piece.color, current->piece.color_stroke, hand_tile_stroke);
 				}
 			}
 		}
@@ -163,29 +150,25 @@ void RenderHand(void){
 	for (int index = 0; index < PEEK_SIZE; ++index) {
 		current = &peek_hand[index];
 
-		CP_Settings_StrokeWeight(peek_tile_stroke);
-
 		// Render the background square surrounding each piece
-		CP_Settings_Fill(MENU_BLACK);
-		CP_Settings_Stroke(MENU_GRAY);
-		CP_Graphics_DrawRect(current->pos.x, current->pos.y, peek_slot_length, peek_slot_length);
+		RenderQueueRect(LAYER_HAND_SLOTS, current->pos.x, current->pos.y, peek_slot_length, peek_slot_length,
+			MENU_BLACK, MENU_GRAY, peek_tile_stroke);
 
-		// Settings for tile rendering
-		CP_Settings_Fill(MENU_GRAY);
-		CP_Settings_Stroke(current->piece.color_stroke);
 		// Render each tile in the Tetris Piece
 		float* x_screen_length = &current->piece.x_screen_length;
 		float* y_screen_length = &current->piece.y_screen_length;
 		for (int index_x = 0; index_x < SHAPE_BOUNDS; ++index_x) {
 			for (int index_y = 0; index_y < SHAPE_BOUNDS; ++index_y) {
 				if (current->piece.shape[index_x][index_y]) {
-					CP_Graphics_DrawRect(current->piece.draw_pos.x + index_x * *x_screen_length, current->piece.draw_pos.y + index_y * *y_screen_length, *x_screen_length, *y_screen_length);
+					RenderQueueRect(LAYER_HAND_TILES, current->piece.draw_pos.x + index_x * *x_screen_length, current->piece.draw_pos.y + index_y * *y_screen_length,
+						*x_screen_length, *y_screen_length, MENU_GRAY, current->piece.color_stroke, peek_tile_stroke);
 				}
 			}
 		}
 	}
 
 	RenderPieceHeld(); // Render the piece held last, so it is over the pieces in the player's hand
+	RenderQueueFlush();
 }
 
 //______________________________________________________________
@@ -282,17 +265,17 @@ void RemovePieceHeldFromHand(void){
 		}
 	}
 
-	// Remove the piece from the player's hand, and shift the pieces behind fowards
-	ArrayShiftFowardFrom(hand, played_index, HAND_SIZE - 1);
-
-	// Move the next piece from the peek queue into the hand
-	hand[HAND_SIZE - 1].piece = peek_hand[0].piece;
-
-	// Shift the peek queue piece foward
-	ArrayShiftFowardFrom(peek_hand, 0, PEEK_SIZE - 1);
+	// Remove the piece from the player's hand, shift the pieces behind fowards and draw another piece from the queue
+	SimRemoveFromHand(GetGameState(), played_index);
+	RefreshHand();
+}
 
-	// Draw another piece from the queue
-	peek_hand[PEEK_SIZE - 1].piece = DrawFromBag();
+/*______________________________________________________________
+@brief Rebuilds the pieces shown in the hand and peek queue from the game state and puts them in their slots
+*/
+void RefreshHand(void){
+	PlayerHandSlot* current;
+	UpdateHandPieces();
 
 	//______________________________________________________________
 	// Update the positions
@@ -314,18 +297,30 @@ void RemovePieceHeldFromHand(void){
 }
 
 /*______________________________________________________________
-@brief Used by RemovePieceHeldFromHand to shift the pieces to the right of the piece used leftwards
+@brief Returns the top left of the slot in the player's hand
+*/
+CP_Vector GetHandSlotPosition(int index){
+	return hand[index].pos;
+}
+
+/*______________________________________________________________
+@brief Used by TPlayerInit and RemovePieceHeldFromHand to create the pieces to render from the hand in the game state
 */
-void ArrayShiftFowardFrom(PlayerHandSlot* array, int start, int end){
-	for (int index = start; index < end; ++index) {
-		array[index].piece = array[index + 1].piece;
+void UpdateHandPieces(void){
+	SimState* game_state = GetGameState();
+	for (int index = 0; index < HAND_SIZE; ++index) {
+		hand[index].piece = CreatePiece(game_state->hand[index]);
+	}
+	for (int index = 0; index < PEEK_SIZE; ++index) {
+		peek_hand[index].piece = CreatePiece(game_state->peekHand[index]);
 	}
 }
 
 /*______________________________________________________________
-@brief Frees the images used for icon rendering, should be called on game level exit
+@brief Lets go of the images used for icon rendering, they are kept by the asset loader. Should be called on game level
+	   exit
 */
 void FreeIconImages(void){
-	CP_Image_Free(&attack_icon);
-	CP_Image_Free(&shield_icon);
+	attack_icon = NULL;
+	shield_icon = NULL;
 }
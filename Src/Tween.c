@@ -0,0 +1,294 @@
+/*!
+@file	  Tween.c
+@date     17/10/2026
+@brief    This source file contains the tweens, see Tween.h. The playing tweens are kept packed at the front of one
+		  array, so the update is a single run over them, and a tween that ends is replaced by the last one. A handle
+		  is the slot of the tween with how many times the slot was used, the slot knows where its tween is in the
+		  array, so a handle of a tween that ended does not find the tween that took its place. There are 18
+		  functions in this file,
+
+		  UpdateTweens - Moves every tween by a frame and calls the callbacks of those that ended.
+		  TweenTimer - Starts a tween that only keeps time, read with TweenProgress.
+		  TweenFloat - Starts a tween of a float.
+		  TweenVector - Starts a tween of a vector.
+		  TweenColor - Starts a tween of a color.
+		  TweenOnComplete - Sets the function called when a tween ends or goes round.
+		  TweenProgress - Returns how far along a tween is, eased.
+		  TweenIsPlaying - Checks if a tween has not ended yet.
+		  PauseTween - Stops or lets a tween keep time.
+		  RestartTween - Puts a tween back to its start.
+		  StopTween - Ends a tween without calling its callback.
+		  StopAllTweens - Ends every tween, used when leaving a state.
+		  Ease - Returns an easing of a time step.
+
+		  StartTween - Takes a slot and adds a tween to the array.
+		  FindTween - Returns the tween of a handle, if it is still playing.
+		  EasedStep - Returns how far along a tween is, eased.
+		  ApplyTween - Writes the tween's value to its target.
+		  RemoveTween - Takes a tween out of the array and frees its slot.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#include <math.h>		// For floorf and fmodf
+#include "Tween.h"
+
+#define TWEEN_SLOT_BITS 16	// The low bits of a handle are the slot, the rest the slot's generation
+
+/*______________________________________________________________
+@brief What a tween writes to.
+*/
+typedef enum {
+	TARGET_NONE,	// Timers
+	TARGET_FLOAT,
+	TARGET_VECTOR,
+	TARGET_COLOR
+} TweenTarget;
+
+/*______________________________________________________________
+@brief A playing tween. Start and end are the float, the x and y of the vector or the r, g, b and a of the color.
+*/
+typedef struct TweenData {
+	float time;					// Seconds into the way it is going now, 0 to duration
+	float duration;
+	float start[4];
+	float end[4];
+	void* target;
+	TweenTarget target_type;
+	TweenEase ease;
+	TweenMode mode;
+	_Bool paused;
+	_Bool going_back;			// A ping pong going from the end back to the start
+	TweenCallback on_complete;
+	void* data;
+	int slot;
+} TweenData;
+
+/*______________________________________________________________
+@brief Where the tween of a handle is.
+*/
+typedef struct TweenSlot {
+	unsigned int generation;	// Goes up every time the slot is used, so old handles of it are not found
+	int index;					// In tweens, -1 when the slot is free
+} TweenSlot;
+
+TweenData tweens[MAX_TWEENS];
+int tween_count = 0;
+
+TweenSlot tween_slots[MAX_TWEENS];
+int free_slots[MAX_TWEENS];		// Slots that were used and freed
+int free_slot_count = 0;
+int slots_used = 0;				// Slots from here on were never used
+
+#pragma region
+Tween StartTween(TweenTarget target_type, void* target, float const* start, float const* end, int values, float duration, TweenEase ease, TweenMode mode);
+TweenData* FindTween(Tween tween);
+float EasedStep(TweenData const* tween);
+void ApplyTween(TweenData const* tween);
+void RemoveTween(int index);
+#pragma endregion Forward Declarations
+
+void UpdateTweens(void){
+	float dt = CP_System_GetDt();
+
+	// Callbacks are called after the run, as they may start or stop tweens
+	TweenCallback callbacks[MAX_TWEENS];
+	void* callback_data[MAX_TWEENS];
+	int callback_count = 0;
+
+	for (int index = 0; index < tween_count; ) {
+		TweenData* tween = &tweens[index];
+		if (tween->paused) {
+			++index;
+			continue;
+		}
+
+		tween->time += dt;
+		_Bool went_round = tween->time >= tween->duration;
+		if (went_round) {
+			if (tween->mode == TWEEN_ONCE) {
+				tween->time = tween->duration;
+			}
+			else {
+				// Big frames can go round more than once, a ping pong turns once each time
+				float rounds = floorf(tween->time / tween->duration);
+				tween->time -= rounds * tween->duration;
+				if (tween->mode == TWEEN_PING_PONG && fmodf(rounds, 2.0f) == 1.0f) tween->going_back = !tween->going_back;
+			}
+		}
+		ApplyTween(tween);
+
+		if (went_round && tween->on_complete) {
+			callbacks[callback_count] = tween->on_complete;
+			callback_data[callback_count++] = tween->data;
+		}
+		// The last tween takes the place of one that ended, so the same index is looked at again
+		if (went_round && tween->mode == TWEEN_ONCE) {
+			RemoveTween(index);
+			continue;
+		}
+		++index;
+	}
+
+	for (int index = 0; index < callback_count; ++index) {
+		callbacks[index](callback_data[index]);
+	}
+}
+
+Tween TweenTimer(float duration, TweenMode mode){
+	return StartTween(TARGET_NONE, NULL, NULL, NULL, 0, duration, EASE_LINEAR, mode);
+}
+
+Tween TweenFloat(float* target, float start, float end, float duration, TweenEase ease, TweenMode mode){
+	return StartTween(TARGET_FLOAT, target, &start, &end, 1, duration, ease, mode);
+}
+
+Tween TweenVector(CP_Vector* target, CP_Vector start, CP_Vector end, float duration, TweenEase ease, TweenMode mode){
+	float start_values[2] = { start.x, start.y };
+	float end_values[2] = { end.x, end.y };
+	return StartTween(TARGET_VECTOR, target, start_values, end_values, 2, duration, ease, mode);
+}
+
+Tween TweenColor(CP_Color* target, CP_Color start, CP_Color end, float duration, TweenEase ease, TweenMode mode){
+	float start_values[4] = { start.r, start.g, start.b, start.a };
+	float end_values[4] = { end.r, end.g, end.b, end.a };
+	return StartTween(TARGET_COLOR, target, start_values, end_values, 4, duration, ease, mode);
+}
+
+void TweenOnComplete(Tween tween, TweenCallback callback, void* data){
+	TweenData* found = FindTween(tween);
+	if (!found) return;
+	found->on_complete = callback;
+	found->data = data;
+}
+
+float TweenProgress(Tween tween){
+	TweenData const* found = FindTween(tween);
+	return found ? EasedStep(found) : 1.0f;
+}
+
+_Bool TweenIsPlaying(Tween tween){
+	return FindTween(tween) != NULL;
+}
+
+void PauseTween(Tween tween, _Bool paused){
+	TweenData* found = FindTween(tween);
+	if (found) found->paused = paused;
+}
+
+void RestartTween(Tween tween){
+	TweenData* found = FindTween(tween);
+	if (!found) return;
+	found->time = 0.0f;
+	found->going_back = FALSE;
+	ApplyTween(found);
+}
+
+void StopTween(Tween tween){
+	TweenData const* found = FindTween(tween);
+	if (found) RemoveTween((int)(found - tweens));
+}
+
+void StopAllTweens(void){
+	while (tween_count > 0) RemoveTween(tween_count - 1);
+}
+
+float Ease(TweenEase ease, float t){
+	switch (ease) {
+	case EASE_IN_QUAD:
+		return t * t;
+	case EASE_OUT_QUAD:
+		return t * (2.0f - t);
+	case EASE_IN_OUT_QUAD:
+		return t < 0.5f ? 2.0f * t * t : 1.0f - 2.0f * (1.0f - t) * (1.0f - t);
+	case EASE_IN_CUBIC:
+		return t * t * t;
+	case EASE_OUT_CUBIC:
+		return 1.0f - (1.0f - t) * (1.0f - t) * (1.0f - t);
+	case EASE_SMOOTHSTEP:
+		return t * t * (3.0f - 2.0f * t);
+	default:
+		return t;
+	}
+}
+
+Tween StartTween(TweenTarget target_type, void* target, float const* start, float const* end, int values, float duration, TweenEase ease, TweenMode mode){
+	// Out of tweens, the new one is not started
+	if (tween_count == MAX_TWEENS) return TWEEN_NONE;
+	int slot = free_slot_count > 0 ? free_slots[--free_slot_count] : slots_used++;
+
+	// Generation 0 is never used, so no handle is TWEEN_NONE
+	unsigned int generation = tween_slots[slot].generation + 1;
+	if (generation >> (32 - TWEEN_SLOT_BITS)) generation = 1;
+	tween_slots[slot].generation = generation;
+	tween_slots[slot].index = tween_count;
+
+	TweenData* tween = &tweens[tween_count++];
+	tween->time = 0.0f;
+	// A tween with no duration is at its end on the next update, it cannot go round
+	tween->duration = duration > 0.0f ? duration : 0.0f;
+	tween->mode = duration > 0.0f ? mode : TWEEN_ONCE;
+	for (int value = 0; value < values; ++value) {
+		tween->start[value] = start[value];
+		tween->end[value] = end[value];
+	}
+	tween->target = target;
+	tween->target_type = target ? target_type : TARGET_NONE;
+	tween->ease = ease;
+	tween->paused = FALSE;
+	tween->going_back = FALSE;
+	tween->on_complete = NULL;
+	tween->data = NULL;
+	tween->slot = slot;
+	ApplyTween(tween);
+
+	return generation << TWEEN_SLOT_BITS | (unsigned int)slot;
+}
+
+TweenData* FindTween(Tween tween){
+	// No handle has generation 0, slots that were never used have it, so TWEEN_NONE and the like would find them
+	if (tween >> TWEEN_SLOT_BITS == 0) return NULL;
+	unsigned int slot = tween & ((1u << TWEEN_SLOT_BITS) - 1);
+	if (slot >= MAX_TWEENS) return NULL;
+	TweenSlot const* found = &tween_slots[slot];
+	if (found->generation != tween >> TWEEN_SLOT_BITS || found->index < 0) return NULL;
+	return &tweens[found->index];
+}
+
+float EasedStep(TweenData const* tween){
+	// A tween with no duration is only ever at its end
+	float t = tween->duration > 0.0f ? tween->time / tween->duration : 1.0f;
+	if (tween->going_back) t = 1.0f - t;
+	return Ease(tween->ease, t);
+}
+
+void ApplyTween(TweenData const* tween){
+	if (tween->target_type == TARGET_NONE) return;
+	float t = EasedStep(tween);
+
+	float const* start = tween->start;
+	float const* end = tween->end;
+	switch (tween->target_type) {
+	case TARGET_FLOAT:
+		*(float*)tween->target = start[0] + (end[0] - start[0]) * t;
+		break;
+	case TARGET_VECTOR:
+		*(CP_Vector*)tween->target = CP_Vector_Set(start[0] + (end[0] - start[0]) * t, start[1] + (end[1] - start[1]) * t);
+		break;
+	case TARGET_COLOR:
+		*(CP_Color*)tween->target = CP_Color_Create((int)(start[0] + (end[0] - start[0]) * t + 0.5f), (int)(start[1] + (end[1] - start[1]) * t + 0.5f),
+			(int)(start[2] + (end[2] - start[2]) * t + 0.5f), (int)(start[3] + (end[3] - start[3]) * t + 0.5f));
+		break;
+	default:
+		break;
+	}
+}
+
+void RemoveTween(int index){
+	int slot = tweens[index].slot;
+	tween_slots[slot].index = -1;
+	free_slots[free_slot_count++] = slot;
+
+	tweens[index] = tweens[--tween_count];
+	if (index < tween_count) tween_slots[tweens[index].slot].index = index;
+}
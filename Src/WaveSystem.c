@@ -9,290 +9,209 @@
 2) Populate an enemyArray by randomly selecting an enemy from enemyPool until the credit cost is 0.
 3) Iterate through enemyArray and spawn enemies, placing them in waveArray. Once all the enemies in enemyArray have been spawned, clear it
 4) Goto 2
+
+The rules themselves live in SimCore.c so they can run without a window, this file owns the game's SimState and
+turns what happens in it into particles and sounds.
 /*
 * 
 @license  Copyright  2022 DigiPen, All rights reserved.
 ________________________________________________________________________________________________________*/
 
-#include <math.h>
 #include "WaveSystem.h"
+#include "SimReplay.h"
 #include "Particles.h"
 #include "SoundManager.h"
 #include "GameLoop.h"
-#include "Win.h"
 
-int currentWave=1;			
-int enemiesKilled = 0;
-#define MAXENEMYCOUNT 20							//The maximum amount of enemies that can be on screen at a time
-EnemyInfo EnemiesToSpawn[MAXENEMYCOUNT];			//Populated in GenerateWave()
-int enemySpawnIndex = 0;
-EnemyInfo WaveObjects[WAVEOBJECTCOUNT];				//The main array containing all enemies in the wave
-int enemyCount =0; 			//Keeps track of how many enemies are generated, loops back to index 0 when it exceeds WAVEOBJECTCOUNT
-int waveCredits = 0; 		
-int waveIndex = 0;			//Used to keep track of which enemy to spawn in the wavearray, loops back to index 0 when it exceeds WAVEOBJECTCOUNT
+SimState gameState;			//The state of the game currently being played
+SimReplay replay;			//The moves of the game so far, saved when the game level exits
+_Bool is_recording;			//Stops once playtest mode changes the game outside of the moves
 
+#pragma region
+void OnGameEvent(SimEventType type, EnemyInfo const* enemy, void* userData);
+#pragma endregion Forward Declarations
 
-//Initialises the wave system, generates the first wave and subscribes turn events.
-void InitWaveSystem(void){
+//Initialises the wave system with the seed of the game, generates the first wave and subscribes turn events.
+void InitWaveSystem(int seed){
 	//** Enemy Pool is initialised at the very start of the game so we do not need to initialise it here!
+	SimHooks hooks = { .OnEvent = OnGameEvent, .userData = NULL };
+	SimInit(&gameState,&hooks,(uint64_t)seed);
+	SimReplayFree(&replay);
+	SimReplayInit(&replay,(uint64_t)seed);
+	is_recording = TRUE;
 	GenerateWave();	
 	SubscribeEvent(PLAYER_END,SpawnTombEnemies,1);
 	SubscribeEvent(ZOMBIE_START,UpdateWave,0);
 }
 
-//Generates the wave by deducting credits and populating the array of enemies to spawn
-void GenerateWave(void){
-	// Formula made in desmos, curve is a nice S curve.
-	waveCredits = (int)(12.0f / (0.5f + powf(expf((float)-currentWave+10), 0.2f))); 
-
-	while(waveCredits > 0){				
-		//Gets random enemy index for prefab from enemystats.c
-		//Index 0 is the wall so we exclude it from the random selection
-		int randomEnemyIndex = CP_Random_RangeInt(1,GetEnemyCount()-1);
+//Returns the state of the game currently being played
+SimState* GetGameState(void){
+	return &gameState;
+}
 
-		//Check if Credits-Enemy cost is valid. (it loops and tries again if it isn't)
-		//NOTE: Because there's no break, there MUST be an enemy with at least 1 for it's cost.
-		if((waveCredits-GetEnemyPrefab(randomEnemyIndex)->Cost)>=0){
-			//enemy%WAVEOBJECTCOUNT is so that the enemyCount index loops back around once it = WAVEOBJECTCOUNT
-			//Ensure only the desire number of tombstone is generated and place in Waveobject array
-				EnemiesToSpawn[enemySpawnIndex % MAXENEMYCOUNT] = *GetEnemyPrefab(randomEnemyIndex);
-				EnemiesToSpawn[enemySpawnIndex % MAXENEMYCOUNT].isAlive = FALSE;
-				waveCredits -= GetEnemyPrefab(randomEnemyIndex)->Cost;
-				enemySpawnIndex++;
-		}
+//Plays the particles and sounds for things happening on the board
+void OnGameEvent(SimEventType type, EnemyInfo const* enemy, void* userData){
+	(void)userData;
+	switch(type){
+	case SIM_ENEMY_SPAWNED:
+		ZombieSpawnParticle(GridXToPosX(enemy->x),GridYToPosY(enemy->y));
+		PlaySoundEx(ZOMBIESPAWN,CP_SOUND_GROUP_SFX);
+		break;
+	case SIM_GRAVE_HATCHED:
+		ZombieSpawnParticle(GridXToPosX(enemy->x),GridYToPosY(enemy->y));
+		PlaySound(GRAVESPAWN,CP_SOUND_GROUP_SFX);
+		break;
+	case SIM_WALL_BUILT:
+		PlaySound(WALLBUILD,CP_SOUND_GROUP_SFX);
+		break;
+	case SIM_ENEMY_KILLED:
+		ZombieDeathParticle(GridXToPosX(enemy->x),GridYToPosY(enemy->y),enemy->type);
+		break;
+	case SIM_WALL_DESTROYED:
+		RadialParticleVaried(GridXToPosX(enemy->x),GridYToPosY(enemy->y));
+		break;
+	case SIM_WALL_BREACHED:
+		PlaySound(WALLBREAK,CP_SOUND_GROUP_SFX);
+		break;
+	case SIM_ENEMY_MOVED:
+		PlaySound(ZOMBIEMOVE,CP_SOUND_GROUP_SFX);
+		break;
+	case SIM_PLAYER_HIT:
+		//Special despawn animation over here
+		ZombieToPlayerParticle(GridXToPosX(enemy->x),GridYToPosY(enemy->y));
+		break;
+	case SIM_HEART_LOST:
+		PlaySound(LOSE,CP_SOUND_GROUP_SFX);
+		break;
+	default:
+		break;
 	}
+}
 
+//Generates the wave by deducting credits and populating the array of enemies to spawn
+void GenerateWave(void){
+	SimGenerateWave(&gameState);
 }
 
 //Update function for the wave enemies, handles their spawning and movement.
 void UpdateWave(void){
-	//MOVES ENEMIES
-	for(short y = 0; y < TOTAL_YGRID; ++y){
-		for(short x = 0; x < TOTAL_XGRID; ++x){
-			if(HasLiveEnemyInCell(x,y)){
-				if(GetAliveEnemyFromGrid(x,y)->moveCooldown){
-					GetAliveEnemyFromGrid(x,y)->moveCooldown = FALSE;
-					continue;
-				}
-				if(GetAliveEnemyFromGrid(x,y)->MovementSpeed >0){
-					MoveEnemy(GetAliveEnemyFromGrid(x,y));
-				}
-			}
-		}
-	}
-	//=========================== SPAWNING OF ENEMIES HERE ===========================
-	//Gets the number of enemies left to spawn
-	int enemiesRemainingToSpawn = enemySpawnIndex-waveIndex;
-	//Gets a random number that is either the column size or the enemies left to spawn, whichever is lesser.
-	int randEnemyCount = CP_Random_RangeInt(1,min((TOTAL_YGRID-1),enemiesRemainingToSpawn));
-	int currCount = 0;
-	//As long as there are still enemies to spawn, we continue
-	if(waveIndex < enemySpawnIndex){
-		//We loop through all the enemies we CAN spawn
-		while(currCount < randEnemyCount){
-			SpawnEnemy(&EnemiesToSpawn[waveIndex]);
-			currCount++;//gotta increment
-			//If we finish spawning all the enemies, it means this wave has ended
-			if(waveIndex >= enemySpawnIndex){
-				NextWave();
-				break;
-			} 
-		}
-	}
-	else{
-		//extra catch just in case
-		NextWave();
-	}
-	//Once all the possible spawns have been done, we switch over to players turn
+	SimZombieTurn(&gameState);
+	//Once all the possible spawns have been done, we switch over to players turn (done once ZOMBIE_START is over)
 	GameLoopSwitch(TURN_PLAYER);
 }
 
 //Displays enemies in the grid
 void RenderEnemy(void){
-	for(short i =0; i<WAVEOBJECTCOUNT; ++i){
-		if(WaveObjects[i].isAlive){
-			DrawEnemy(&WaveObjects[i]);
-		} 
+	SimWaveObjects const* objects = &gameState.waveObjects;
+	for(short i =0; i<gameState.liveCount; ++i){
+		short slot = gameState.liveSlots[i];
+		DrawEnemy(objects->x[slot],objects->y[slot],objects->health[slot],(ZombieType)objects->type[slot]);
 	}
 }
 
 //Spawns a specific enemy in the specified cell if it is unoccupied. Used in tutorial for scripted spawns.
 void SpawnEnemyInCell(int x, int y,EnemyInfo* enemy){
-	if(HasLiveEnemyInCell(x,y)) return;
-	for(short i = 0; i<WAVEOBJECTCOUNT; ++i){
-		if(!WaveObjects[i].isAlive){
-		WaveObjects[i] = *enemy;
-		WaveObjects[i].isAlive = TRUE;
-		WaveObjects[i].x = x;
-		WaveObjects[i].y = y;
-		break;
-		}
-	}
+	if(is_recording) SimReplayRecordSpawn(&replay,&gameState,x,y,enemy->type);
+	SimSpawnEnemyInCell(&gameState,x,y,enemy);
 }
 
-//Spawns enemies to the grid, used by update wave to spawn enemies into the grid.
+//Spawns enemies to the grid.
 void SpawnEnemy(EnemyInfo* enemy){
-	//Grave enemies have a different spawning positon to other zombies.
-	if(enemy->type == GRAVE) enemy->x = CP_Random_RangeInt(TOTAL_XGRID-2, TOTAL_XGRID-4);
-	else enemy->x = TOTAL_XGRID-1;
-	//The Y position of all zombies are randomised
-	enemy->y = (CP_Random_RangeInt(0, TOTAL_YGRID - 1));
-	if(HasLiveEnemyInCell(enemy->x,enemy->y))return;
-	for(short i = 0; i<WAVEOBJECTCOUNT; ++i){
-		if(!WaveObjects[i].isAlive){
-			enemy->isAlive = TRUE;
-			ZombieSpawnParticle(GridXToPosX(enemy->x),GridYToPosY(enemy->y));
-			PlaySoundEx(ZOMBIESPAWN,CP_SOUND_GROUP_SFX);
-			WaveObjects[i] = *enemy;
-			waveIndex++;
-			break;
-		}
-	}
+	SimSpawnEnemy(&gameState,enemy);
 }
 
 //Creates a wall in unoccupied cell.
 void CreateWall(int x, int y){
-	if(HasLiveEnemyInCell(x,y))return;
-	for(short i = 0; i<WAVEOBJECTCOUNT; ++i){
-		if(!WaveObjects[i].isAlive){
-			WaveObjects[i] = *GetEnemyPrefab(0);
-			WaveObjects[i].isAlive = TRUE;
-			WaveObjects[i].x = x;
-			WaveObjects[i].y = y;
-			PlaySound(WALLBUILD,CP_SOUND_GROUP_SFX);
-			break;
-		}
-	}
+	SimCreateWall(&gameState,x,y);
 }
 
 //Spawns random enemy in cell occupied by grave enemies
 void SpawnTombEnemies(void){
-	for(short i=0; i<WAVEOBJECTCOUNT; ++i){
-		if(HasLiveEnemyInCell(WaveObjects[i].x,WaveObjects[i].y)){
-			if(WaveObjects[i].MovementSpeed <=0 &&WaveObjects[i].Cost >0){
-				EnemyInfo newEnemy = *GetRandomEnemyPrefab();
-				newEnemy.x = WaveObjects[i].x;	//we still need the xy pos of the tombstone
-				newEnemy.y = WaveObjects[i].y;
-				ZombieSpawnParticle(GridXToPosX(newEnemy.x),GridYToPosY(newEnemy.y));
-				PlaySound(GRAVESPAWN,CP_SOUND_GROUP_SFX);
-				WaveObjects[i] = newEnemy;		//replace tombstone with random enemy
-				WaveObjects[i].isAlive = TRUE;
-				WaveObjects[i].moveCooldown = TRUE;
-			}
-		}
-	}
+	SimSpawnTombEnemies(&gameState);
 }
 
 //Iterates through grid, returns true if all enemies are dead, false if otherwise
 _Bool IsAllEnemiesDead(void){
-	int count = 0;
-	for(short i = 0; i<WAVEOBJECTCOUNT; ++i){
-		if(WaveObjects[i].isAlive && WaveObjects[i].Cost >0){
-			count++;
-		}
-	}
-	return (count ==0) ? TRUE:FALSE;
+	return SimIsAllEnemiesDead(&gameState);
 }
 
-
-//Returns the live enemy in the specified grid. Returns NULL if otherwise.
-EnemyInfo* GetAliveEnemyFromGrid(int x, int y){
-	if(!HasLiveEnemyInCell(x,y))return NULL;
-	for(short i=0; i< WAVEOBJECTCOUNT;++i){
-		if((WaveObjects[i].x == x) && (WaveObjects[i].y ==y)){
-			if(WaveObjects[i].isAlive) return &WaveObjects[i];
-		}
-	}
-	return NULL;
+//Copies the live enemy in the specified grid. Returns FALSE if there is none.
+_Bool GetAliveEnemyFromGrid(int x, int y, EnemyInfo* enemy){
+	return SimGetEnemy(&gameState,x,y,enemy);
 }
 
-//Returns the specified cell. 
-EnemyInfo* GetCell(int x, int y){
-    for(short i=0; i< WAVEOBJECTCOUNT;++i){
-        if((WaveObjects[i].x == x) && (WaveObjects[i].y ==y)){
-            return &WaveObjects[i];
-        }
-    }
-    return NULL;
+//Copies the enemy in the specified cell. 
+_Bool GetCell(int x, int y, EnemyInfo* enemy){
+	return GetAliveEnemyFromGrid(x,y,enemy);
 }
 
-
 //Checks if the enemy in the specified cell is alive.
 _Bool HasLiveEnemyInCell(int x, int y){
-	for(short i=0; i< WAVEOBJECTCOUNT;++i){
-		if((WaveObjects[i].x == x) && (WaveObjects[i].y ==y)){
-			if(WaveObjects[i].isAlive) return TRUE;
-		}
-	}
-	return FALSE;
+	return SimHasLiveEnemy(&gameState,x,y);
+}
+
+//Checks if the thing in the specified cell is a wall.
+_Bool HasWallInCell(int x, int y){
+	return SimHasWall(&gameState,x,y);
+}
+
+//Checks the columns fromX to toX of the row for zombies, walls don't count.
+_Bool HasZombieInRow(int y, int fromX, int toX){
+	return SimHasZombieInRow(&gameState,y,fromX,toX);
 }
 
 //Returns the current wave count
 int GetCurrentWave(void){
-	return currentWave;
+	return gameState.currentWave;
 }
 
 //Returns the count of enemies killed
 int GetEnemiesKilled(void){
-	return enemiesKilled;
+	return gameState.enemiesKilled;
 }
 
 //Sends damage to enemy in specified cell. Called by tetromino pieces.
 void SendDamage(int x, int y,int damage){
-	//Make sure the thing we want to send damage to is in the playing area
-	if(!IsInPlayingArea(GridXToPosX(x),GridYToPosY(y)))return;
-	//Make sure it's not null/dead lol
-	if (GetAliveEnemyFromGrid(x, y) == NULL) return;
-	if (GetAliveEnemyFromGrid(x, y)->type == WALL) return;
-	EnemyInfo* enemy = GetAliveEnemyFromGrid(x,y);
-	enemy->Health-=damage;
-	if(enemy->Health <=0){
-		enemy->isAlive = FALSE;
-		ZombieDeathParticle(GridXToPosX(x),GridYToPosY(y),enemy->type);
-		enemiesKilled++;
-	}
+	SimSendDamage(&gameState,x,y,damage);
 }
 
 //Function for zombies to deal damage to walls
 void ZombieDealDamage(int x, int y,int damage){
-	//Make sure the thing we want to send damage to is in the playing area
-	if(!IsInPlayingArea(GridXToPosX(x),GridYToPosY(y)))return;
-	//Make sure it's not null/dead lol
-	if (GetAliveEnemyFromGrid(x, y) == NULL) return;
-	EnemyInfo* enemy = GetAliveEnemyFromGrid(x,y);
-	enemy->Health-=damage;
-	if(enemy->Health <=0){
-		enemy->isAlive = FALSE;
-		RadialParticleVaried(GridXToPosX(enemy->x),GridYToPosY(enemy->y));
-	}
+	SimZombieDealDamage(&gameState,x,y,damage);
 }
 
 //Starts the next wave
 void NextWave(void){
-	//Check if it's the last wave
-	if(currentWave >= WAVES_TO_WIN) return;
-	//reset array for enemies to spawn
-	memset(EnemiesToSpawn,0,sizeof(EnemyInfo)*MAXENEMYCOUNT);
-	waveIndex = 0;
-	enemySpawnIndex =0;
-	//Once the wave is done spawning, it waits for more turns
-	currentWave++;
-	GenerateWave();				//generates the next wave
+	SimNextWave(&gameState);
 }
 
 void SetWave(int wave){
-	currentWave = wave;
+	gameState.currentWave = wave;
+}
+
+//Records the move the player is about to play, the hash of the turn before is taken now that its zombie turn is over
+void RecordPlayerMove(int slot, int rotation, int x, int y){
+	if(!is_recording)return;
+	SimMove move = { slot, rotation, x, y };
+	SimReplayRecordMove(&replay,&gameState,&move);
+}
+
+//Stops recording, the moves so far are still saved
+void StopRecording(void){
+	if(!is_recording)return;
+	SimReplayFinish(&replay,&gameState);
+	is_recording = FALSE;
+}
+
+//Saves the moves recorded this game, if there are any, and frees them
+void SaveReplay(char const* path){
+	StopRecording();
+	if(replay.count > 0) SimReplaySave(&replay,path);
+	SimReplayFree(&replay);
 }
 
 //Resets the game state
 void ResetGame(void){
-	//Reset wave index, enemyCount and the waveArray
-	enemySpawnIndex = 0;
-	waveIndex = 0;
-	enemyCount = 0;
-	currentWave = 1;
-	enemiesKilled =0;
-	memset(WaveObjects,0,sizeof(EnemyInfo)*(WAVEOBJECTCOUNT));
-	memset(EnemiesToSpawn,0,sizeof(EnemyInfo)*MAXENEMYCOUNT);
+	SimResetGame(&gameState);
 	ResetParticles();
-}
\ No newline at end of file
+}
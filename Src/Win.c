@@ -18,6 +18,8 @@ ________________________________________________________________________________
 #include "WaveSystem.h"
 #include <stdio.h>
 #include "SoundManager.h"
+#include "Tween.h" // For the Win title card fade
+#include "AssetLoader.h"
 
 CP_Font main_font;
 Button backtomainmenuBtn;
@@ -25,6 +27,8 @@ CP_Image selectPointer;
 
 TextOnlyHearts win_text;
 RectHearts win_bg;
+_Bool win_started;	// The Win title card is fading in and its timer goes to the Win screen, set when it is first drawn
+float win_alpha;	// Of the Win title card, faded in
 
 TextOnly Win_Title;
 TextOnly Enemies_Killed;
@@ -52,7 +56,7 @@ void InitializeButtonsWinScreen(void) {
 
 	TextData GameOverTextData = {
 	.color = MENU_WHITE,
-	.font = CP_Font_Load("Assets/PressStart2P-Regular.ttf"),
+	.font = GetAssetFont("Assets/PressStart2P-Regular.ttf"),
 	.textSize = 50 * GetHeightScale(),
 	// Text will be drawn on the X Y pos of btn rect (which is top left corner),
 	// So we shift text to top left.
@@ -144,6 +148,7 @@ void WinTextInit(void) {
 	win_text.xpos = CP_System_GetWindowWidth() / 2.f;
 	win_text.ypos = CP_System_GetWindowHeight() / 2.f;
 	win_text.words = "YOU SURVIVED!";
+	win_started = FALSE;
 }
 
 /*----------------------------------------------------------------------------
@@ -156,19 +161,24 @@ void CheckWinCondition(void) {
 /*----------------------------------------------------------------------------
 @brief Renders the Win Animation
 ------------------------------------------------------------------------------*/
-static float time_elapsed = 0.f;
 void WinAnimation(void) {
-	//Makes it such that the win sound only plays once
-	if(time_elapsed <=0) PlaySound(GAMEWIN,CP_SOUND_GROUP_SFX);
 	float bg_transistion_time_max = 2.f;
 	float stay_time_max = 5.8f;
 
-	time_elapsed += CP_System_GetDt();
+	// Fade in the title card, and go to the Win screen once it stayed for a while
+	if (!win_started) {
+		//Makes it such that the win sound only plays once
+		win_started = TRUE;
+		PlaySound(GAMEWIN, CP_SOUND_GROUP_SFX);
+		TweenFloat(&win_alpha, 0.f, 255.f, bg_transistion_time_max, EASE_LINEAR, TWEEN_ONCE);
+		Tween win_timer = TweenTimer(stay_time_max * 0.9f, TWEEN_ONCE);
+		// Out of tweens, the timer would never end, so the Win screen is gone to now
+		if (win_timer == TWEEN_NONE) GoToWin(NULL);
+		else TweenOnComplete(win_timer, GoToWin, NULL);
+	}
 
 	// BG Drawing
-	float bg_transistion_time = time_elapsed / bg_transistion_time_max;
-	float stay_time = time_elapsed / stay_time_max;
-	int alpha_bg = CP_Math_ClampInt((int)(255 * bg_transistion_time), 0, 255);
+	int alpha_bg = (int)win_alpha;
 	// Draw BG
 	CP_Settings_RectMode(CP_POSITION_CENTER);
 	CP_Settings_Stroke(GRID_COLOR);
@@ -180,11 +190,15 @@ void WinAnimation(void) {
 	CP_Settings_TextSize(win_text.font_size); // Size of text
 	CP_Settings_TextAlignment(CP_TEXT_ALIGN_H_CENTER, CP_TEXT_ALIGN_V_MIDDLE); // Origin of text is it's absolute center
 	CP_Font_DrawText(win_text.words, win_text.xpos, win_text.ypos);
+}
 
-	if (stay_time >= 0.9f) {
-		time_elapsed = 0.f;
-		CP_Engine_SetNextGameState(WinInit, WinUpdate, WinExit);
-	}
+/*----------------------------------------------------------------------------
+@brief Called when the Win title card has been up long enough, goes to the Win
+screen
+------------------------------------------------------------------------------*/
+void GoToWin(void* data) {
+	(void)data;
+	CP_Engine_SetNextGameState(WinInit, WinUpdate, WinExit);
 }
 
 /*----------------------------------------------------------------------------
@@ -192,7 +206,7 @@ void WinAnimation(void) {
 ------------------------------------------------------------------------------*/
 void WinInit(void) {
 	CP_Graphics_ClearBackground(GAMEOVER_DARKGRAY);
-	main_font = CP_Font_Load("Assets/PressStart2P-Regular.ttf");
+	main_font = GetAssetFont("Assets/PressStart2P-Regular.ttf");
 
 	// Populate buttons with positional, size and text values
 	InitializeButtonsWinScreen();
@@ -15,12 +15,16 @@ ________________________________________________________________________________
 #include "GameOver.h"
 #include "Wizard.h"
 #include "TPlayerHeld.h"
+#include "GlyphAtlas.h"
+#include "Tween.h"
+#include "AssetLoader.h"
 
 Wizard wiz_body;
 Wizard wiz_hat;
 Wizard wiz_staff;
 CP_Image rotation_icon;
 CP_Image right_click_icon;
+float icon_rotation;	// Of the rotation icon, spun round every 3 seconds
 
 /*----------------------------------------------------------------------------
 @brief Initializes the Wizard's text body part
@@ -49,13 +53,10 @@ void InitWizard(void) {
 }
 
 /*----------------------------------------------------------------------------
-@brief Draws the Wizard's body part
+@brief Draws the Wizard's body part, each part is one character from the glyph atlas
 ------------------------------------------------------------------------------*/
 void DrawWizard(Wizard wiz_body_part) {
-	CP_Settings_Fill(wiz_body_part.color);
-	CP_Settings_TextSize(wiz_body_part.size);
-	CP_Settings_TextAlignment(CP_TEXT_ALIGN_H_CENTER, CP_TEXT_ALIGN_V_MIDDLE);
-	CP_Font_DrawText(wiz_body_part.words, wiz_body_part.xpos, wiz_body_part.ypos);
+	DrawGlyph(wiz_body_part.words[0], wiz_body_part.xpos, wiz_body_part.ypos, wiz_body_part.size, wiz_body_part.color);
 }
 
 /*----------------------------------------------------------------------------
@@ -67,8 +68,7 @@ void UpdateWizard(void) {
 
 	// Hat update
 	DrawWizard(wiz_hat);
-	CP_Settings_TextSize(wiz_hat.size * 0.9f);
-	CP_Font_DrawText("^", wiz_hat.xpos, wiz_hat.ypos - GetCellSize() / 20.f);
+	DrawGlyph('^', wiz_hat.xpos, wiz_hat.ypos - GetCellSize() / 20.f, wiz_hat.size * 0.9f, wiz_hat.color);
 
 	// Staff update
 	DrawWizard(wiz_staff);
@@ -85,32 +85,25 @@ CP_Vector GetWizardPosition(void){
 @brief Initializes the images for the rotation icon and the mouse right click icon
 ------------------------------------------------------------------------------*/
 void InitMouseIcon(void) {
-	rotation_icon = CP_Image_Load("Assets/RotationIcon.png");
-	right_click_icon = CP_Image_Load("Assets/MouseRightClickIcon.png");
+	rotation_icon = GetAssetImage("Assets/RotationIcon.png");
+	right_click_icon = GetAssetImage("Assets/MouseRightClickIcon.png");
+	TweenFloat(&icon_rotation, 0.f, 360.f, 3.f, EASE_LINEAR, TWEEN_LOOP);
 }
 
 /*----------------------------------------------------------------------------
 @brief Renders the mouse icon and the rotation icon
 ------------------------------------------------------------------------------*/
-float static time_elapsed = 0.f;
 void RenderMouseIcon(void) {
-
-	float tick = time_elapsed / 3.f;
-	if (tick >= 1.f) {
-		time_elapsed = 0;
-	}
-	time_elapsed += CP_System_GetDt();
-	float rotation = CP_Math_LerpFloat(0.f, 360.f, tick);
 	if (IsPieceHeld() == TRUE) {
-		CP_Image_DrawAdvanced(rotation_icon, CP_Input_GetMouseX() + GetCellSize() / 3.f, CP_Input_GetMouseY() + GetCellSize() / 3.f, GetCellSize() / 2.f, GetCellSize() / 2.f, 200, rotation);
+		CP_Image_DrawAdvanced(rotation_icon, CP_Input_GetMouseX() + GetCellSize() / 3.f, CP_Input_GetMouseY() + GetCellSize() / 3.f, GetCellSize() / 2.f, GetCellSize() / 2.f, 200, icon_rotation);
 		CP_Image_DrawAdvanced(right_click_icon, CP_Input_GetMouseX() + GetCellSize() / 1.5f, CP_Input_GetMouseY() + GetCellSize() / 1.5f, GetCellSize() / 3.f, GetCellSize() / 3.f, 200, 0.f);
 	}
 }
 
 /*----------------------------------------------------------------------------
-@brief Frees the images of the rotation and right click icon that was loaded previously
+@brief Lets go of the images of the rotation and right click icon, they are kept by the asset loader
 ------------------------------------------------------------------------------*/
 void FreeMouseIcons(void) {
-	CP_Image_Free(&rotation_icon);
-	CP_Image_Free(&right_click_icon);
+	rotation_icon = NULL;
+	right_click_icon = NULL;
 }
@@ -33,20 +33,33 @@ ________________________________________________________________________________
 
 #include "EnemyDisplay.h" // For drawing the enemy stats on the grid
 
+#include "Hint.h" // For showing the best placement when H is pressed
+
 #include "MainMenu.h" // For exiting to main menu.
 
+#include "Profiler.h" // For timing each stage of the update in debug mode
+
+#include "GlyphAtlas.h" // For drawing the particles, enemies and wizard from one image
+
+#include "Tween.h" // For moving every animation on by a frame
+
 _Bool debugMode = FALSE;
 
+SimSnapshot debug_snapshot;			// Game saved with K in debug mode, L puts it back
+_Bool has_debug_snapshot = FALSE;
+
 
 void gameLevelInit(void){
 	// Zero out all the events in the event system first!
 	ZeroOutAllEvents();
+	has_debug_snapshot = FALSE;
 	//Start the game BGM
 	PlayBGM(GAMEBGM);
 
 	//INITIALISE GAME 
 	grid_init();
-	InitWaveSystem();
+	GlyphAtlasInit(GetCellSize());
+	InitWaveSystem(DEFAULT_SPAWN_SEED);
 	InitializeLife();
 
 	//INITIALISE UI ELEMENTS
@@ -55,8 +68,9 @@ void gameLevelInit(void){
 	InitMouseIcon();
 
 	//INITIALISE TETRIS PIECE
-	TManagerInit(DEFAULT_SPAWN_SEED);
+	TManagerInit();
 	TPlayerInit();
+	HintInit();
 
 	//INITIALISE TUTORIAL
 	EnemyDisplayInit();
@@ -67,33 +81,72 @@ void gameLevelInit(void){
 }
 
 void gameLevelUpdate(void){
+	// Every stage is timed as a zone of the profiler, it only does anything in debug mode
+	ProfilerBeginFrame();
+
+	// Every fade, blink and lerp is moved on first, so everything drawn this frame sees the same time
+	ProfilerBegin(PROFILE_TWEENS);
+	UpdateTweens();
+	ProfilerEnd(PROFILE_TWEENS);
+
+	ProfilerBegin(PROFILE_CAMERA_SHAKE);
 	UpdateCameraShaker();
+	ProfilerEnd(PROFILE_CAMERA_SHAKE);
 
 	//DRAWING AND UPDATING OF GRID
+	ProfilerBegin(PROFILE_GRID);
 	grid_update();
+	ProfilerEnd(PROFILE_GRID);
+	ProfilerBegin(PROFILE_ENEMIES);
 	RenderEnemy();
+	ProfilerEnd(PROFILE_ENEMIES);
 
 	// Call the functions subscribed to the update events
+	ProfilerBegin(PROFILE_GAME_LOOP);
 	GameLoopUpdate();
+	ProfilerEnd(PROFILE_GAME_LOOP);
 
 	//UPDATE VFX
+	ProfilerBegin(PROFILE_EFFECTS);
 	UpdateEffects();
+	ProfilerEnd(PROFILE_EFFECTS);
+	ProfilerBegin(PROFILE_HAND);
 	RenderHand();
+	ProfilerEnd(PROFILE_HAND);
+	ProfilerBegin(PROFILE_HINT);
+	RenderHint();
+	ProfilerEnd(PROFILE_HINT);
+	ProfilerBegin(PROFILE_WAVE_TEXT);
 	ShowCurrentWave();
+	ProfilerEnd(PROFILE_WAVE_TEXT);
 	//ShowTestEnemiesKilled();
 	// UPDATE ROTATION ICON
+	ProfilerBegin(PROFILE_MOUSE_ICON);
 	RenderMouseIcon();
+	ProfilerEnd(PROFILE_MOUSE_ICON);
 	// Show enemy info on hover
+	ProfilerBegin(PROFILE_ENEMY_INFO);
 	DisplayEnemyInfo();
+	ProfilerEnd(PROFILE_ENEMY_INFO);
 
 	// UPDATE WIZARD
+	ProfilerBegin(PROFILE_WIZARD);
 	UpdateWizard();
+	ProfilerEnd(PROFILE_WIZARD);
 	// UPDATE HEARTS
+	ProfilerBegin(PROFILE_LIFE);
 	UpdateLife();
+	ProfilerEnd(PROFILE_LIFE);
 	// CHECK IF WON
+	ProfilerBegin(PROFILE_WIN_CHECK);
 	CheckWinCondition();
+	ProfilerEnd(PROFILE_WIN_CHECK);
 	// CLEAR SCREEN
+	ProfilerBegin(PROFILE_CLEAR);
 	CP_Graphics_ClearBackground(BLACK);
+	ProfilerEnd(PROFILE_CLEAR);
+
+	ProfilerEndFrame();
 
 	if (CP_Input_KeyTriggered(KEY_ESCAPE)){
 		ExitToMainMenu();
@@ -106,11 +159,19 @@ void gameLevelUpdate(void){
 	{
 		if(CP_Input_KeyTriggered(KEY_D)){
 			debugMode = !debugMode;
+			// Playtest mode changes the game outside of the moves, the replay can't follow it
+			StopRecording();
+			ProfilerSetEnabled(debugMode);
 		}
 	}
 
 	if(debugMode){
 		ShowPlaytestMode();
+		ShowProfilerStats();
+		//SAVE THE LAST FRAMES AS A CHROME TRACE
+		if(CP_Input_KeyTriggered(KEY_F)){
+			ProfilerSaveTrace(PROFILE_TRACE_PATH);
+		}
 		//SPAWN WALL
 		if(CP_Input_KeyTriggered(KEY_0)){
 	 		SpawnEnemyInCell(PosXToGridX(CP_Input_GetMouseX()), PosYToGridY(CP_Input_GetMouseY()), GetEnemyPrefab(0));
@@ -144,6 +205,16 @@ void gameLevelUpdate(void){
 		if(CP_Input_KeyTriggered(KEY_W)){
 			SetWave(30);
 		}
+		//SAVE AND LOAD A SNAPSHOT OF THE GAME
+		if(CP_Input_KeyTriggered(KEY_K)){
+			SimSaveSnapshot(GetGameState(), &debug_snapshot);
+			has_debug_snapshot = TRUE;
+		}
+		if(CP_Input_KeyTriggered(KEY_L) && has_debug_snapshot){
+			SimRestoreSnapshot(GetGameState(), &debug_snapshot);
+			RefreshHand();
+			ClearHint();
+		}
 		//GAIN LIFE AND LOSE LIFE
 		if (CP_Input_KeyReleased(KEY_O) == 1) {
 			LoseLife(1);
@@ -177,6 +248,36 @@ void ShowTestEnemiesKilled(void){
 	CP_Font_DrawText(buffer, xPosition, yPosition);
 }
 
+void ShowProfilerStats(void){
+	float textSize = GetCellSize() / 6.f;
+	float xPosition = 0;
+	float yPosition = GetCellSize() / 5.f + textSize * 1.5f;
+	char buffer[64] = { 0 };
+
+	CP_Settings_Fill(TETRIS_COLOR);
+	CP_Settings_TextSize(textSize);
+	CP_Settings_TextAlignment(CP_TEXT_ALIGN_H_LEFT, CP_TEXT_ALIGN_V_MIDDLE);
+	sprintf_s(buffer, 64, "%-14s %6s %6s %6s %6s", "ZONE (MS)", "LAST", "MIN", "AVG", "P99");
+	CP_Font_DrawText(buffer, xPosition, yPosition);
+
+	for(int zone = 0; zone < PROFILE_ZONE_COUNT; ++zone){
+		ProfileStats stats;
+		if(!ProfilerGetStats((ProfileZone)zone, &stats)) continue;
+		yPosition += textSize;
+		sprintf_s(buffer, 64, "%-14s %6.2f %6.2f %6.2f %6.2f", ProfilerGetZoneName((ProfileZone)zone), stats.last, stats.min, stats.avg, stats.p99);
+		CP_Font_DrawText(buffer, xPosition, yPosition);
+	}
+
+	// The particle pool, how full it got and what did not fit
+	ParticlePoolStats pool = GetParticlePoolStats();
+	yPosition += textSize;
+	sprintf_s(buffer, 64, "PARTICLES %d/%d PEAK %d", pool.live, pool.budget, pool.peak);
+	CP_Font_DrawText(buffer, xPosition, yPosition);
+	yPosition += textSize;
+	sprintf_s(buffer, 64, "EVICTED %d+%d DROPPED %d", pool.evicted[PARTICLE_DECORATIVE], pool.evicted[PARTICLE_GAMEPLAY], pool.dropped);
+	CP_Font_DrawText(buffer, xPosition, yPosition);
+}
+
 void ShowPlaytestMode(void){
 	CP_Settings_Fill(TETRIS_COLOR);
 	CP_Settings_TextSize(GetCellSize() / 5.f);
@@ -189,15 +290,22 @@ void ShowPlaytestMode(void){
 }
 
 void gameLevelExit(void){
+	SaveReplay(REPLAY_PATH);
 	UnsubscribeAllEvents();
 	ClearHearts();
 	FreeIconImages();
 	FreeMouseIcons();
 	FreeEnemyDisplayIcon();
 	ResetCameraShake();
+	grid_exit();
+	FreeParticles();
+	GlyphAtlasFree();
+	StopAllTweens();
 }
 
 void ExitToMainMenu(void){
+	// Saved before the reset, the last hash is of the board the game ended on. gameLevelExit has nothing left to save.
+	SaveReplay(REPLAY_PATH);
 	ResetGame();
 	CP_Engine_SetNextGameState(MainMenuInit, MainMenuUpdate, MainMenuExit);
 }
\ No newline at end of file
@@ -12,7 +12,7 @@
 ________________________________________________________________________________________________________*/
 
 #include "cprocessing.h"
-#include "Splashscreen.h"
+#include "splashscreen.h"
 
 int main(void)
 {
@@ -8,28 +8,36 @@
 ________________________________________________________________________________________________________*/
 
 #include "cprocessing.h"
-#include "SplashScreen.h"
+#include "splashscreen.h"
 #include "MainMenu.h"
 #include "ColorTable.h"
 #include "Utils.h"
 #include "EnemyStats.h"
 #include "SoundManager.h"
 #include "UIManager.h"
+#include "Tween.h"
+#include "AssetLoader.h"
 
 const float FADE_IN_DURATION = 3.0f;
 
-float fade = 0;	// Current fade timer
+float fade = 0;	// Current fade, 0 to 1
+Tween fade_in;
 CP_Image logo;	// Digipen splash screen logo
 Text copyRight;
 
 #pragma region FORWARD_DECLARATION
 void InitTexts(void);
 void FadeInLogo(void);
+void DrawLoadingBar(void);
+void GoToMainMenu(void);
 #pragma endregion
 
 void SplashScreenInit(void) {
+	// Load the assets of the game in the background while the logo fades in.
+	StartAssetLoader();
+
 	// Intialize logo
-	logo = CP_Image_Load("Assets/DigiPen_WHITE.png");
+	logo = GetAssetImage("Assets/DigiPen_WHITE.png");
 
 	CP_System_Fullscreen();
 	// CP_System_SetWindowSize(1920, 1080);
@@ -43,23 +51,32 @@ void SplashScreenInit(void) {
 
 	//Initialise static duration prefabs
 	InitEnemyPool();		//Initialise enemies 
-	InitSoundManager();		//Initialise sounds
+	SimInitPieceShapes();	//Work out every orientation of the Tetris pieces
 	InitTexts();
+
+	// Fade in, then change state when finish fading in and loading.
+	fade_in = TweenFloat(&fade, 0.f, 1.f, FADE_IN_DURATION, EASE_LINEAR, TWEEN_ONCE);
 }
 
 void SplashScreenUpdate(void) {
+	UpdateTweens();
+	// Turn what was loaded into images and sounds, a few milliseconds a frame so the fade keeps going.
+	UpdateAssetLoader();
 	CP_Graphics_ClearBackground(MENU_BLACK);
 
 	// Fade in the digipen logo
 	FadeInLogo();
+	DrawLoadingBar();
 	// Draw copyright texts.
 	RenderTextBoxes();
+
+	if (!TweenIsPlaying(fade_in) && IsAssetLoaderDone()) GoToMainMenu();
 }
 
 void SplashScreenExit(void) {
-	// Free image and text.
-	CP_Image_Free(&logo);
+	// Free text, the logo is kept by the asset loader.
 	FreeUI();
+	StopAllTweens();
 }
 
 void InitTexts(void){
@@ -72,7 +89,7 @@ void InitTexts(void){
 	TextData copyRightTextData = {
 		.color = MENU_WHITE,
 		.textSize = 20,
-		.font = CP_Font_Load("Assets/PressStart2P-Regular.ttf"),
+		.font = GetAssetFont("Assets/PressStart2P-Regular.ttf"),
 		.hAlign = CP_TEXT_ALIGN_H_CENTER,
 		.vAlign = CP_TEXT_ALIGN_V_MIDDLE,
 		.text =
@@ -88,14 +105,26 @@ void FadeInLogo(void) {
 	CP_Image_Draw(logo, (float)(CP_System_GetWindowWidth() / 2), (float)(CP_System_GetWindowHeight() / 2), (float)CP_Image_GetWidth(logo), (float)CP_Image_GetHeight(logo), (int)(fade * 255));
 	// Fade in copyright text.
 	copyRight.textData.color.a = (unsigned char)(fade * 255);
+}
 
-	// Increment timer.
-	fade += CP_System_GetDt() / FADE_IN_DURATION;
+void DrawLoadingBar(void) {
+	// Thin bar under the logo, until everything is loaded.
+	if (IsAssetLoaderDone()) return;
+	float width = GetWindowWidth() / 4;
+	float x = (GetWindowWidth() - width) / 2;
+	float y = GetWindowHeight() / 2 + CP_Image_GetHeight(logo) / 2 + GetWindowHeight() / 20;
+	CP_Settings_NoStroke();
+	CP_Settings_RectMode(CP_POSITION_CORNER);
+	CP_Settings_Fill(CP_Color_Create(239, 239, 239, (int)(fade * 64)));
+	CP_Graphics_DrawRect(x, y, width, 4);
+	CP_Settings_Fill(CP_Color_Create(239, 239, 239, (int)(fade * 255)));
+	CP_Graphics_DrawRect(x, y, width * GetAssetLoaderProgress(), 4);
+}
 
-	// Change state when finish fading in.
-	if (fade > 1) {
-		CP_Engine_SetNextGameState(MainMenuInit, MainMenuUpdate, MainMenuExit);
-	}
+void GoToMainMenu(void) {
+	// Every sound is loaded by now.
+	InitSoundManager();
+	CP_Engine_SetNextGameState(MainMenuInit, MainMenuUpdate, MainMenuExit);
 }
 
 
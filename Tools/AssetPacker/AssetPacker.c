@@ -0,0 +1,290 @@
+/*!
+@file	  AssetPacker.c
+@date     17/10/2026
+@brief    This source file contains the asset packer. It puts the asset files of the game into one asset pack (see
+		  AssetPack.h) with a hash index of their paths, every file starting on a multiple of ASSET_PACK_ALIGNMENT,
+		  in the order they are listed. The pack is opened again with the game's own code once it is written and
+		  every file is looked up and compared, so a pack that was written is one the game reads.
+
+		  Usage: AssetPacker [--list FILE] [--root DIR] [--out FILE] [PATH...]
+		  The paths are from the repository root, like the game asks for them ("Assets/Heart.png"). --list reads
+		  more of them from a file, one a line ('#' starts a comment), Tools/AssetPacker/AssetList.txt is the game's.
+		  A listed file that is not there is skipped with a warning, the music is not checked in.
+		  Exits with 1 if the pack could not be written.
+
+		  Building: AssetPacker.vcxproj in the solution (the game runs it after it is built, into the game's folder),
+		  or on Linux from the repository root
+		  gcc -O2 -IInc Tools/AssetPacker/AssetPacker.c Src/AssetPack.c -o AssetPacker
+		  ./AssetPacker --list Tools/AssetPacker/AssetList.txt --out Assets.pak
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "AssetPack.h"
+
+#ifndef TRUE
+#define TRUE 1
+#endif
+#ifndef FALSE
+#define FALSE 0
+#endif
+
+#define MAX_PACKED_FILES 1024
+#define MAX_PATH_LENGTH 260
+
+typedef struct PackedFile{
+	char path[MAX_PATH_LENGTH];		//As it is looked up, with '/'
+	unsigned char* data;
+	size_t size;
+	uint32_t offset;				//Of its blob in the pack
+} PackedFile;
+
+#pragma region
+_Bool AddPath(char const* path);
+_Bool ReadList(char const* listPath);
+_Bool ReadFiles(void);
+_Bool WritePack(void);
+_Bool VerifyPack(void);
+uint32_t AlignOffset(uint32_t offset);
+_Bool ReadArguments(int argc, char* argv[]);
+void PrintUsage(void);
+#pragma endregion Forward Declarations
+
+PackedFile files[MAX_PACKED_FILES];
+int fileCount = 0;
+char rootPath[MAX_PATH_LENGTH + 1] = "";
+char const* outPath = ASSET_PACK_PATH;
+
+int main(int argc, char* argv[]){
+	if(!ReadArguments(argc,argv) || fileCount == 0){
+		PrintUsage();
+		return 1;
+	}
+	if(!ReadFiles() || !WritePack() || !VerifyPack()) return 1;
+	for(int i = 0; i < fileCount; ++i) free(files[i].data);
+	return 0;
+}
+
+//Adds a path to pack, with '\' turned into '/'. The same file twice is only packed once.
+_Bool AddPath(char const* path){
+	size_t length = strlen(path);
+	if(length == 0) return TRUE;
+	if(length >= MAX_PATH_LENGTH){
+		fprintf(stderr,"Path too long: %s\n",path);
+		return FALSE;
+	}
+	char normalized[MAX_PATH_LENGTH];
+	for(size_t i = 0; i <= length; ++i) normalized[i] = path[i] == '\\' ? '/' : path[i];
+	for(int i = 0; i < fileCount; ++i){
+		if(strcmp(files[i].path,normalized) == 0) return TRUE;
+	}
+	if(fileCount == MAX_PACKED_FILES){
+		fprintf(stderr,"More than %d files\n",MAX_PACKED_FILES);
+		return FALSE;
+	}
+	memcpy(files[fileCount++].path,normalized,length + 1);
+	return TRUE;
+}
+
+//Adds every path in the list file, one a line, without the blanks around it, skipping comments.
+_Bool ReadList(char const* listPath){
+	FILE* list = fopen(listPath,"r");
+	if(!list){
+		fprintf(stderr,"Could not read %s\n",listPath);
+		return FALSE;
+	}
+	char line[MAX_PATH_LENGTH + 2];
+	_Bool added = TRUE;
+	while(added && fgets(line,sizeof(line),list)){
+		char* start = line;
+		while(*start == ' ' || *start == '\t') ++start;
+		char* end = start + strlen(start);
+		while(end > start && (end[-1] == '\n' || end[-1] == '\r' || end[-1] == ' ' || end[-1] == '\t')) --end;
+		*end = '\0';
+		if(*start == '#') continue;
+		added = AddPath(start);
+	}
+	fclose(list);
+	return added;
+}
+
+//Reads every file into memory, leaving out the ones that are not there.
+_Bool ReadFiles(void){
+	int kept = 0;
+	for(int i = 0; i < fileCount; ++i){
+		char fullPath[MAX_PATH_LENGTH * 2];
+		if(snprintf(fullPath,sizeof(fullPath),"%s%s",rootPath,files[i].path) >= (int)sizeof(fullPath)){
+			fprintf(stderr,"Path too long: %s%s\n",rootPath,files[i].path);
+			return FALSE;
+		}
+		FILE* file = fopen(fullPath,"rb");
+		if(!file){
+			fprintf(stderr,"Skipping %s, it is not there\n",fullPath);
+			continue;
+		}
+		long size = fseek(file,0,SEEK_END) == 0 ? ftell(file) : -1;
+		unsigned char* data = size >= 0 && fseek(file,0,SEEK_SET) == 0 ? malloc(size > 0 ? (size_t)size : 1) : NULL;
+		_Bool read = data && fread(data,1,(size_t)size,file) == (size_t)size;
+		fclose(file);
+		if(!read){
+			fprintf(stderr,"Could not read %s\n",fullPath);
+			free(data);
+			return FALSE;
+		}
+		files[kept] = files[i];
+		files[kept].data = data;
+		files[kept].size = (size_t)size;
+		++kept;
+	}
+	fileCount = kept;
+	return TRUE;
+}
+
+//Lays out the pack (header, index, paths, then the blobs in order) and writes it.
+_Bool WritePack(void){
+	//Twice as many buckets as files or more, so probes stay short and there is always an empty one
+	uint32_t bucketCount = 8;
+	while(bucketCount < (uint32_t)fileCount * 2) bucketCount *= 2;
+
+	AssetPackEntry* entries = malloc(sizeof(AssetPackEntry) * bucketCount);
+	if(!entries) return FALSE;
+	for(uint32_t i = 0; i < bucketCount; ++i){
+		entries[i].hash = 0;
+		entries[i].path = ASSET_PACK_EMPTY;
+		entries[i].offset = 0;
+		entries[i].size = 0;
+	}
+
+	uint32_t pathsOffset = (uint32_t)(sizeof(AssetPackHeader) + sizeof(AssetPackEntry) * bucketCount);
+	uint32_t pathsSize = 0;
+	for(int i = 0; i < fileCount; ++i) pathsSize += (uint32_t)strlen(files[i].path) + 1;
+
+	uint64_t offset = AlignOffset(pathsOffset + pathsSize);
+	uint32_t pathOffset = 0;
+	for(int i = 0; i < fileCount; ++i){
+		if(offset + files[i].size > 0xFFFFFFFFu - ASSET_PACK_ALIGNMENT){
+			fprintf(stderr,"The pack would be over 4GB\n");
+			free(entries);
+			return FALSE;
+		}
+		files[i].offset = (uint32_t)offset;
+		offset = AlignOffset((uint32_t)(offset + files[i].size));
+
+		uint32_t hash = AssetPackHash(files[i].path);
+		uint32_t bucket = hash & (bucketCount - 1);
+		while(entries[bucket].path != ASSET_PACK_EMPTY) bucket = (bucket + 1) & (bucketCount - 1);
+		entries[bucket].hash = hash;
+		entries[bucket].path = pathOffset;
+		entries[bucket].offset = files[i].offset;
+		entries[bucket].size = (uint32_t)files[i].size;
+		pathOffset += (uint32_t)strlen(files[i].path) + 1;
+	}
+	//The last blob is padded too, so the pack size is a multiple of the alignment
+	uint32_t packSize = (uint32_t)offset;
+
+	AssetPackHeader header = {
+		.magic = ASSET_PACK_MAGIC,
+		.version = ASSET_PACK_VERSION,
+		.pack_size = packSize,
+		.file_count = (uint32_t)fileCount,
+		.bucket_count = bucketCount,
+		.paths_offset = pathsOffset,
+		.paths_size = pathsSize,
+	};
+
+	FILE* pack = fopen(outPath,"wb");
+	if(!pack){
+		fprintf(stderr,"Could not write %s\n",outPath);
+		free(entries);
+		return FALSE;
+	}
+	static unsigned char const padding[ASSET_PACK_ALIGNMENT] = { 0 };
+	_Bool written = fwrite(&header,sizeof(header),1,pack) == 1 && fwrite(entries,sizeof(AssetPackEntry),bucketCount,pack) == bucketCount;
+	uint32_t at = pathsOffset;
+	for(int i = 0; written && i < fileCount; ++i){
+		size_t length = strlen(files[i].path) + 1;
+		written = fwrite(files[i].path,1,length,pack) == length;
+		at += (uint32_t)length;
+	}
+	for(int i = 0; written && i < fileCount; ++i){
+		written = fwrite(padding,1,files[i].offset - at,pack) == files[i].offset - at && fwrite(files[i].data,1,files[i].size,pack) == files[i].size;
+		at = files[i].offset + (uint32_t)files[i].size;
+	}
+	written = written && fwrite(padding,1,packSize - at,pack) == packSize - at;
+	written = fclose(pack) == 0 && written;
+	free(entries);
+	if(!written){
+		fprintf(stderr,"Could not write %s\n",outPath);
+		return FALSE;
+	}
+	printf("Packed %d files into %s, %u bytes, %u buckets\n",fileCount,outPath,packSize,bucketCount);
+	return TRUE;
+}
+
+//Opens the pack written with the game's code and checks every file is found with the same bytes.
+_Bool VerifyPack(void){
+	if(!OpenAssetPack(outPath)){
+		fprintf(stderr,"%s was written but is not a pack the game can open\n",outPath);
+		return FALSE;
+	}
+	_Bool same = TRUE;
+	for(int i = 0; i < fileCount && same; ++i){
+		size_t size = 0;
+		unsigned char const* data = FindPackedAsset(files[i].path,&size);
+		same = data && size == files[i].size && memcmp(data,files[i].data,size) == 0 && (uintptr_t)data % ASSET_PACK_ALIGNMENT == 0;
+		if(!same) fprintf(stderr,"%s is not in %s as it should be\n",files[i].path,outPath);
+	}
+	CloseAssetPack();
+	return same;
+}
+
+uint32_t AlignOffset(uint32_t offset){
+	return (offset + ASSET_PACK_ALIGNMENT - 1) / ASSET_PACK_ALIGNMENT * ASSET_PACK_ALIGNMENT;
+}
+
+//Reads the command line, returns FALSE if something is wrong with it.
+_Bool ReadArguments(int argc, char* argv[]){
+	for(int i = 1; i < argc; ++i){
+		char const* option = argv[i];
+		if(strcmp(option,"--help") == 0 || strcmp(option,"-h") == 0) return FALSE;
+		if(strncmp(option,"--",2) != 0){
+			if(!AddPath(option)) return FALSE;
+			continue;
+		}
+		if(i + 1 >= argc){
+			fprintf(stderr,"Missing value for %s\n",option);
+			return FALSE;
+		}
+		char const* value = argv[++i];
+
+		if(strcmp(option,"--list") == 0){
+			if(!ReadList(value)) return FALSE;
+		}
+		else if(strcmp(option,"--root") == 0){
+			//Ends with a slash so the paths can be put after it, "C:\Game\" can't be passed quoted on windows
+			size_t length = strlen(value);
+			if(length >= MAX_PATH_LENGTH){
+				fprintf(stderr,"Path too long: %s\n",value);
+				return FALSE;
+			}
+			memcpy(rootPath,value,length + 1);
+			if(length > 0 && value[length - 1] != '/' && value[length - 1] != '\\') memcpy(rootPath + length,"/",2);
+		}
+		else if(strcmp(option,"--out") == 0) outPath = value;
+		else{
+			fprintf(stderr,"Unknown option %s\n",option);
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+void PrintUsage(void){
+	fprintf(stderr,"Usage: AssetPacker [--list FILE] [--root DIR] [--out FILE] [PATH...]\n");
+	fprintf(stderr,"  --list   packs the paths in FILE too, one a line\n");
+	fprintf(stderr,"  --root   the folder the paths are from (default the current folder)\n");
+	fprintf(stderr,"  --out    the pack written (default %s)\n",ASSET_PACK_PATH);
+}
@@ -0,0 +1,178 @@
+/*!
+@file	  BalancePlayers.c
+@date     17/10/2026
+@brief    This source file contains the scripted players of the balance runner.
+
+		  random - drops a random piece anywhere, the floor for how hard a wave is.
+		  greedy - tries every piece, rotation and cell and takes the one that hits the most (and closest) zombies,
+				   or walls off the zombies closest to the player when that scores better.
+		  turtle - only ever builds walls in front of the closest zombie, shows how far walls alone get you.
+		  solver - plays the best placement of SimSolve at depth 1, the closest thing to a strong player. Much slower than
+				   the rest, run it with fewer --games.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#include <string.h>
+#include "BalancePlayers.h"
+#include "SimSolver.h"
+
+#define PLAYING_XGRID (TOTAL_XGRID-1)		//The spawn column is not part of the playing area
+
+//The greedy player's score tables have a border as wide as a piece around the playing area
+#define SCORE_PADDING SHAPE_BOUNDS
+#define SCORE_XGRID (PLAYING_XGRID + SCORE_PADDING*2)
+#define SCORE_YGRID (TOTAL_YGRID + SCORE_PADDING*2)
+
+#pragma region
+static void RandomPlayer(SimState const* sim, SimRandom* random, SimMove* move);
+static void GreedyPlayer(SimState const* sim, SimRandom* random, SimMove* move);
+static void TurtlePlayer(SimState const* sim, SimRandom* random, SimMove* move);
+static void SolverPlayer(SimState const* sim, SimRandom* random, SimMove* move);
+static void ScoreCells(SimState const* sim, int attackScores[][SCORE_YGRID], int wallScores[][SCORE_YGRID]);
+static _Bool IsZombie(SimState const* sim, int x, int y);
+#pragma endregion Forward Declarations
+
+static BalancePlayer const players[] = {
+	{ "greedy", "Plays the piece that hits the most zombies closest to the player, or walls them off", GreedyPlayer },
+	{ "random", "Drops a random piece anywhere on the board", RandomPlayer },
+	{ "turtle", "Only builds walls in front of the closest zombie", TurtlePlayer },
+	{ "solver", "Plays the best placement found by the solver, looking one zombie turn ahead", SolverPlayer },
+};
+
+//Returns the player with the name, NULL if there is none.
+BalancePlayer const* GetBalancePlayer(char const* name){
+	for(int i = 0; i < GetBalancePlayerCount(); ++i){
+		if(strcmp(players[i].name,name) == 0) return &players[i];
+	}
+	return NULL;
+}
+
+int GetBalancePlayerCount(void){
+	return (int)(sizeof(players) / sizeof(players[0]));
+}
+
+BalancePlayer const* GetBalancePlayerAt(int index){
+	return &players[index];
+}
+
+static void RandomPlayer(SimState const* sim, SimRandom* random, SimMove* move){
+	(void)sim;
+	move->slot = SimRandomRange(random,0,HAND_SIZE-1);
+	move->rotation = SimRandomRange(random,0,3);
+	move->x = SimRandomRange(random,0,PLAYING_XGRID-1);
+	move->y = SimRandomRange(random,0,TOTAL_YGRID-1);
+}
+
+//Tries every slot, rotation and cell, keeps the first best one so the same state always gives the same move.
+static void GreedyPlayer(SimState const* sim, SimRandom* random, SimMove* move){
+	(void)random;
+	int attackScores[SCORE_XGRID][SCORE_YGRID];
+	int wallScores[SCORE_XGRID][SCORE_YGRID];
+	ScoreCells(sim,attackScores,wallScores);
+
+	int bestScore = -1;
+
+	//If nothing scores, wall off the middle row
+	move->slot = 0;
+	move->rotation = 0;
+	move->x = 0;
+	move->y = TOTAL_YGRID / 2;
+
+	for(int slot = 0; slot < HAND_SIZE; ++slot){
+		int (*scores)[SCORE_YGRID] = slot > 0 ? attackScores : wallScores;
+		for(int rotation = 0; rotation < ROTATION_TYPE_LENGTH; ++rotation){
+			SimPieceShape const* piece = SimGetPieceShape(sim->hand[slot],(PieceOrientation)rotation);
+			SimCell const* cells = piece->cells;
+			int cellCount = piece->cellCount;
+
+			//Where each cell of the piece is in the score table from the cell it is dropped on
+			int offsets[SHAPE_BOUNDS*SHAPE_BOUNDS];
+			for(int i = 0; i < cellCount; ++i) offsets[i] = cells[i].x * SCORE_YGRID + cells[i].y;
+
+			for(int x = 0; x < PLAYING_XGRID; ++x){
+				for(int y = 0; y < TOTAL_YGRID; ++y){
+					int const* drop = &scores[x + SCORE_PADDING][y + SCORE_PADDING];
+					int score = 0;
+					for(int i = 0; i < cellCount; ++i) score += drop[offsets[i]];
+					if(score > bestScore){
+						bestScore = score;
+						move->slot = slot;
+						move->rotation = rotation;
+						move->x = x;
+						move->y = y;
+					}
+				}
+			}
+		}
+	}
+}
+
+//Builds the wall piece right in front of the zombie closest to the player
+static void TurtlePlayer(SimState const* sim, SimRandom* random, SimMove* move){
+	move->slot = 0;
+	move->rotation = SimRandomRange(random,0,3);
+	move->x = 0;
+	move->y = TOTAL_YGRID / 2;
+
+	int closestX = TOTAL_XGRID;
+	for(int x = 0; x < TOTAL_XGRID; ++x){
+		for(int y = 0; y < TOTAL_YGRID; ++y){
+			if(IsZombie(sim,x,y) && x < closestX){
+				closestX = x;
+				move->x = x > 0 ? x - 1 : 0;
+				move->y = y;
+			}
+		}
+	}
+}
+
+//Asks the solver for the best placement, on this thread only since the runner already has a game on every core
+static void SolverPlayer(SimState const* sim, SimRandom* random, SimMove* move){
+	SimSolverSettings settings;
+	SimSolverDefaultSettings(&settings);
+	settings.threadCount = 1;
+	settings.seed = SimRandomNext(random);
+
+	SimSolverPlacement best;
+	if(SimSolve(sim,&settings,&best,1) > 0){
+		*move = best.move;
+		return;
+	}
+	move->slot = 0;
+	move->rotation = 0;
+	move->x = 0;
+	move->y = TOTAL_YGRID / 2;
+}
+
+/*______________________________________________________________
+@brief How good hitting or walling each cell is, worked out once a turn so every placement is just a sum of its cells.
+	   Attacks score for every zombie hit, more the closer it is to the player and more again if it dies.
+	   Walls score for every empty cell with a zombie coming at it down the row in the next few turns.
+	   Cells off the playing area are left at 0 in the padding, so pieces hanging off the board need no checks.
+*/
+static void ScoreCells(SimState const* sim, int attackScores[][SCORE_YGRID], int wallScores[][SCORE_YGRID]){
+	memset(attackScores,0,sizeof(int) * SCORE_XGRID * SCORE_YGRID);
+	memset(wallScores,0,sizeof(int) * SCORE_XGRID * SCORE_YGRID);
+	for(int y = 0; y < TOTAL_YGRID; ++y){
+		int zombieX = TOTAL_XGRID * 2;	//Closest zombie to the right of the cell, none yet
+		for(int x = TOTAL_XGRID - 1; x >= 0; --x){
+			int slot = SimGetSlot(sim,x,y);
+			_Bool isZombie = IsZombie(sim,x,y);
+			if(x < PLAYING_XGRID){
+				if(isZombie){
+					attackScores[x + SCORE_PADDING][y + SCORE_PADDING] = 10 + (TOTAL_XGRID - x) * 2 + (sim->waveObjects.health[slot] <= 1 ? 5 : 0);
+				}
+				else if(slot < 0 && zombieX - x <= 3){
+					wallScores[x + SCORE_PADDING][y + SCORE_PADDING] = 4 + (TOTAL_XGRID - x) - (zombieX - x);
+				}
+			}
+			if(isZombie) zombieX = x;
+		}
+	}
+}
+
+//Returns true if there is a live enemy that isn't a wall in the cell
+static _Bool IsZombie(SimState const* sim, int x, int y){
+	return SimHasLiveEnemy(sim,x,y) && !SimHasWall(sim,x,y);
+}
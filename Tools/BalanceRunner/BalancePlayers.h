@@ -0,0 +1,44 @@
+/*!
+@file	  BalancePlayers.h
+@date     17/10/2026
+@brief    This header file contains the scripted players the balance runner can play games with. A player only looks
+		  at the state and picks a move, so new ones can be added to the table in BalancePlayers.c and picked with
+		  --player on the command line.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#pragma once // Only include this header file once
+
+#include "SimCore.h"
+
+/*______________________________________________________________
+@brief Picks the move for the turn. The move MUST be dropped in the playing area.
+@param[in] random the player's own random stream, seeded from the game so every game still plays out the same.
+*/
+typedef void (*BalancePlayerFunction)(SimState const* sim, SimRandom* random, SimMove* move);
+
+typedef struct BalancePlayer{
+	char const* name;					//What --player takes
+	char const* description;
+	BalancePlayerFunction PickMove;
+} BalancePlayer;
+
+/*____________________________________________________________________*/
+
+/*
+@brief Returns the player with the name, NULL if there is none.
+*/
+BalancePlayer const* GetBalancePlayer(char const* name);
+/*____________________________________________________________________*/
+
+/*
+@brief Returns how many players there are, for listing them with GetBalancePlayerAt.
+*/
+int GetBalancePlayerCount(void);
+/*____________________________________________________________________*/
+
+/*
+@brief Returns the player at the index.
+*/
+BalancePlayer const* GetBalancePlayerAt(int index);
@@ -0,0 +1,317 @@
+/*!
+@file	  BalanceRunner.c
+@date     17/10/2026
+@brief    This source file contains the wave balance runner. It plays thousands of seeded games headless with a scripted
+		  player, spread over all the cores, and writes a CSV of how each wave went so wave credits, enemy costs and the
+		  piece bag can be tuned from numbers instead of playtests.
+
+		  Only the rules (SimCore.c, SimRandom.c) are built in, no CProcessing. Game n plays with seed --seed + n and
+		  the results are only ever added up, so the same command gives the same CSV no matter how many threads run it.
+
+		  Usage: BalanceRunner [--games N] [--seed S] [--threads T] [--player NAME] [--max-turns N] [--out FILE] [--replays DIR]
+
+		  With --replays every game is also saved as DIR/game_<seed>.replay, ReplayRunner can play them back later
+		  to check a change to the rules still plays out the same.
+
+		  CSV, one row per wave (a wave lasts from its first spawn until the next wave starts spawning):
+		  wave				 the wave number, 1 to WAVES_TO_WIN
+		  games_reached		 games that got to the wave
+		  survival_rate		 of those, how many made it to the next wave (or won on the last one)
+		  hearts_lost		 average hearts lost during the wave
+		  enemies_spawned	 average enemies spawned during the wave, including what hatched from graves
+		  enemies_killed	 average enemies the player killed during the wave
+		  turns				 average turns the wave lasted
+
+		  Building: BalanceRunner.vcxproj in the solution, or on Linux from the repository root
+		  gcc -O2 -ITools/BalanceRunner -IInc Tools/BalanceRunner/BalanceRunner.c Tools/BalanceRunner/BalancePlayers.c
+		      Src/SimCore.c Src/SimRandom.c Src/SimThreads.c Src/SimSolver.c Src/SimReplay.c -lm -lpthread -o BalanceRunner
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "SimCore.h"
+#include "SimThreads.h"
+#include "SimReplay.h"
+#include "BalancePlayers.h"
+
+#define DEFAULT_GAME_COUNT 10000
+#define DEFAULT_SEED 42069			//Same as DEFAULT_SPAWN_SEED in TManager.h, so game 0 is the game played in debug
+#define DEFAULT_MAX_TURNS 5000		//Games still going after this many turns are stopped and counted as unfinished
+
+typedef struct WaveStats{
+	long long reached;
+	long long survived;
+	long long heartsLost;
+	long long spawned;
+	long long killed;
+	long long turns;
+} WaveStats;
+
+/*______________________________________________________________
+@brief The totals of all the games a thread played, added together once every thread is done.
+*/
+typedef struct RunStats{
+	WaveStats waves[WAVES_TO_WIN + 1];	//Index 0 is not used, waves start at 1
+	long long games;
+	long long won;
+	long long lost;
+	long long unfinished;
+	long long turns;
+} RunStats;
+
+/*______________________________________________________________
+@brief Passed to the game's hooks so the events are counted against the wave they happened in.
+*/
+typedef struct GameTracker{
+	SimState const* sim;
+	RunStats* stats;
+	int hearts;
+} GameTracker;
+
+typedef struct RunWorker{
+	int index;
+	RunStats stats;
+} RunWorker;
+
+//Settings of the run, read only once the threads start
+int gameCount = DEFAULT_GAME_COUNT;
+int maxTurns = DEFAULT_MAX_TURNS;
+int threadCount = 0;				//0 uses every core
+uint64_t baseSeed = DEFAULT_SEED;
+BalancePlayer const* player = NULL;
+char const* outPath = NULL;
+char const* replayDir = NULL;		//Where to save the replay of every game, NULL to not save them
+
+#pragma region
+_Bool ReadArguments(int argc, char* argv[]);
+void PrintUsage(void);
+double GetSeconds(void);
+void RunGames(void* worker);
+void PlayGame(uint64_t seed, RunStats* stats);
+void OnTrackedEvent(SimEventType type, EnemyInfo const* enemy, void* userData);
+void AddStats(RunStats* total, RunStats const* stats);
+void WriteCSV(FILE* file, RunStats const* stats);
+#pragma endregion Forward Declarations
+
+int main(int argc, char* argv[]){
+	player = GetBalancePlayer("greedy");
+	if(!ReadArguments(argc,argv)){
+		PrintUsage();
+		return 1;
+	}
+	if(threadCount <= 0) threadCount = SimGetCoreCount();
+	if(threadCount > SIM_MAX_THREAD_COUNT) threadCount = SIM_MAX_THREAD_COUNT;
+	if(threadCount > gameCount) threadCount = gameCount > 0 ? gameCount : 1;
+
+	FILE* out = stdout;
+	if(outPath){
+		out = fopen(outPath,"w");
+		if(!out){
+			fprintf(stderr,"Could not open %s for writing\n",outPath);
+			return 1;
+		}
+	}
+
+	SimInitEnemyPool();
+	SimInitPieceShapes();
+
+	RunWorker* workers = calloc((size_t)threadCount,sizeof(RunWorker));
+	if(!workers){
+		fprintf(stderr,"Out of memory\n");
+		return 1;
+	}
+	for(int i = 0; i < threadCount; ++i) workers[i].index = i;
+
+	double start = GetSeconds();
+	SimRunThreads(RunGames,workers,sizeof(RunWorker),threadCount);
+	double elapsed = GetSeconds() - start;
+
+	RunStats total;
+	memset(&total,0,sizeof(total));
+	for(int i = 0; i < threadCount; ++i) AddStats(&total,&workers[i].stats);
+	free(workers);
+
+	WriteCSV(out,&total);
+	if(out != stdout) fclose(out);
+
+	double games = total.games > 0 ? (double)total.games : 1.0;
+	fprintf(stderr,"%s: %lld games, %lld turns in %.2fs on %d threads (%.2fM turns/s)\n",
+		player->name,total.games,total.turns,elapsed,threadCount,elapsed > 0.0 ? total.turns / elapsed / 1e6 : 0.0);
+	fprintf(stderr,"won %.2f%%, lost %.2f%%, unfinished %.2f%%\n",
+		100.0 * total.won / games,100.0 * total.lost / games,100.0 * total.unfinished / games);
+	return 0;
+}
+
+//Reads the command line into the run settings, returns FALSE if something is wrong with it.
+_Bool ReadArguments(int argc, char* argv[]){
+	for(int i = 1; i < argc; ++i){
+		char const* option = argv[i];
+		if(strcmp(option,"--help") == 0 || strcmp(option,"-h") == 0) return FALSE;
+		if(i + 1 >= argc){
+			fprintf(stderr,"Missing value for %s\n",option);
+			return FALSE;
+		}
+		char const* value = argv[++i];
+
+		if(strcmp(option,"--games") == 0) gameCount = atoi(value);
+		else if(strcmp(option,"--seed") == 0) baseSeed = strtoull(value,NULL,0);
+		else if(strcmp(option,"--threads") == 0) threadCount = atoi(value);
+		else if(strcmp(option,"--max-turns") == 0) maxTurns = atoi(value);
+		else if(strcmp(option,"--out") == 0) outPath = value;
+		else if(strcmp(option,"--replays") == 0) replayDir = value;
+		else if(strcmp(option,"--player") == 0){
+			player = GetBalancePlayer(value);
+			if(!player){
+				fprintf(stderr,"Unknown player %s\n",value);
+				return FALSE;
+			}
+		}
+		else{
+			fprintf(stderr,"Unknown option %s\n",option);
+			return FALSE;
+		}
+	}
+	if(gameCount < 0 || maxTurns <= 0){
+		fprintf(stderr,"--games and --max-turns have to be positive\n");
+		return FALSE;
+	}
+	return TRUE;
+}
+
+void PrintUsage(void){
+	fprintf(stderr,"Usage: BalanceRunner [--games N] [--seed S] [--threads T] [--player NAME] [--max-turns N] [--out FILE] [--replays DIR]\n");
+	fprintf(stderr,"  --games      games to play (default %d)\n",DEFAULT_GAME_COUNT);
+	fprintf(stderr,"  --seed       seed of the first game, game n uses seed + n (default %d)\n",DEFAULT_SEED);
+	fprintf(stderr,"  --threads    threads to play on (default every core)\n");
+	fprintf(stderr,"  --max-turns  turns before a game is stopped as unfinished (default %d)\n",DEFAULT_MAX_TURNS);
+	fprintf(stderr,"  --out        CSV file to write (default stdout)\n");
+	fprintf(stderr,"  --replays    folder to save the replay of every game in (default none)\n");
+	fprintf(stderr,"  --player     scripted player (default greedy):\n");
+	for(int i = 0; i < GetBalancePlayerCount(); ++i){
+		fprintf(stderr,"      %-8s %s\n",GetBalancePlayerAt(i)->name,GetBalancePlayerAt(i)->description);
+	}
+}
+
+//______________________________________________________________
+// Timing
+
+double GetSeconds(void){
+	struct timespec time;
+	timespec_get(&time,TIME_UTC);
+	return (double)time.tv_sec + (double)time.tv_nsec / 1e9;
+}
+
+//______________________________________________________________
+// Games
+
+//Worker n plays games n, n + threadCount, n + 2*threadCount... Each worker runs on its own thread.
+void RunGames(void* worker){
+	RunWorker* runWorker = (RunWorker*)worker;
+	for(int game = runWorker->index; game < gameCount; game += threadCount){
+		PlayGame(baseSeed + (uint64_t)game,&runWorker->stats);
+	}
+}
+
+//Plays one game to the end with the scripted player and adds how it went to the stats.
+void PlayGame(uint64_t seed, RunStats* stats){
+	SimState sim;
+	GameTracker tracker = { .sim = &sim, .stats = stats, .hearts = MAX_HEART_COUNT };
+	SimHooks hooks = { .OnEvent = OnTrackedEvent, .userData = &tracker };
+	SimNewGame(&sim,&hooks,seed);
+	tracker.hearts = sim.hearts;
+
+	//The player gets the stream after the game's own ones
+	SimRandom random;
+	SimRandomSeed(&random,seed,SIM_RANDOM_STREAM_LENGTH);
+
+	SimReplay replay;
+	SimReplayInit(&replay,seed);
+
+	int turn = 0;
+	while(!SimIsGameLost(&sim) && !SimIsGameWon(&sim) && turn < maxTurns){
+		int wave = sim.currentWave;
+		SimMove move;
+		player->PickMove(&sim,&random,&move);
+		if(replayDir) SimReplayRecordMove(&replay,&sim,&move);
+		if(!SimStepTurn(&sim,move.slot,move.rotation,move.x,move.y)){
+			fprintf(stderr,"%s played an invalid move (slot %d at %d,%d), stopping game %llu\n",
+				player->name,move.slot,move.x,move.y,(unsigned long long)seed);
+			break;
+		}
+		++stats->waves[wave].turns;
+		++turn;
+	}
+
+	if(replayDir){
+		char path[1024];
+		SimReplayFinish(&replay,&sim);
+		snprintf(path,sizeof(path),"%s/game_%llu.replay",replayDir,(unsigned long long)seed);
+		if(!SimReplaySave(&replay,path)) fprintf(stderr,"Could not write %s\n",path);
+		SimReplayFree(&replay);
+	}
+
+	_Bool won = SimIsGameWon(&sim);
+	for(int wave = 1; wave <= sim.currentWave; ++wave){
+		++stats->waves[wave].reached;
+		if(wave < sim.currentWave || won) ++stats->waves[wave].survived;
+	}
+
+	++stats->games;
+	stats->turns += turn;
+	if(won) ++stats->won;
+	else if(SimIsGameLost(&sim)) ++stats->lost;
+	else ++stats->unfinished;
+}
+
+//Counts the spawns, kills and hearts lost against the wave the game is on
+void OnTrackedEvent(SimEventType type, EnemyInfo const* enemy, void* userData){
+	(void)enemy;
+	GameTracker* tracker = (GameTracker*)userData;
+	WaveStats* wave = &tracker->stats->waves[tracker->sim->currentWave];
+	switch(type){
+	case SIM_ENEMY_SPAWNED:
+	case SIM_GRAVE_HATCHED:
+		++wave->spawned;
+		break;
+	case SIM_ENEMY_KILLED:
+		++wave->killed;
+		break;
+	case SIM_HEART_LOST:
+		wave->heartsLost += tracker->hearts - tracker->sim->hearts;
+		tracker->hearts = tracker->sim->hearts;
+		break;
+	default:
+		break;
+	}
+}
+
+void AddStats(RunStats* total, RunStats const* stats){
+	for(int wave = 1; wave <= WAVES_TO_WIN; ++wave){
+		total->waves[wave].reached += stats->waves[wave].reached;
+		total->waves[wave].survived += stats->waves[wave].survived;
+		total->waves[wave].heartsLost += stats->waves[wave].heartsLost;
+		total->waves[wave].spawned += stats->waves[wave].spawned;
+		total->waves[wave].killed += stats->waves[wave].killed;
+		total->waves[wave].turns += stats->waves[wave].turns;
+	}
+	total->games += stats->games;
+	total->won += stats->won;
+	total->lost += stats->lost;
+	total->unfinished += stats->unfinished;
+	total->turns += stats->turns;
+}
+
+//Writes one row per wave, the averages are over the games that reached the wave.
+void WriteCSV(FILE* file, RunStats const* stats){
+	fprintf(file,"wave,games_reached,survival_rate,hearts_lost,enemies_spawned,enemies_killed,turns\n");
+	for(int wave = 1; wave <= WAVES_TO_WIN; ++wave){
+		WaveStats const* w = &stats->waves[wave];
+		double reached = w->reached > 0 ? (double)w->reached : 1.0;
+		fprintf(file,"%d,%lld,%.4f,%.4f,%.4f,%.4f,%.4f\n",wave,w->reached,
+			w->survived / reached,w->heartsLost / reached,w->spawned / reached,w->killed / reached,w->turns / reached);
+	}
+}
@@ -0,0 +1,175 @@
+/*!
+@file	  GridBench.c
+@date     16/10/2026
+@brief    This source file times the grid queries of a frame through the cell index of SimCore, and through the scans
+		  that answered them before the index was added, so the two can be compared on the same boards.
+
+		  A frame is a SimGetEnemy on every cell (what drawing the board asks for) and a SimHasLiveEnemy on each
+		  of the 4 cells of a held piece. The boards are filled with 0 to 80 enemies through SimSpawnEnemyInCell.
+
+		  The index side calls the real SimGetEnemy and SimHasLiveEnemy. The scan side, ScanGetAliveEnemyFromGrid and
+		  ScanHasLiveEnemyInCell, is the code of GetAliveEnemyFromGrid and HasLiveEnemyInCell from before the index,
+		  copied as it was. The only changes are that it reads the board of a SimState, in the layout the board has
+		  now, instead of the WaveObjects global, and that the enemy found is copied out the way SimGetEnemy does.
+
+		  Usage: GridBench [--frames N] [--seed S]
+
+		  Building: GridBench.vcxproj in the solution, or on Linux from the repository root
+		  gcc -O2 -IInc Tools/GridBench/GridBench.c Src/SimCore.c Src/SimRandom.c -lm -o GridBench
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "SimCore.h"
+#include "SimRandom.h"
+
+#define DEFAULT_FRAMES 50000
+#define DEFAULT_SEED 42069			//Same as the spawn seed of the game
+#define HELD_PIECE_CELLS 4			//Cells of the held piece checked a frame, every piece covers 4
+
+#pragma region
+void FillBoard(SimState* sim, int enemies);
+_Bool ScanGetAliveEnemyFromGrid(SimState const* sim, int x, int y, EnemyInfo* enemy);
+_Bool ScanHasLiveEnemyInCell(SimState const* sim, int x, int y);
+_Bool ReadArguments(int argc, char* argv[]);
+void PrintUsage(void);
+double GetSeconds(void);
+#pragma endregion Forward Declarations
+
+//Run settings from the command line
+long long frames = DEFAULT_FRAMES;
+uint64_t seed = DEFAULT_SEED;
+
+volatile int sink;					//Read back from the queries so none of them can be left out
+
+int main(int argc, char* argv[]){
+	if(!ReadArguments(argc,argv)){
+		PrintUsage();
+		return 1;
+	}
+
+	SimInitEnemyPool();
+	static int const enemyCounts[] = { 0, 20, 40, 80 };
+	printf("%lld frames of %d cell reads and %d cell checks\n",frames,TOTAL_XGRID * TOTAL_YGRID,HELD_PIECE_CELLS);
+	printf("  enemies   index       scan\n");
+
+	for(size_t count = 0; count < sizeof(enemyCounts) / sizeof(enemyCounts[0]); ++count){
+		SimState sim;
+		FillBoard(&sim,enemyCounts[count]);
+		EnemyInfo enemy;
+		int found = 0;
+
+		double start = GetSeconds();
+		for(long long frame = 0; frame < frames; ++frame){
+			for(int x = 0; x < TOTAL_XGRID; ++x){
+				for(int y = 0; y < TOTAL_YGRID; ++y) found += SimGetEnemy(&sim,x,y,&enemy);
+			}
+			for(int cell = 0; cell < HELD_PIECE_CELLS; ++cell) found += SimHasLiveEnemy(&sim,(int)(frame + cell) % TOTAL_XGRID,cell);
+		}
+		double indexSeconds = GetSeconds() - start;
+
+		start = GetSeconds();
+		for(long long frame = 0; frame < frames; ++frame){
+			for(int x = 0; x < TOTAL_XGRID; ++x){
+				for(int y = 0; y < TOTAL_YGRID; ++y) found -= ScanGetAliveEnemyFromGrid(&sim,x,y,&enemy);
+			}
+			for(int cell = 0; cell < HELD_PIECE_CELLS; ++cell) found -= ScanHasLiveEnemyInCell(&sim,(int)(frame + cell) % TOTAL_XGRID,cell);
+		}
+		double scanSeconds = GetSeconds() - start;
+
+		//Both answer the same, so what was found comes back to 0
+		if(found != 0) fprintf(stderr,"The index and the scan found different enemies\n");
+		sink = found;
+		printf("  %-7d %7.2f us %7.2f us per frame\n",sim.liveCount,indexSeconds / frames * 1e6,scanSeconds / frames * 1e6);
+	}
+	return 0;
+}
+
+//Puts enemies of every zombie type in random free cells of the board the player can play on
+void FillBoard(SimState* sim, int enemies){
+	SimInit(sim,NULL,seed);
+	SimRandom random;
+	SimRandomSeed(&random,seed,SIM_RANDOM_STREAM_LENGTH);
+	int spawned = 0;
+	while(spawned < enemies){
+		int x = SimRandomRange(&random,0,TOTAL_XGRID-2);
+		int y = SimRandomRange(&random,0,TOTAL_YGRID-1);
+		if(SimHasLiveEnemy(sim,x,y)) continue;
+		SimSpawnEnemyInCell(sim,x,y,SimGetEnemyPrefab(1 + spawned % (SimGetEnemyCount() - 1)));
+		++spawned;
+	}
+}
+
+//______________________________________________________________
+// The queries from before the cell index, as they were in WaveSystem.c but reading the SimState
+
+//Copies out the live enemy in the specified grid. Returns FALSE if otherwise.
+_Bool ScanGetAliveEnemyFromGrid(SimState const* sim, int x, int y, EnemyInfo* enemy){
+	if(!ScanHasLiveEnemyInCell(sim,x,y))return FALSE;
+	for(short i=0; i< WAVEOBJECTCOUNT;++i){
+		if((sim->waveObjects.x[i] == x) && (sim->waveObjects.y[i] ==y)){
+			if(sim->waveObjects.isAlive[i]){
+				SimGetEnemyInSlot(sim,i,enemy);
+				return TRUE;
+			}
+		}
+	}
+	return FALSE;
+}
+
+//Checks if the enemy in the specified cell is alive.
+_Bool ScanHasLiveEnemyInCell(SimState const* sim, int x, int y){
+	for(short i=0; i< WAVEOBJECTCOUNT;++i){
+		if((sim->waveObjects.x[i] == x) && (sim->waveObjects.y[i] ==y)){
+			if(sim->waveObjects.isAlive[i]) return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+//______________________________________________________________
+// Command line
+
+//Reads the command line into the run settings, returns FALSE if something is wrong with it.
+_Bool ReadArguments(int argc, char* argv[]){
+	for(int i = 1; i < argc; ++i){
+		char const* option = argv[i];
+		if(strcmp(option,"--help") == 0 || strcmp(option,"-h") == 0) return FALSE;
+		if(i + 1 >= argc){
+			fprintf(stderr,"Missing value for %s\n",option);
+			return FALSE;
+		}
+		char const* value = argv[++i];
+
+		if(strcmp(option,"--frames") == 0) frames = atoll(value);
+		else if(strcmp(option,"--seed") == 0) seed = strtoull(value,NULL,10);
+		else{
+			fprintf(stderr,"Unknown option %s\n",option);
+			return FALSE;
+		}
+	}
+	if(frames <= 0){
+		fprintf(stderr,"--frames has to be at least 1\n");
+		return FALSE;
+	}
+	return TRUE;
+}
+
+void PrintUsage(void){
+	fprintf(stderr,"Usage: GridBench [--frames N] [--seed S]\n");
+	fprintf(stderr,"  --frames  frames of queries timed on each board (default %d)\n",DEFAULT_FRAMES);
+	fprintf(stderr,"  --seed    seed of the cells the enemies are put in (default %d)\n",DEFAULT_SEED);
+}
+
+//______________________________________________________________
+// Timing
+
+double GetSeconds(void){
+	struct timespec time;
+	timespec_get(&time,TIME_UTC);
+	return (double)time.tv_sec + (double)time.tv_nsec / 1e9;
+}
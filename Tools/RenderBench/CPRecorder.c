@@ -0,0 +1,1318 @@
+/*!
+@file	  CPRecorder.c
+@date     17/10/2026
+@brief    This source file contains the recording backend of CProcessing, see CPRecorder.h. The functions are in the
+		  same order as cprocessing.h.
+
+		  Command log, one line per call counted: the CProcessing function and its arguments, e.g.
+		  CP_Graphics_DrawRect 10.00 20.00 64.00 64.00
+		  CP_Font_DrawText "WAVE 01/30" 1856.00 64.00
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "CPRecorder.h"
+#include "Png.h"		//For decoding images in real time
+
+#define FRAME_RATE 60.0f
+#define KEY_COUNT (KEY_MENU + 1)
+#define MOUSE_BUTTON_COUNT (MOUSE_BUTTON_LAST + 1)
+#define MAX_SAVED_SETTINGS 32			//CP_Settings_Save calls that can be nested
+#define MAX_FONTS 16					//Different font files, there is no CP_Font_Free so they are kept
+#define PI 3.14159265358979f
+
+struct CP_Image_Struct{
+	int width;
+	int height;
+	CP_Color* pixels;					//Only images made from data or decoded in real time keep their pixels
+};
+
+struct CP_Sound_Struct{
+	int id;
+};
+
+struct CP_Font_Struct{
+	int id;
+	char path[260];
+};
+
+/*______________________________________________________________
+@brief Everything CP_Settings_* sets, kept so changes that set what is already set can be counted.
+*/
+typedef struct DrawSettings{
+	CP_Color fill, stroke, tint;
+	_Bool hasFill, hasStroke, hasTint, antiAlias;
+	float strokeWeight, textSize;
+	CP_LINE_CAP_MODE capMode;
+	CP_LINE_JOINT_MODE jointMode;
+	CP_POSITION_MODE rectMode, ellipseMode, imageMode;
+	CP_BLEND_MODE blendMode;
+	CP_IMAGE_FILTER_MODE filterMode;
+	CP_IMAGE_WRAP_MODE wrapMode;
+	CP_TEXT_ALIGN_HORIZONTAL hAlign;
+	CP_TEXT_ALIGN_VERTICAL vAlign;
+	CP_Matrix matrix;
+	CP_Font font;
+} DrawSettings;
+
+//All static, the game is linked in with -fcommon and globals of the same name would be merged with its own
+
+//Game states
+static FunctionPtr stateInit, stateUpdate, stateExit;
+static FunctionPtr nextInit, nextUpdate, nextExit;
+static FunctionPtr preUpdate, postUpdate;
+static _Bool hasNextState, isTerminated;
+static int stateSwitches;
+
+//Window and time
+static int windowWidth, windowHeight;
+static unsigned frameCount;
+static float frameRate = FRAME_RATE;
+static _Bool realTime;					//Time is the wall clock's and loads do the work CProcessing does, see CPRecorderSetRealTime
+static double startSeconds, frameStartSeconds;
+static float realDt;
+
+//What is being drawn with
+static DrawSettings settings;
+static DrawSettings savedSettings[MAX_SAVED_SETTINGS];
+static int savedCount;
+static struct CP_Font_Struct defaultFont;
+static struct CP_Font_Struct fonts[MAX_FONTS];
+static int fontCount;
+static int loadedAssets;
+
+//Counters and the log
+static CPRecorderCounters frameCounters, totalCounters;
+static int missingAssets;
+static FILE* commandLog;
+
+//Input, what is set now and what it was last frame
+static _Bool keyDown[KEY_COUNT], keyWasDown[KEY_COUNT], keySet[KEY_COUNT];
+static _Bool mouseDown[MOUSE_BUTTON_COUNT], mouseWasDown[MOUSE_BUTTON_COUNT], mouseSet[MOUSE_BUTTON_COUNT];
+static float mouseX, mouseY, mousePreviousX, mousePreviousY, mouseSetX, mouseSetY;
+
+//Sound groups
+static float groupVolume[CP_SOUND_GROUP_MAX], groupPitch[CP_SOUND_GROUP_MAX];
+
+//Random numbers
+static unsigned int randomState = 0x9E3779B9u;
+static int noiseSeed;
+
+#pragma region
+static void ExitState(void);
+static void Log(char const* format, ...);
+static void CountDraw(void);
+static void CountState(_Bool changed);
+static _Bool IsSameColor(CP_Color a, CP_Color b);
+static _Bool FileExists(char const* path);
+static unsigned char* ReadFile(char const* path, size_t* size);
+static double GetWallSeconds(void);
+static void ReadPngSize(char const* path, int* width, int* height);
+static float HueToRgb(float p, float q, float t);
+static unsigned int HashNoise(int x, int y, int z);
+static float Fade(float t);
+#pragma endregion Forward Declarations
+
+//______________________________________________________________
+// Recorder
+
+void CPRecorderInit(int width, int height){
+	stateInit = stateUpdate = stateExit = NULL;
+	nextInit = nextUpdate = nextExit = NULL;
+	preUpdate = postUpdate = NULL;
+	hasNextState = isTerminated = FALSE;
+	stateSwitches = 0;
+
+	windowWidth = width;
+	windowHeight = height;
+	frameCount = 0;
+	frameRate = FRAME_RATE;
+	startSeconds = frameStartSeconds = GetWallSeconds();
+	realDt = 1.0f / frameRate;
+
+	memset(&settings,0,sizeof(settings));
+	settings.fill = CP_Color_Create(255,255,255,255);
+	settings.stroke = CP_Color_Create(0,0,0,255);
+	settings.hasFill = settings.hasStroke = settings.antiAlias = TRUE;
+	settings.strokeWeight = 1.0f;
+	settings.textSize = 20.0f;
+	settings.jointMode = CP_LINE_JOINT_BEVEL;
+	settings.rectMode = settings.imageMode = CP_POSITION_CORNER;
+	settings.ellipseMode = CP_POSITION_CENTER;
+	settings.hAlign = CP_TEXT_ALIGN_H_LEFT;
+	settings.vAlign = CP_TEXT_ALIGN_V_BASELINE;
+	settings.matrix = CP_Matrix_Identity();
+	settings.font = &defaultFont;
+	savedCount = 0;
+
+	memset(&frameCounters,0,sizeof(frameCounters));
+	memset(&totalCounters,0,sizeof(totalCounters));
+	missingAssets = 0;
+
+	memset(keyDown,0,sizeof(keyDown));
+	memset(keyWasDown,0,sizeof(keyWasDown));
+	memset(keySet,0,sizeof(keySet));
+	memset(mouseDown,0,sizeof(mouseDown));
+	memset(mouseWasDown,0,sizeof(mouseWasDown));
+	memset(mouseSet,0,sizeof(mouseSet));
+	mouseX = mouseY = mousePreviousX = mousePreviousY = mouseSetX = mouseSetY = 0.0f;
+
+	for(int group = 0; group < CP_SOUND_GROUP_MAX; ++group){
+		groupVolume[group] = 1.0f;
+		groupPitch[group] = 1.0f;
+	}
+}
+
+_Bool CPRecorderRunFrame(void){
+	if(isTerminated){
+		ExitState();
+		return FALSE;
+	}
+
+	//dt is from the start of the last frame to the start of this one, like in CProcessing
+	if(realTime){
+		double now = GetWallSeconds();
+		realDt = frameCount > 0 ? (float)(now - frameStartSeconds) : 1.0f / frameRate;
+		frameStartSeconds = now;
+	}
+
+	//The state set during the last frame starts now, like in CProcessing
+	if(hasNextState){
+		hasNextState = FALSE;
+		if(stateExit) stateExit();
+		stateInit = nextInit;
+		stateUpdate = nextUpdate;
+		stateExit = nextExit;
+		++stateSwitches;
+		if(stateInit) stateInit();
+	}
+
+	//Input set since the last frame
+	memcpy(keyWasDown,keyDown,sizeof(keyDown));
+	memcpy(keyDown,keySet,sizeof(keySet));
+	memcpy(mouseWasDown,mouseDown,sizeof(mouseDown));
+	memcpy(mouseDown,mouseSet,sizeof(mouseSet));
+	mousePreviousX = mouseX;
+	mousePreviousY = mouseY;
+	mouseX = mouseSetX;
+	mouseY = mouseSetY;
+
+	memset(&frameCounters,0,sizeof(frameCounters));
+	settings.matrix = CP_Matrix_Identity();
+	savedCount = 0;
+	Log("frame %u\n",frameCount);
+
+	if(preUpdate) preUpdate();
+	if(stateUpdate) stateUpdate();
+	if(postUpdate) postUpdate();
+
+	totalCounters.drawCalls += frameCounters.drawCalls;
+	totalCounters.imageDraws += frameCounters.imageDraws;
+	totalCounters.textDraws += frameCounters.textDraws;
+	totalCounters.textCharacters += frameCounters.textCharacters;
+	totalCounters.stateChanges += frameCounters.stateChanges;
+	totalCounters.redundantStateChanges += frameCounters.redundantStateChanges;
+	totalCounters.clears += frameCounters.clears;
+	totalCounters.soundsPlayed += frameCounters.soundsPlayed;
+	++frameCount;
+	if(isTerminated) ExitState();
+	return !isTerminated;
+}
+
+CPRecorderCounters CPRecorderGetFrameCounters(void){
+	return frameCounters;
+}
+
+CPRecorderCounters CPRecorderGetTotalCounters(void){
+	return totalCounters;
+}
+
+int CPRecorderGetStateSwitches(void){
+	return stateSwitches;
+}
+
+int CPRecorderGetMissingAssets(void){
+	return missingAssets;
+}
+
+void CPRecorderSetLog(FILE* log){
+	commandLog = log;
+}
+
+void CPRecorderSetKey(CP_KEY key, _Bool down){
+	if(key > KEY_ANY && key < KEY_COUNT) keySet[key] = down;
+}
+
+void CPRecorderSetMouseButton(CP_MOUSE button, _Bool down){
+	if(button >= 0 && button < MOUSE_BUTTON_COUNT) mouseSet[button] = down;
+}
+
+void CPRecorderSetRealTime(_Bool enabled){
+	realTime = enabled;
+}
+
+void CPRecorderSetMouse(float x, float y){
+	mouseSetX = x;
+	mouseSetY = y;
+}
+
+//______________________________________________________________
+// Engine
+
+void CP_Engine_Run(void){
+	while(CPRecorderRunFrame());
+}
+
+void CP_Engine_Terminate(void){
+	isTerminated = TRUE;
+}
+
+void CP_Engine_SetNextGameState(FunctionPtr init, FunctionPtr update, FunctionPtr exit){
+	nextInit = init;
+	nextUpdate = update;
+	nextExit = exit;
+	hasNextState = TRUE;
+}
+
+//Forced restarts the state even if it is the one running, the same as a normal switch here
+void CP_Engine_SetNextGameStateForced(FunctionPtr init, FunctionPtr update, FunctionPtr exit){
+	CP_Engine_SetNextGameState(init,update,exit);
+}
+
+void CP_Engine_SetPreUpdateFunction(FunctionPtr preUpdateFunction){
+	preUpdate = preUpdateFunction;
+}
+
+void CP_Engine_SetPostUpdateFunction(FunctionPtr postUpdateFunction){
+	postUpdate = postUpdateFunction;
+}
+
+//______________________________________________________________
+// System
+
+void CP_System_SetWindowSize(int new_width, int new_height){
+	windowWidth = new_width;
+	windowHeight = new_height;
+}
+
+void CP_System_SetWindowPosition(int x, int y){
+	(void)x; (void)y;
+}
+
+void CP_System_Fullscreen(void){
+	CP_System_SetWindowSize(CP_RECORDER_DISPLAY_WIDTH,CP_RECORDER_DISPLAY_HEIGHT);
+}
+
+void CP_System_FullscreenAdvanced(int targetWidth, int targetHeight){
+	CP_System_SetWindowSize(targetWidth,targetHeight);
+}
+
+int CP_System_GetWindowWidth(void){
+	return windowWidth;
+}
+
+int CP_System_GetWindowHeight(void){
+	return windowHeight;
+}
+
+int CP_System_GetDisplayWidth(void){
+	return CP_RECORDER_DISPLAY_WIDTH;
+}
+
+int CP_System_GetDisplayHeight(void){
+	return CP_RECORDER_DISPLAY_HEIGHT;
+}
+
+HWND CP_System_GetWindowHandle(void){
+	return NULL;
+}
+
+void CP_System_SetWindowTitle(const char* title){
+	(void)title;
+}
+
+void CP_System_ShowCursor(CP_BOOL show){
+	(void)show;
+}
+
+unsigned CP_System_GetFrameCount(void){
+	return frameCount;
+}
+
+float CP_System_GetFrameRate(void){
+	return frameRate;
+}
+
+void CP_System_SetFrameRate(float fps){
+	if(fps > 0.0f) frameRate = fps;
+}
+
+//Every frame takes exactly as long as the frame rate says, so runs are the same every time, unless in real time
+float CP_System_GetDt(void){
+	return realTime ? realDt : 1.0f / frameRate;
+}
+
+float CP_System_GetMillis(void){
+	return CP_System_GetSeconds() * 1000.0f;
+}
+
+float CP_System_GetSeconds(void){
+	return realTime ? (float)(GetWallSeconds() - startSeconds) : (float)frameCount / frameRate;
+}
+
+//______________________________________________________________
+// Settings
+
+void CP_Settings_Fill(CP_Color c){
+	CountState(!settings.hasFill || !IsSameColor(settings.fill,c));
+	Log("CP_Settings_Fill %d %d %d %d\n",c.r,c.g,c.b,c.a);
+	settings.fill = c;
+	settings.hasFill = TRUE;
+}
+
+void CP_Settings_NoFill(void){
+	CountState(settings.hasFill);
+	Log("CP_Settings_NoFill\n");
+	settings.hasFill = FALSE;
+}
+
+void CP_Settings_Stroke(CP_Color c){
+	CountState(!settings.hasStroke || !IsSameColor(settings.stroke,c));
+	Log("CP_Settings_Stroke %d %d %d %d\n",c.r,c.g,c.b,c.a);
+	settings.stroke = c;
+	settings.hasStroke = TRUE;
+}
+
+void CP_Settings_NoStroke(void){
+	CountState(settings.hasStroke);
+	Log("CP_Settings_NoStroke\n");
+	settings.hasStroke = FALSE;
+}
+
+void CP_Settings_StrokeWeight(float weight){
+	CountState(settings.strokeWeight != weight);
+	Log("CP_Settings_StrokeWeight %.2f\n",weight);
+	settings.strokeWeight = weight;
+}
+
+void CP_Settings_Tint(CP_Color c){
+	CountState(!settings.hasTint || !IsSameColor(settings.tint,c));
+	Log("CP_Settings_Tint %d %d %d %d\n",c.r,c.g,c.b,c.a);
+	settings.tint = c;
+	settings.hasTint = TRUE;
+}
+
+void CP_Settings_NoTint(void){
+	CountState(settings.hasTint);
+	Log("CP_Settings_NoTint\n");
+	settings.hasTint = FALSE;
+}
+
+void CP_Settings_AntiAlias(CP_BOOL antiAlias){
+	CountState(settings.antiAlias != (antiAlias != 0));
+	Log("CP_Settings_AntiAlias %u\n",antiAlias);
+	settings.antiAlias = antiAlias != 0;
+}
+
+void CP_Settings_LineCapMode(CP_LINE_CAP_MODE capMode){
+	CountState(settings.capMode != capMode);
+	Log("CP_Settings_LineCapMode %d\n",(int)capMode);
+	settings.capMode = capMode;
+}
+
+void CP_Settings_LineJointMode(CP_LINE_JOINT_MODE jointMode){
+	CountState(settings.jointMode != jointMode);
+	Log("CP_Settings_LineJointMode %d\n",(int)jointMode);
+	settings.jointMode = jointMode;
+}
+
+void CP_Settings_RectMode(CP_POSITION_MODE mode){
+	CountState(settings.rectMode != mode);
+	Log("CP_Settings_RectMode %d\n",(int)mode);
+	settings.rectMode = mode;
+}
+
+void CP_Settings_EllipseMode(CP_POSITION_MODE mode){
+	CountState(settings.ellipseMode != mode);
+	Log("CP_Settings_EllipseMode %d\n",(int)mode);
+	settings.ellipseMode = mode;
+}
+
+void CP_Settings_ImageMode(CP_POSITION_MODE mode){
+	CountState(settings.imageMode != mode);
+	Log("CP_Settings_ImageMode %d\n",(int)mode);
+	settings.imageMode = mode;
+}
+
+void CP_Settings_BlendMode(CP_BLEND_MODE blendMode){
+	CountState(settings.blendMode != blendMode);
+	Log("CP_Settings_BlendMode %d\n",(int)blendMode);
+	settings.blendMode = blendMode;
+}
+
+void CP_Settings_ImageFilterMode(CP_IMAGE_FILTER_MODE filterMode){
+	CountState(settings.filterMode != filterMode);
+	Log("CP_Settings_ImageFilterMode %d\n",(int)filterMode);
+	settings.filterMode = filterMode;
+}
+
+void CP_Settings_ImageWrapMode(CP_IMAGE_WRAP_MODE wrapMode){
+	CountState(settings.wrapMode != wrapMode);
+	Log("CP_Settings_ImageWrapMode %d\n",(int)wrapMode);
+	settings.wrapMode = wrapMode;
+}
+
+void CP_Settings_TextSize(float size){
+	CountState(settings.textSize != size);
+	Log("CP_Settings_TextSize %.2f\n",size);
+	settings.textSize = size;
+}
+
+void CP_Settings_TextAlignment(CP_TEXT_ALIGN_HORIZONTAL h, CP_TEXT_ALIGN_VERTICAL v){
+	CountState(settings.hAlign != h || settings.vAlign != v);
+	Log("CP_Settings_TextAlignment %d %d\n",(int)h,(int)v);
+	settings.hAlign = h;
+	settings.vAlign = v;
+}
+
+void CP_Settings_Scale(float xScale, float yScale){
+	CountState(xScale != 1.0f || yScale != 1.0f);
+	Log("CP_Settings_Scale %.2f %.2f\n",xScale,yScale);
+	settings.matrix = CP_Matrix_Multiply(settings.matrix,CP_Matrix_Scale(CP_Vector_Set(xScale,yScale)));
+}
+
+void CP_Settings_Rotate(float degrees){
+	CountState(degrees != 0.0f);
+	Log("CP_Settings_Rotate %.2f\n",degrees);
+	settings.matrix = CP_Matrix_Multiply(settings.matrix,CP_Matrix_Rotate(degrees));
+}
+
+void CP_Settings_Translate(float x, float y){
+	CountState(x != 0.0f || y != 0.0f);
+	Log("CP_Settings_Translate %.2f %.2f\n",x,y);
+	settings.matrix = CP_Matrix_Multiply(settings.matrix,CP_Matrix_Translate(CP_Vector_Set(x,y)));
+}
+
+void CP_Settings_ApplyMatrix(CP_Matrix matrix){
+	CountState(memcmp(&matrix,&settings.matrix,sizeof(CP_Matrix)) != 0);
+	Log("CP_Settings_ApplyMatrix\n");
+	settings.matrix = CP_Matrix_Multiply(settings.matrix,matrix);
+}
+
+void CP_Settings_ResetMatrix(void){
+	CP_Matrix identity = CP_Matrix_Identity();
+	CountState(memcmp(&identity,&settings.matrix,sizeof(CP_Matrix)) != 0);
+	Log("CP_Settings_ResetMatrix\n");
+	settings.matrix = identity;
+}
+
+void CP_Settings_Save(void){
+	CountState(TRUE);
+	Log("CP_Settings_Save\n");
+	if(savedCount < MAX_SAVED_SETTINGS) savedSettings[savedCount] = settings;
+	++savedCount;
+}
+
+void CP_Settings_Restore(void){
+	CountState(TRUE);
+	Log("CP_Settings_Restore\n");
+	if(savedCount == 0)return;
+	--savedCount;
+	if(savedCount < MAX_SAVED_SETTINGS) settings = savedSettings[savedCount];
+}
+
+//______________________________________________________________
+// Color
+
+CP_Color CP_Color_Create(int r, int g, int b, int a){
+	CP_Color color;
+	color.r = (unsigned char)CP_Math_ClampInt(r,0,255);
+	color.g = (unsigned char)CP_Math_ClampInt(g,0,255);
+	color.b = (unsigned char)CP_Math_ClampInt(b,0,255);
+	color.a = (unsigned char)CP_Math_ClampInt(a,0,255);
+	return color;
+}
+
+CP_Color CP_Color_CreateHex(int hexCode){
+	return CP_Color_Create((hexCode >> 24) & 0xFF,(hexCode >> 16) & 0xFF,(hexCode >> 8) & 0xFF,hexCode & 0xFF);
+}
+
+CP_Color CP_Color_Lerp(CP_Color a, CP_Color b, float t){
+	return CP_Color_Create(CP_Math_LerpInt(a.r,b.r,t),CP_Math_LerpInt(a.g,b.g,t),CP_Math_LerpInt(a.b,b.b,t),CP_Math_LerpInt(a.a,b.a,t));
+}
+
+//Hue is in degrees, saturation and lightness from 0 to 100
+CP_Color CP_Color_FromColorHSL(CP_ColorHSL hsl){
+	float h = (float)(((hsl.h % 360) + 360) % 360) / 360.0f;
+	float s = CP_Math_ClampFloat(hsl.s / 100.0f,0.0f,1.0f);
+	float l = CP_Math_ClampFloat(hsl.l / 100.0f,0.0f,1.0f);
+	if(s == 0.0f){
+		int grey = (int)(l * 255.0f + 0.5f);
+		return CP_Color_Create(grey,grey,grey,hsl.a);
+	}
+	float q = l < 0.5f ? l * (1.0f + s) : l + s - l * s;
+	float p = 2.0f * l - q;
+	return CP_Color_Create((int)(HueToRgb(p,q,h + 1.0f / 3.0f) * 255.0f + 0.5f),(int)(HueToRgb(p,q,h) * 255.0f + 0.5f),
+		(int)(HueToRgb(p,q,h - 1.0f / 3.0f) * 255.0f + 0.5f),hsl.a);
+}
+
+CP_ColorHSL CP_ColorHSL_Create(int h, int s, int l, int a){
+	CP_ColorHSL color = { { h, s, l, a } };
+	return color;
+}
+
+CP_ColorHSL CP_ColorHSL_Lerp(CP_ColorHSL a, CP_ColorHSL b, float t){
+	return CP_ColorHSL_Create(CP_Math_LerpInt(a.h,b.h,t),CP_Math_LerpInt(a.s,b.s,t),CP_Math_LerpInt(a.l,b.l,t),CP_Math_LerpInt(a.a,b.a,t));
+}
+
+CP_ColorHSL CP_ColorHSL_FromColor(CP_Color rgb){
+	float r = rgb.r / 255.0f, g = rgb.g / 255.0f, b = rgb.b / 255.0f;
+	float high = fmaxf(r,fmaxf(g,b)), low = fminf(r,fminf(g,b));
+	float h = 0.0f, s = 0.0f, l = (high + low) / 2.0f;
+	if(high != low){
+		float d = high - low;
+		s = l > 0.5f ? d / (2.0f - high - low) : d / (high + low);
+		if(high == r) h = (g - b) / d + (g < b ? 6.0f : 0.0f);
+		else if(high == g) h = (b - r) / d + 2.0f;
+		else h = (r - g) / d + 4.0f;
+		h /= 6.0f;
+	}
+	return CP_ColorHSL_Create((int)(h * 360.0f + 0.5f),(int)(s * 100.0f + 0.5f),(int)(l * 100.0f + 0.5f),rgb.a);
+}
+
+//______________________________________________________________
+// Graphics
+
+void CP_Graphics_ClearBackground(CP_Color c){
+	++frameCounters.clears;
+	Log("CP_Graphics_ClearBackground %d %d %d %d\n",c.r,c.g,c.b,c.a);
+}
+
+void CP_Graphics_DrawPoint(float x, float y){
+	CountDraw();
+	Log("CP_Graphics_DrawPoint %.2f %.2f\n",x,y);
+}
+
+void CP_Graphics_DrawLine(float x1, float y1, float x2, float y2){
+	CountDraw();
+	Log("CP_Graphics_DrawLine %.2f %.2f %.2f %.2f\n",x1,y1,x2,y2);
+}
+
+void CP_Graphics_DrawLineAdvanced(float x1, float y1, float x2, float y2, float degrees){
+	CountDraw();
+	Log("CP_Graphics_DrawLineAdvanced %.2f %.2f %.2f %.2f %.2f\n",x1,y1,x2,y2,degrees);
+}
+
+void CP_Graphics_DrawRect(float x, float y, float w, float h){
+	CountDraw();
+	Log("CP_Graphics_DrawRect %.2f %.2f %.2f %.2f\n",x,y,w,h);
+}
+
+void CP_Graphics_DrawRectAdvanced(float x, float y, float w, float h, float degrees, float cornerRadius){
+	CountDraw();
+	Log("CP_Graphics_DrawRectAdvanced %.2f %.2f %.2f %.2f %.2f %.2f\n",x,y,w,h,degrees,cornerRadius);
+}
+
+void CP_Graphics_DrawCircle(float x, float y, float d){
+	CountDraw();
+	Log("CP_Graphics_DrawCircle %.2f %.2f %.2f\n",x,y,d);
+}
+
+void CP_Graphics_DrawEllipse(float x, float y, float w, float h){
+	CountDraw();
+	Log("CP_Graphics_DrawEllipse %.2f %.2f %.2f %.2f\n",x,y,w,h);
+}
+
+void CP_Graphics_DrawEllipseAdvanced(float x, float y, float w, float h, float degrees){
+	CountDraw();
+	Log("CP_Graphics_DrawEllipseAdvanced %.2f %.2f %.2f %.2f %.2f\n",x,y,w,h,degrees);
+}
+
+void CP_Graphics_DrawTriangle(float x1, float y1, float x2, float y2, float x3, float y3){
+	CountDraw();
+	Log("CP_Graphics_DrawTriangle %.2f %.2f %.2f %.2f %.2f %.2f\n",x1,y1,x2,y2,x3,y3);
+}
+
+void CP_Graphics_DrawTriangleAdvanced(float x1, float y1, float x2, float y2, float x3, float y3, float degrees){
+	CountDraw();
+	Log("CP_Graphics_DrawTriangleAdvanced %.2f %.2f %.2f %.2f %.2f %.2f %.2f\n",x1,y1,x2,y2,x3,y3,degrees);
+}
+
+void CP_Graphics_DrawQuad(float x1, float y1, float x2, float y2, float x3, float y3, float x4, float y4){
+	CountDraw();
+	Log("CP_Graphics_DrawQuad %.2f %.2f %.2f %.2f %.2f %.2f %.2f %.2f\n",x1,y1,x2,y2,x3,y3,x4,y4);
+}
+
+void CP_Graphics_DrawQuadAdvanced(float x1, float y1, float x2, float y2, float x3, float y3, float x4, float y4, float degrees){
+	CountDraw();
+	Log("CP_Graphics_DrawQuadAdvanced %.2f %.2f %.2f %.2f %.2f %.2f %.2f %.2f %.2f\n",x1,y1,x2,y2,x3,y3,x4,y4,degrees);
+}
+
+void CP_Graphics_BeginShape(void){
+	Log("CP_Graphics_BeginShape\n");
+}
+
+void CP_Graphics_AddVertex(float x, float y){
+	Log("CP_Graphics_AddVertex %.2f %.2f\n",x,y);
+}
+
+//The shape is drawn once it ends, so that is the draw call
+void CP_Graphics_EndShape(void){
+	CountDraw();
+	Log("CP_Graphics_EndShape\n");
+}
+
+//______________________________________________________________
+// Image
+
+//Only the size is read from the file, nothing is ever drawn. In real time the whole png is decoded, like CProcessing does.
+CP_Image CP_Image_Load(const char* filepath){
+	if(!FileExists(filepath)){
+		++missingAssets;
+		return NULL;
+	}
+	CP_Image image = calloc(1,sizeof(struct CP_Image_Struct));
+	if(!image)return NULL;
+	if(realTime){
+		size_t size = 0;
+		unsigned char* bytes = ReadFile(filepath,&size);
+		if(bytes) image->pixels = (CP_Color*)PngDecode(bytes,size,&image->width,&image->height);
+		free(bytes);
+		if(image->pixels) return image;
+	}
+	ReadPngSize(filepath,&image->width,&image->height);
+	return image;
+}
+
+void CP_Image_Free(CP_Image* img){
+	if(!img || !*img)return;
+	free((*img)->pixels);
+	free(*img);
+	*img = NULL;
+}
+
+int CP_Image_GetWidth(CP_Image img){
+	return img ? img->width : 0;
+}
+
+int CP_Image_GetHeight(CP_Image img){
+	return img ? img->height : 0;
+}
+
+void CP_Image_Draw(CP_Image img, float x, float y, float w, float h, int alpha){
+	if(!img)return;
+	CountDraw();
+	++frameCounters.imageDraws;
+	Log("CP_Image_Draw %p %.2f %.2f %.2f %.2f %d\n",(void*)img,x,y,w,h,alpha);
+}
+
+void CP_Image_DrawAdvanced(CP_Image img, float x, float y, float w, float h, int alpha, float degrees){
+	if(!img)return;
+	CountDraw();
+	++frameCounters.imageDraws;
+	Log("CP_Image_DrawAdvanced %p %.2f %.2f %.2f %.2f %d %.2f\n",(void*)img,x,y,w,h,alpha,degrees);
+}
+
+void CP_Image_DrawSubImage(CP_Image img, float x, float y, float w, float h, float u0, float v0, float u1, float v1, int alpha){
+	if(!img)return;
+	CountDraw();
+	++frameCounters.imageDraws;
+	Log("CP_Image_DrawSubImage %p %.2f %.2f %.2f %.2f %.2f %.2f %.2f %.2f %d\n",(void*)img,x,y,w,h,u0,v0,u1,v1,alpha);
+}
+
+//The pixels are kept, so they can be read back with CP_Image_GetPixelData
+CP_Image CP_Image_CreateFromData(int w, int h, unsigned char* pixelDataInput){
+	CP_Image image = calloc(1,sizeof(struct CP_Image_Struct));
+	if(!image)return NULL;
+	image->width = w;
+	image->height = h;
+	image->pixels = malloc(sizeof(CP_Color) * (size_t)w * (size_t)h);
+	if(image->pixels && pixelDataInput) memcpy(image->pixels,pixelDataInput,sizeof(CP_Color) * (size_t)w * (size_t)h);
+	return image;
+}
+
+//Nothing is drawn, so the screen is all black
+CP_Image CP_Image_Screenshot(int x, int y, int w, int h){
+	(void)x; (void)y;
+	CP_Image image = CP_Image_CreateFromData(w,h,NULL);
+	if(image && image->pixels) memset(image->pixels,0,sizeof(CP_Color) * (size_t)w * (size_t)h);
+	return image;
+}
+
+void CP_Image_GetPixelData(CP_Image img, CP_Color* pixelDataOutput){
+	if(!img)return;
+	size_t size = sizeof(CP_Color) * (size_t)img->width * (size_t)img->height;
+	if(img->pixels) memcpy(pixelDataOutput,img->pixels,size);
+	else memset(pixelDataOutput,0,size);
+}
+
+void CP_Image_UpdatePixelData(CP_Image img, CP_Color* pixelDataInput){
+	if(!img)return;
+	size_t size = sizeof(CP_Color) * (size_t)img->width * (size_t)img->height;
+	if(!img->pixels) img->pixels = malloc(size);
+	if(img->pixels) memcpy(img->pixels,pixelDataInput,size);
+}
+
+//______________________________________________________________
+// Sound
+
+//In real time the whole file is read, CProcessing loads a sound into memory
+CP_Sound CP_Sound_Load(const char* filepath){
+	if(!FileExists(filepath)){
+		++missingAssets;
+		return NULL;
+	}
+	if(realTime){
+		size_t size = 0;
+		free(ReadFile(filepath,&size));
+	}
+	CP_Sound sound = malloc(sizeof(struct CP_Sound_Struct));
+	if(sound) sound->id = ++loadedAssets;
+	return sound;
+}
+
+CP_Sound CP_Sound_LoadMusic(const char* filepath){
+	return CP_Sound_Load(filepath);
+}
+
+void CP_Sound_Free(CP_Sound* sound){
+	if(!sound)return;
+	free(*sound);
+	*sound = NULL;
+}
+
+void CP_Sound_Play(CP_Sound sound){
+	CP_Sound_PlayAdvanced(sound,1.0f,1.0f,FALSE,CP_SOUND_GROUP_SFX);
+}
+
+void CP_Sound_PlayMusic(CP_Sound sound){
+	CP_Sound_PlayAdvanced(sound,1.0f,1.0f,TRUE,CP_SOUND_GROUP_MUSIC);
+}
+
+void CP_Sound_PlayAdvanced(CP_Sound sound, float volume, float pitch, CP_BOOL looping, CP_SOUND_GROUP group){
+	if(!sound)return;
+	++frameCounters.soundsPlayed;
+	Log("CP_Sound_PlayAdvanced %d %.2f %.2f %u %d\n",sound->id,volume,pitch,looping,(int)group);
+}
+
+void CP_Sound_PauseAll(void){
+}
+
+void CP_Sound_PauseGroup(CP_SOUND_GROUP group){
+	(void)group;
+}
+
+void CP_Sound_ResumeAll(void){
+}
+
+void CP_Sound_ResumeGroup(CP_SOUND_GROUP group){
+	(void)group;
+}
+
+void CP_Sound_StopAll(void){
+}
+
+void CP_Sound_StopGroup(CP_SOUND_GROUP group){
+	(void)group;
+}
+
+void CP_Sound_SetGroupVolume(CP_SOUND_GROUP group, float volume){
+	if(group >= 0 && group < CP_SOUND_GROUP_MAX) groupVolume[group] = volume;
+}
+
+float CP_Sound_GetGroupVolume(CP_SOUND_GROUP group){
+	return group >= 0 && group < CP_SOUND_GROUP_MAX ? groupVolume[group] : 0.0f;
+}
+
+void CP_Sound_SetGroupPitch(CP_SOUND_GROUP group, float pitch){
+	if(group >= 0 && group < CP_SOUND_GROUP_MAX) groupPitch[group] = pitch;
+}
+
+float CP_Sound_GetGroupPitch(CP_SOUND_GROUP group){
+	return group >= 0 && group < CP_SOUND_GROUP_MAX ? groupPitch[group] : 0.0f;
+}
+
+//______________________________________________________________
+// Font
+
+CP_Font CP_Font_GetDefault(void){
+	return &defaultFont;
+}
+
+//The same file always gives the same font, the game loads its font again in every state
+CP_Font CP_Font_Load(const char* filepath){
+	for(int i = 0; i < fontCount; ++i){
+		if(strcmp(fonts[i].path,filepath) == 0) return &fonts[i];
+	}
+	if(!FileExists(filepath)){
+		++missingAssets;
+		return NULL;
+	}
+	if(fontCount == MAX_FONTS)return &defaultFont;
+	if(realTime){
+		size_t size = 0;
+		free(ReadFile(filepath,&size));
+	}
+	CP_Font font = &fonts[fontCount++];
+	font->id = ++loadedAssets;
+	snprintf(font->path,sizeof(font->path),"%s",filepath);
+	return font;
+}
+
+void CP_Font_Set(CP_Font font){
+	CountState(settings.font != font);
+	Log("CP_Font_Set %p\n",(void*)font);
+	settings.font = font;
+}
+
+void CP_Font_DrawText(const char* text, float x, float y){
+	++frameCounters.textDraws;
+	frameCounters.textCharacters += (long long)strlen(text);
+	Log("CP_Font_DrawText \"%s\" %.2f %.2f\n",text,x,y);
+}
+
+void CP_Font_DrawTextBox(const char* text, float x, float y, float rowWidth){
+	++frameCounters.textDraws;
+	frameCounters.textCharacters += (long long)strlen(text);
+	Log("CP_Font_DrawTextBox \"%s\" %.2f %.2f %.2f\n",text,x,y,rowWidth);
+}
+
+//______________________________________________________________
+// Input
+
+CP_BOOL CP_Input_KeyTriggered(CP_KEY keyCode){
+	if(keyCode == KEY_ANY){
+		for(int key = 1; key < KEY_COUNT; ++key) if(keyDown[key] && !keyWasDown[key]) return TRUE;
+		return FALSE;
+	}
+	return keyCode < KEY_COUNT && keyDown[keyCode] && !keyWasDown[keyCode];
+}
+
+CP_BOOL CP_Input_KeyReleased(CP_KEY keyCode){
+	if(keyCode == KEY_ANY){
+		for(int key = 1; key < KEY_COUNT; ++key) if(!keyDown[key] && keyWasDown[key]) return TRUE;
+		return FALSE;
+	}
+	return keyCode < KEY_COUNT && !keyDown[keyCode] && keyWasDown[keyCode];
+}
+
+CP_BOOL CP_Input_KeyDown(CP_KEY keyCode){
+	if(keyCode == KEY_ANY){
+		for(int key = 1; key < KEY_COUNT; ++key) if(keyDown[key]) return TRUE;
+		return FALSE;
+	}
+	return keyCode < KEY_COUNT && keyDown[keyCode];
+}
+
+CP_BOOL CP_Input_MouseTriggered(CP_MOUSE button){
+	return button >= 0 && button < MOUSE_BUTTON_COUNT && mouseDown[button] && !mouseWasDown[button];
+}
+
+CP_BOOL CP_Input_MouseReleased(CP_MOUSE button){
+	return button >= 0 && button < MOUSE_BUTTON_COUNT && !mouseDown[button] && mouseWasDown[button];
+}
+
+CP_BOOL CP_Input_MouseDown(CP_MOUSE button){
+	return button >= 0 && button < MOUSE_BUTTON_COUNT && mouseDown[button];
+}
+
+CP_BOOL CP_Input_MouseMoved(void){
+	return mouseX != mousePreviousX || mouseY != mousePreviousY;
+}
+
+CP_BOOL CP_Input_MouseClicked(void){
+	return CP_Input_MouseTriggered(MOUSE_BUTTON_LEFT);
+}
+
+CP_BOOL CP_Input_MouseDoubleClicked(void){
+	return FALSE;
+}
+
+CP_BOOL CP_Input_MouseDragged(CP_MOUSE button){
+	return CP_Input_MouseDown(button) && CP_Input_MouseMoved();
+}
+
+float CP_Input_MouseWheel(void){
+	return 0.0f;
+}
+
+float CP_Input_GetMouseX(void){
+	return mouseX;
+}
+
+float CP_Input_GetMouseY(void){
+	return mouseY;
+}
+
+float CP_Input_GetMousePreviousX(void){
+	return mousePreviousX;
+}
+
+float CP_Input_GetMousePreviousY(void){
+	return mousePreviousY;
+}
+
+float CP_Input_GetMouseDeltaX(void){
+	return mouseX - mousePreviousX;
+}
+
+float CP_Input_GetMouseDeltaY(void){
+	return mouseY - mousePreviousY;
+}
+
+float CP_Input_GetMouseWorldX(void){
+	float x, y;
+	CP_Math_ScreenToWorld(mouseX,mouseY,&x,&y);
+	return x;
+}
+
+float CP_Input_GetMouseWorldY(void){
+	float x, y;
+	CP_Math_ScreenToWorld(mouseX,mouseY,&x,&y);
+	return y;
+}
+
+//There are never any gamepads
+CP_BOOL CP_Input_GamepadTriggered(CP_GAMEPAD button){ (void)button; return FALSE; }
+CP_BOOL CP_Input_GamepadTriggeredAdvanced(CP_GAMEPAD button, unsigned gamepadIndex){ (void)button; (void)gamepadIndex; return FALSE; }
+CP_BOOL CP_Input_GamepadReleased(CP_GAMEPAD button){ (void)button; return FALSE; }
+CP_BOOL CP_Input_GamepadReleasedAdvanced(CP_GAMEPAD button, unsigned gamepadIndex){ (void)button; (void)gamepadIndex; return FALSE; }
+CP_BOOL CP_Input_GamepadDown(CP_GAMEPAD button){ (void)button; return FALSE; }
+CP_BOOL CP_Input_GamepadDownAdvanced(CP_GAMEPAD button, unsigned gamepadIndex){ (void)button; (void)gamepadIndex; return FALSE; }
+float CP_Input_GamepadRightTrigger(void){ return 0.0f; }
+float CP_Input_GamepadRightTriggerAdvanced(unsigned gamepadIndex){ (void)gamepadIndex; return 0.0f; }
+float CP_Input_GamepadLeftTrigger(void){ return 0.0f; }
+float CP_Input_GamepadLeftTriggerAdvanced(unsigned gamepadIndex){ (void)gamepadIndex; return 0.0f; }
+CP_Vector CP_Input_GamepadRightStick(void){ return CP_Vector_Zero(); }
+CP_Vector CP_Input_GamepadRightStickAdvanced(unsigned gamepadIndex){ (void)gamepadIndex; return CP_Vector_Zero(); }
+CP_Vector CP_Input_GamepadLeftStick(void){ return CP_Vector_Zero(); }
+CP_Vector CP_Input_GamepadLeftStickAdvanced(unsigned gamepadIndex){ (void)gamepadIndex; return CP_Vector_Zero(); }
+CP_BOOL CP_Input_GamepadConnected(void){ return FALSE; }
+CP_BOOL CP_Input_GamepadConnectedAdvanced(unsigned gamepadIndex){ (void)gamepadIndex; return FALSE; }
+
+//______________________________________________________________
+// Math
+
+int CP_Math_ClampInt(int value, int min, int max){
+	return value < min ? min : value > max ? max : value;
+}
+
+float CP_Math_ClampFloat(float value, float min, float max){
+	return value < min ? min : value > max ? max : value;
+}
+
+int CP_Math_LerpInt(int a, int b, float lerpFactor){
+	return (int)(a + (b - a) * lerpFactor);
+}
+
+float CP_Math_LerpFloat(float a, float b, float lerpFactor){
+	return a + (b - a) * lerpFactor;
+}
+
+float CP_Math_Square(float value){
+	return value * value;
+}
+
+float CP_Math_Distance(float x1, float y1, float x2, float y2){
+	return sqrtf((x2 - x1) * (x2 - x1) + (y2 - y1) * (y2 - y1));
+}
+
+float CP_Math_Degrees(float radians){
+	return radians * 180.0f / PI;
+}
+
+float CP_Math_Radians(float degrees){
+	return degrees * PI / 180.0f;
+}
+
+void CP_Math_ScreenToWorld(float xIn, float yIn, float* xOut, float* yOut){
+	CP_Vector world = CP_Vector_MatrixMultiply(CP_Matrix_Inverse(settings.matrix),CP_Vector_Set(xIn,yIn));
+	*xOut = world.x;
+	*yOut = world.y;
+}
+
+void CP_Math_WorldToScreen(float xIn, float yIn, float* xOut, float* yOut){
+	CP_Vector screen = CP_Vector_MatrixMultiply(settings.matrix,CP_Vector_Set(xIn,yIn));
+	*xOut = screen.x;
+	*yOut = screen.y;
+}
+
+//______________________________________________________________
+// Vector
+
+CP_Vector CP_Vector_Set(float x, float y){
+	CP_Vector vector = { { x, y } };
+	return vector;
+}
+
+CP_Vector CP_Vector_Zero(void){
+	return CP_Vector_Set(0.0f,0.0f);
+}
+
+CP_Vector CP_Vector_Negate(CP_Vector vec){
+	return CP_Vector_Set(-vec.x,-vec.y);
+}
+
+CP_Vector CP_Vector_Add(CP_Vector a, CP_Vector b){
+	return CP_Vector_Set(a.x + b.x,a.y + b.y);
+}
+
+CP_Vector CP_Vector_Subtract(CP_Vector a, CP_Vector b){
+	return CP_Vector_Set(a.x - b.x,a.y - b.y);
+}
+
+CP_Vector CP_Vector_Scale(CP_Vector vec, float scale){
+	return CP_Vector_Set(vec.x * scale,vec.y * scale);
+}
+
+CP_Vector CP_Vector_Normalize(CP_Vector vec){
+	float length = CP_Vector_Length(vec);
+	return length > 0.0f ? CP_Vector_Scale(vec,1.0f / length) : CP_Vector_Zero();
+}
+
+CP_Vector CP_Vector_MatrixMultiply(CP_Matrix mat, CP_Vector vec){
+	return CP_Vector_Set(mat.m00 * vec.x + mat.m01 * vec.y + mat.m02,mat.m10 * vec.x + mat.m11 * vec.y + mat.m12);
+}
+
+float CP_Vector_Length(CP_Vector vec){
+	return sqrtf(vec.x * vec.x + vec.y * vec.y);
+}
+
+float CP_Vector_Distance(CP_Vector a, CP_Vector b){
+	return CP_Vector_Length(CP_Vector_Subtract(a,b));
+}
+
+float CP_Vector_DotProduct(CP_Vector a, CP_Vector b){
+	return a.x * b.x + a.y * b.y;
+}
+
+float CP_Vector_CrossProduct(CP_Vector a, CP_Vector b){
+	return a.x * b.y - a.y * b.x;
+}
+
+//In degrees
+float CP_Vector_Angle(CP_Vector a, CP_Vector b){
+	float lengths = CP_Vector_Length(a) * CP_Vector_Length(b);
+	if(lengths == 0.0f)return 0.0f;
+	return CP_Math_Degrees(acosf(CP_Math_ClampFloat(CP_Vector_DotProduct(a,b) / lengths,-1.0f,1.0f)));
+}
+
+//______________________________________________________________
+// Matrix
+
+CP_Matrix CP_Matrix_Set(float m00, float m01, float m02,
+						float m10, float m11, float m12,
+						float m20, float m21, float m22){
+	CP_Matrix matrix = { { { m00, m01, m02 }, { m10, m11, m12 }, { m20, m21, m22 } } };
+	return matrix;
+}
+
+CP_Matrix CP_Matrix_Identity(void){
+	return CP_Matrix_Set(1,0,0, 0,1,0, 0,0,1);
+}
+
+CP_Matrix CP_Matrix_FromVector(CP_Vector col1, CP_Vector col2, CP_Vector col3){
+	return CP_Matrix_Set(col1.x,col2.x,col3.x, col1.y,col2.y,col3.y, 0,0,1);
+}
+
+CP_Matrix CP_Matrix_Scale(CP_Vector scale){
+	return CP_Matrix_Set(scale.x,0,0, 0,scale.y,0, 0,0,1);
+}
+
+CP_Matrix CP_Matrix_Translate(CP_Vector offset){
+	return CP_Matrix_Set(1,0,offset.x, 0,1,offset.y, 0,0,1);
+}
+
+CP_Matrix CP_Matrix_Rotate(float degrees){
+	return CP_Matrix_RotateRadians(CP_Math_Radians(degrees));
+}
+
+CP_Matrix CP_Matrix_RotateRadians(float radians){
+	float c = cosf(radians), s = sinf(radians);
+	return CP_Matrix_Set(c,-s,0, s,c,0, 0,0,1);
+}
+
+CP_Matrix CP_Matrix_Transpose(CP_Matrix original){
+	return CP_Matrix_Set(original.m00,original.m10,original.m20, original.m01,original.m11,original.m21,
+		original.m02,original.m12,original.m22);
+}
+
+//A matrix that can't be inverted gives the identity
+CP_Matrix CP_Matrix_Inverse(CP_Matrix m){
+	float determinant = m.m00 * (m.m11 * m.m22 - m.m12 * m.m21) - m.m01 * (m.m10 * m.m22 - m.m12 * m.m20)
+		+ m.m02 * (m.m10 * m.m21 - m.m11 * m.m20);
+	if(determinant == 0.0f)return CP_Matrix_Identity();
+	float d = 1.0f / determinant;
+	return CP_Matrix_Set(
+		(m.m11 * m.m22 - m.m12 * m.m21) * d, (m.m02 * m.m21 - m.m01 * m.m22) * d, (m.m01 * m.m12 - m.m02 * m.m11) * d,
+		(m.m12 * m.m20 - m.m10 * m.m22) * d, (m.m00 * m.m22 - m.m02 * m.m20) * d, (m.m02 * m.m10 - m.m00 * m.m12) * d,
+		(m.m10 * m.m21 - m.m11 * m.m20) * d, (m.m01 * m.m20 - m.m00 * m.m21) * d, (m.m00 * m.m11 - m.m01 * m.m10) * d);
+}
+
+CP_Matrix CP_Matrix_Multiply(CP_Matrix a, CP_Matrix b){
+	CP_Matrix result;
+	for(int row = 0; row < 3; ++row){
+		for(int column = 0; column < 3; ++column){
+			result.m[row][column] = a.m[row][0] * b.m[0][column] + a.m[row][1] * b.m[1][column] + a.m[row][2] * b.m[2][column];
+		}
+	}
+	return result;
+}
+
+//______________________________________________________________
+// Random, xorshift so a run is the same every time
+
+CP_BOOL CP_Random_GetBool(void){
+	return (CP_Random_GetInt() & 1u) != 0;
+}
+
+unsigned int CP_Random_GetInt(void){
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 17;
+	randomState ^= randomState << 5;
+	return randomState;
+}
+
+unsigned int CP_Random_RangeInt(unsigned int lowerBound, unsigned int upperBound){
+	if(upperBound <= lowerBound)return lowerBound;
+	return lowerBound + CP_Random_GetInt() % (upperBound - lowerBound + 1u);
+}
+
+float CP_Random_GetFloat(void){
+	return (CP_Random_GetInt() >> 8) / 16777216.0f;
+}
+
+float CP_Random_RangeFloat(float lowerBound, float upperBound){
+	return lowerBound + CP_Random_GetFloat() * (upperBound - lowerBound);
+}
+
+void CP_Random_Seed(int seed){
+	randomState = (unsigned int)seed ? (unsigned int)seed : 0x9E3779B9u;
+}
+
+//Box-Muller, mean 0 and standard deviation 1
+float CP_Random_Gaussian(void){
+	float u = CP_Random_GetFloat(), v = CP_Random_GetFloat();
+	if(u < 1e-7f) u = 1e-7f;
+	return sqrtf(-2.0f * logf(u)) * cosf(2.0f * PI * v);
+}
+
+//Value noise from 0 to 1, smooth between the whole numbers
+float CP_Random_Noise(float x, float y, float z){
+	int x0 = (int)floorf(x), y0 = (int)floorf(y), z0 = (int)floorf(z);
+	float fx = Fade(x - x0), fy = Fade(y - y0), fz = Fade(z - z0);
+	float corners[8];
+	for(int i = 0; i < 8; ++i){
+		corners[i] = (HashNoise(x0 + (i & 1),y0 + ((i >> 1) & 1),z0 + ((i >> 2) & 1)) & 0xFFFFFFu) / 16777215.0f;
+	}
+	float x00 = CP_Math_LerpFloat(corners[0],corners[1],fx), x10 = CP_Math_LerpFloat(corners[2],corners[3],fx);
+	float x01 = CP_Math_LerpFloat(corners[4],corners[5],fx), x11 = CP_Math_LerpFloat(corners[6],corners[7],fx);
+	return CP_Math_LerpFloat(CP_Math_LerpFloat(x00,x10,fy),CP_Math_LerpFloat(x01,x11,fy),fz);
+}
+
+void CP_Random_NoiseSeed(int seed){
+	noiseSeed = seed;
+}
+
+//______________________________________________________________
+// Helpers
+
+//CProcessing calls the exit of the state running when it is terminated, only once
+static void ExitState(void){
+	FunctionPtr exit = stateExit;
+	stateInit = stateUpdate = stateExit = NULL;
+	if(exit) exit();
+}
+
+static void Log(char const* format, ...){
+	if(!commandLog)return;
+	va_list arguments;
+	va_start(arguments,format);
+	vfprintf(commandLog,format,arguments);
+	va_end(arguments);
+}
+
+static void CountDraw(void){
+	++frameCounters.drawCalls;
+}
+
+static void CountState(_Bool changed){
+	++frameCounters.stateChanges;
+	if(!changed) ++frameCounters.redundantStateChanges;
+}
+
+static _Bool IsSameColor(CP_Color a, CP_Color b){
+	return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+}
+
+static _Bool FileExists(char const* path){
+	FILE* file = path ? fopen(path,"rb") : NULL;
+	if(!file)return FALSE;
+	fclose(file);
+	return TRUE;
+}
+
+static unsigned char* ReadFile(char const* path, size_t* size){
+	FILE* file = fopen(path,"rb");
+	if(!file)return NULL;
+	unsigned char* bytes = NULL;
+	long length = fseek(file,0,SEEK_END) == 0 ? ftell(file) : -1;
+	if(length > 0 && fseek(file,0,SEEK_SET) == 0){
+		bytes = malloc((size_t)length);
+		if(bytes && fread(bytes,1,(size_t)length,file) != (size_t)length){
+			free(bytes);
+			bytes = NULL;
+		}
+	}
+	fclose(file);
+	*size = bytes ? (size_t)length : 0;
+	return bytes;
+}
+
+static double GetWallSeconds(void){
+	struct timespec time;
+	timespec_get(&time,TIME_UTC);
+	return (double)time.tv_sec + (double)time.tv_nsec / 1e9;
+}
+
+//The width and height are the first thing in a png, right after the signature and the header chunk's length and type
+static void ReadPngSize(char const* path, int* width, int* height){
+	unsigned char header[24] = { 0 };
+	FILE* file = fopen(path,"rb");
+	*width = *height = 0;
+	if(!file)return;
+	size_t read = fread(header,1,sizeof(header),file);
+	fclose(file);
+	if(read < sizeof(header) || memcmp(header + 12,"IHDR",4) != 0)return;
+	*width = (header[16] << 24) | (header[17] << 16) | (header[18] << 8) | header[19];
+	*height = (header[20] << 24) | (header[21] << 16) | (header[22] << 8) | header[23];
+}
+
+static float HueToRgb(float p, float q, float t){
+	if(t < 0.0f) t += 1.0f;
+	if(t > 1.0f) t -= 1.0f;
+	if(t < 1.0f / 6.0f) return p + (q - p) * 6.0f * t;
+	if(t < 0.5f) return q;
+	if(t < 2.0f / 3.0f) return p + (q - p) * (2.0f / 3.0f - t) * 6.0f;
+	return p;
+}
+
+static unsigned int HashNoise(int x, int y, int z){
+	unsigned int hash = (unsigned int)noiseSeed * 0x27D4EB2Du;
+	hash ^= (unsigned int)x * 0x8DA6B343u;
+	hash ^= (unsigned int)y * 0xD8163841u;
+	hash ^= (unsigned int)z * 0xCB1AB31Fu;
+	hash ^= hash >> 15;
+	hash *= 0x2C1B3C6Du;
+	hash ^= hash >> 12;
+	return hash;
+}
+
+static float Fade(float t){
+	return t * t * (3.0f - 2.0f * t);
+}
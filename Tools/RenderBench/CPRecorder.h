@@ -0,0 +1,108 @@
+/*!
+@file	  CPRecorder.h
+@date     17/10/2026
+@brief    This header file contains the recording backend of CProcessing. CPRecorder.c implements every function of
+		  cprocessing.h without a window: nothing is drawn, every draw, settings change and text is counted instead
+		  (and written to a command log if one is set). Everything else behaves like CProcessing: game states switch at
+		  the start of the next frame, dt is a steady 1/60s, images, fonts and sounds load from the Assets folder and
+		  input is whatever the caller sets with the functions below. In real time (CPRecorderSetRealTime) the clock is
+		  the wall clock instead and loading an asset costs what it does in CProcessing, for timing the start up.
+
+		  CProcessing only ships as a windows DLL, this lets the game run headless on Linux, see RenderBench.c.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#pragma once // Only include this header file once
+
+#include <stdio.h>
+#include "cprocessing.h"
+
+#define CP_RECORDER_DISPLAY_WIDTH 1920		// What CP_System_GetDisplayWidth/Height return, the window starts this size
+#define CP_RECORDER_DISPLAY_HEIGHT 1080
+
+/*______________________________________________________________
+@brief What was sent to CProcessing, per frame or in total.
+*/
+typedef struct CPRecorderCounters{
+	long long drawCalls;				//Shapes and images drawn, text not included
+	long long imageDraws;				//The images of drawCalls
+	long long textDraws;
+	long long textCharacters;
+	long long stateChanges;				//Calls to CP_Settings_* and CP_Font_Set
+	long long redundantStateChanges;	//The ones of stateChanges that set what was already set
+	long long clears;
+	long long soundsPlayed;
+} CPRecorderCounters;
+
+/*____________________________________________________________________*/
+
+/*
+@brief Resets everything: no game state, a window of width by height, no input, no counters.
+*/
+void CPRecorderInit(int width, int height);
+/*____________________________________________________________________*/
+
+/*
+@brief Runs one frame: switches to the next game state if one was set (calling the exit of the old one and the init
+	   of the new one), then calls its update.
+		   Once CP_Engine_Terminate has been called the exit of the state is called and nothing runs after it.
+@return FALSE once CP_Engine_Terminate has been called
+*/
+_Bool CPRecorderRunFrame(void);
+/*____________________________________________________________________*/
+
+/*
+@brief Returns the counters of the last frame run.
+*/
+CPRecorderCounters CPRecorderGetFrameCounters(void);
+/*____________________________________________________________________*/
+
+/*
+@brief Returns the counters of every frame run since CPRecorderInit.
+*/
+CPRecorderCounters CPRecorderGetTotalCounters(void);
+/*____________________________________________________________________*/
+
+/*
+@brief Returns how many times the game state was switched.
+*/
+int CPRecorderGetStateSwitches(void);
+/*____________________________________________________________________*/
+
+/*
+@brief Returns how many images, fonts and sounds could not be found, they are NULL like in CProcessing.
+*/
+int CPRecorderGetMissingAssets(void);
+/*____________________________________________________________________*/
+
+/*
+@brief Writes every call counted to the log, one per line, until it is set to NULL.
+*/
+void CPRecorderSetLog(FILE* log);
+/*____________________________________________________________________*/
+
+/*
+@brief Holds a key down or lets it go from the next frame on, the triggered and released states follow from it.
+*/
+void CPRecorderSetKey(CP_KEY key, _Bool down);
+/*____________________________________________________________________*/
+
+/*
+@brief Holds a mouse button down or lets it go from the next frame on.
+*/
+void CPRecorderSetMouseButton(CP_MOUSE button, _Bool down);
+/*____________________________________________________________________*/
+
+/*
+@brief Moves the mouse to the position in the window from the next frame on.
+*/
+void CPRecorderSetMouse(float x, float y);
+/*____________________________________________________________________*/
+
+/*
+@brief In real time dt is how long it really was since the last frame started and the seconds are the wall clock's,
+	   images are decoded and sounds and fonts read from their files when loaded, like CProcessing does (without
+	   the upload to the GPU). Frames still run as soon as they are asked for, the caller paces them.
+*/
+void CPRecorderSetRealTime(_Bool enabled);
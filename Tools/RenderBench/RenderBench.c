@@ -0,0 +1,355 @@
+/*!
+@file	  RenderBench.c
+@date     17/10/2026
+@brief    This source file contains the render benchmark. It runs the game's own states (gameLevelUpdate,
+		  MainMenuUpdate...) headless against the recording backend of CProcessing (CPRecorder.c) for a number of
+		  frames, and prints how long the CPU side of a frame took and what it sent to CProcessing: draw calls, image
+		  draws, text draws, settings changes and how many of those set what was already set.
+
+		  Nothing is drawn, so the times are only the cost of the game deciding what to draw and submitting it. The
+		  counters are exact and the same every run, so they can be checked on CI to catch a change that draws more.
+		  The mouse is swept across the window so hover effects are drawn too, in the game it can hold a piece of the
+		  hand while it does (--hold) so the piece held is drawn over the grid, and keep a number of rainbow particles
+		  flying (--particles) to see what drawing a lot of them costs, against a particle budget (--budget) to see
+		  what is evicted when they do not fit.
+
+		  --startup instead runs the game from the splash screen in real time, 60 frames a second with the images
+		  decoded and the sounds read like CProcessing does, and prints how long it took until the menu's first frame
+		  was done (the time to interactive) and the longest frame on the way there.
+
+		  Usage: RenderBench [--scene splash|menu|game|credits|options] [--frames N] [--warmup W] [--log FILE]
+		                     [--width W] [--height H] [--hold SLOT] [--particles N] [--budget N]
+		                     [--profile] [--startup]
+		  Exits with 1 if the game could not be set up (e.g. not run from the repository root, so no Assets).
+
+		  Building: Linux only (CProcessing only ships for windows), from the repository root
+		  gcc -O2 -std=gnu11 -fcommon -ITools/RenderBench/compat -ITools/RenderBench -IInc -IExtern/CProcessing/inc
+		      Tools/RenderBench/RenderBench.c Tools/RenderBench/CPRecorder.c Src/[!m]*.c -lm -lpthread -o RenderBench
+		  (Src/[!m]*.c is every source of the game but main.c, which has its own main)
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "AssetLoader.h"
+#include "CPRecorder.h"
+#include "Credits.h"
+#include "gamelevel.h"
+#include "MainMenu.h"
+#include "Options.h"
+#include "Profiler.h"
+#include "Particles.h"
+#include "SoundManager.h"
+#include "splashscreen.h"
+#include "TPlayer.h"
+
+#define FONT_PATH "Assets/PressStart2P-Regular.ttf"		//Loaded by every state, if it is missing so are the Assets
+#define STARTUP_TIMEOUT 30.0								//Seconds --startup waits for the menu
+
+/*______________________________________________________________
+@brief A game state that can be benchmarked.
+*/
+typedef struct Scene{
+	char const* name;
+	FunctionPtr init, update, exit;
+} Scene;
+
+static Scene const scenes[] = {
+	{ "splash", SplashScreenInit, SplashScreenUpdate, SplashScreenExit },
+	{ "menu", MainMenuInit, MainMenuUpdate, MainMenuExit },
+	{ "game", gameLevelInit, gameLevelUpdate, gameLevelExit },
+	{ "credits", CreditsInit, CreditsUpdate, CreditsExit },
+	{ "options", OptionsInit, OptionsUpdate, OptionsExit },
+};
+
+//Settings of the run, static like in CPRecorder.c so they are not merged with the game's globals
+static Scene const* scene = &scenes[2];
+static int frameCount = 600;
+static int warmupCount = 60;			//Frames run before the timing starts, so the scene has settled in
+static char const* logPath = NULL;		//The command log of the last frame goes here
+static int windowWidth = CP_RECORDER_DISPLAY_WIDTH;
+static int windowHeight = CP_RECORDER_DISPLAY_HEIGHT;
+static int holdSlot = -1;				//The slot of the hand picked up in the game, -1 for none
+static int particleBurst = 0;			//Rainbow particles burst in the middle of the game every second they live
+static _Bool showProfile = FALSE;
+static _Bool startup = FALSE;			//Times the start up instead of a scene
+
+#pragma region
+int RunStartup(void);
+_Bool ReadArguments(int argc, char* argv[]);
+void PrintUsage(void);
+void MoveMouse(int frame);
+void BurstParticles(int frame);
+void PrintCounter(char const* name, long long total, long long max);
+int CompareDoubles(void const* a, void const* b);
+double GetSeconds(void);
+#pragma endregion Forward Declarations
+
+int main(int argc, char* argv[]){
+	if(!ReadArguments(argc,argv)){
+		PrintUsage();
+		return 1;
+	}
+	if(startup) return RunStartup();
+
+	//The splash screen does the setup every state needs (window size, enemies, pieces) and starts loading the
+	//assets, so it always runs for a frame first. It makes the window fullscreen, that is set back to the size asked
+	//for. Frames here take far less than the loading, so it is waited for, or the counters would depend on how fast
+	//the thread was. Other scenes get the sounds like the splash screen does when it is done.
+	CPRecorderInit(windowWidth,windowHeight);
+	CP_Engine_SetNextGameState(SplashScreenInit,SplashScreenUpdate,SplashScreenExit);
+	CPRecorderRunFrame();
+	CP_System_SetWindowSize(windowWidth,windowHeight);
+	if(!CP_Font_Load(FONT_PATH)){
+		fprintf(stderr,"Could not find %s, RenderBench needs to be run from the repository root\n",FONT_PATH);
+		return 1;
+	}
+	FinishAssetLoader();
+	if(scene->init != SplashScreenInit){
+		InitSoundManager();
+		CP_Engine_SetNextGameState(scene->init,scene->update,scene->exit);
+	}
+
+	for(int frame = 0; frame < warmupCount; ++frame){
+		MoveMouse(frame);
+		BurstParticles(frame);
+		CPRecorderRunFrame();
+	}
+	//Clicks the slot and keeps the button down, the piece follows the mouse from then on
+	if(holdSlot >= 0){
+		CP_Vector slot = GetHandSlotPosition(holdSlot);
+		CPRecorderSetMouse(slot.x + hand_slot_length / 2.0f,slot.y + hand_slot_length / 2.0f);
+		CPRecorderSetMouseButton(MOUSE_BUTTON_LEFT,TRUE);
+		CPRecorderRunFrame();
+	}
+	if(showProfile) ProfilerSetEnabled(TRUE);
+
+	double* frameTimes = malloc(sizeof(double) * (size_t)frameCount);
+	if(!frameTimes){
+		fprintf(stderr,"Out of memory\n");
+		return 1;
+	}
+	CPRecorderCounters total = { 0 }, max = { 0 };
+	int switches = CPRecorderGetStateSwitches();
+	FILE* log = NULL;
+
+	for(int frame = 0; frame < frameCount; ++frame){
+		MoveMouse(warmupCount + frame);
+		BurstParticles(warmupCount + frame);
+		if(logPath && frame == frameCount - 1){
+			log = fopen(logPath,"w");
+			if(!log) fprintf(stderr,"Could not write %s\n",logPath);
+			CPRecorderSetLog(log);
+		}
+
+		double start = GetSeconds();
+		CPRecorderRunFrame();
+		frameTimes[frame] = (GetSeconds() - start) * 1000.0;
+
+		CPRecorderCounters counters = CPRecorderGetFrameCounters();
+		total.drawCalls += counters.drawCalls;
+		total.imageDraws += counters.imageDraws;
+		total.textDraws += counters.textDraws;
+		total.textCharacters += counters.textCharacters;
+		total.stateChanges += counters.stateChanges;
+		total.redundantStateChanges += counters.redundantStateChanges;
+		total.clears += counters.clears;
+		total.soundsPlayed += counters.soundsPlayed;
+		if(counters.drawCalls > max.drawCalls) max.drawCalls = counters.drawCalls;
+		if(counters.imageDraws > max.imageDraws) max.imageDraws = counters.imageDraws;
+		if(counters.textDraws > max.textDraws) max.textDraws = counters.textDraws;
+		if(counters.textCharacters > max.textCharacters) max.textCharacters = counters.textCharacters;
+		if(counters.stateChanges > max.stateChanges) max.stateChanges = counters.stateChanges;
+		if(counters.redundantStateChanges > max.redundantStateChanges) max.redundantStateChanges = counters.redundantStateChanges;
+		if(counters.clears > max.clears) max.clears = counters.clears;
+		if(counters.soundsPlayed > max.soundsPlayed) max.soundsPlayed = counters.soundsPlayed;
+	}
+	CPRecorderSetLog(NULL);
+	if(log) fclose(log);
+	switches = CPRecorderGetStateSwitches() - switches;
+	//The music is not checked in, the game plays on without it the same as without any sound
+	if(CPRecorderGetMissingAssets() > 0) fprintf(stderr,"%d assets could not be found\n",CPRecorderGetMissingAssets());
+	//Leaving the game resets the particles, so the pool is read before
+	ParticlePoolStats pool = GetParticlePoolStats();
+	CP_Engine_Terminate();
+	CPRecorderRunFrame();
+
+	double totalTime = 0.0;
+	for(int frame = 0; frame < frameCount; ++frame) totalTime += frameTimes[frame];
+	qsort(frameTimes,(size_t)frameCount,sizeof(double),CompareDoubles);
+
+	printf("%s: %d frames at %dx%d, %d state switches\n",scene->name,frameCount,windowWidth,windowHeight,switches);
+	printf("  frame ms     min %.4f  avg %.4f  p99 %.4f  max %.4f\n",frameTimes[0],totalTime / frameCount,
+		frameTimes[(frameCount * 99 + 99) / 100 - 1],frameTimes[frameCount - 1]);
+	printf("  per frame    %10s %10s\n","avg","max");
+	PrintCounter("draw calls",total.drawCalls,max.drawCalls);
+	PrintCounter("image draws",total.imageDraws,max.imageDraws);
+	PrintCounter("text draws",total.textDraws,max.textDraws);
+	PrintCounter("characters",total.textCharacters,max.textCharacters);
+	PrintCounter("state",total.stateChanges,max.stateChanges);
+	PrintCounter("redundant",total.redundantStateChanges,max.redundantStateChanges);
+	PrintCounter("clears",total.clears,max.clears);
+	PrintCounter("sounds",total.soundsPlayed,max.soundsPlayed);
+	if(scene->init == gameLevelInit){
+		printf("  particles    peak %d of budget %d, evicted %d decorative %d gameplay, dropped %d\n",pool.peak,pool.budget,
+			pool.evicted[PARTICLE_DECORATIVE],pool.evicted[PARTICLE_GAMEPLAY],pool.dropped);
+	}
+	free(frameTimes);
+
+	if(showProfile){
+		printf("  %-14s %8s %8s %8s\n","zone ms","min","avg","p99");
+		for(int zone = 0; zone < PROFILE_ZONE_COUNT; ++zone){
+			ProfileStats stats;
+			if(!ProfilerGetStats((ProfileZone)zone,&stats)) continue;
+			printf("  %-14s %8.4f %8.4f %8.4f\n",ProfilerGetZoneName((ProfileZone)zone),stats.min,stats.avg,stats.p99);
+		}
+	}
+	return 0;
+}
+
+//Runs the game from the splash screen in real time until the menu has done its first frame, the menu is the state after
+//the splash screen. Frames are started every 1/60s like CProcessing's, a frame that took longer starts the next late.
+int RunStartup(void){
+	CPRecorderSetRealTime(TRUE);
+	double start = GetSeconds();
+	CPRecorderInit(windowWidth,windowHeight);
+	CP_Engine_SetNextGameState(SplashScreenInit,SplashScreenUpdate,SplashScreenExit);
+
+	double longestFrame = 0.0;
+	int frames = 0;
+	double nextFrame = start;
+	while(CPRecorderGetStateSwitches() < 2 && GetSeconds() - start < STARTUP_TIMEOUT){
+		double now = GetSeconds();
+		if(now < nextFrame){
+			struct timespec wait = { 0, (long)((nextFrame - now) * 1e9) };
+			nanosleep(&wait,NULL);
+		}
+		nextFrame += 1.0 / 60.0;
+		if(nextFrame < GetSeconds()) nextFrame = GetSeconds();
+
+		double frameStart = GetSeconds();
+		CPRecorderRunFrame();
+		double frameTime = (GetSeconds() - frameStart) * 1000.0;
+		if(frameTime > longestFrame) longestFrame = frameTime;
+		++frames;
+	}
+	double timeToInteractive = (GetSeconds() - start) * 1000.0;
+	_Bool reached = CPRecorderGetStateSwitches() >= 2;
+	CP_Engine_Terminate();
+	CPRecorderRunFrame();
+	if(!reached){
+		fprintf(stderr,"The menu was not reached in %.0f s\n",STARTUP_TIMEOUT);
+		return 1;
+	}
+
+	printf("startup: %d frames at %dx%d\n",frames,windowWidth,windowHeight);
+	printf("  menu after   %.1f ms\n",timeToInteractive);
+	printf("  longest frame %.1f ms\n",longestFrame);
+	return 0;
+}
+
+//Circles the mouse around the middle of the window, over the grid and the hand, a lap every 4 seconds
+void MoveMouse(int frame){
+	float angle = (float)frame * 6.2831853f / 240.0f;
+	CPRecorderSetMouse(windowWidth * (0.5f + 0.35f * cosf(angle)),windowHeight * (0.5f + 0.35f * sinf(angle)));
+}
+
+//Bursts the particles a second after the last burst, the same second they live for, so the same number is always flying
+void BurstParticles(int frame){
+	if(particleBurst <= 0 || frame % 60 != 0) return;
+	RadialParticleRGB(windowWidth * 0.5f,windowHeight * 0.5f,particleBurst,4.0f);
+}
+
+void PrintCounter(char const* name, long long total, long long max){
+	printf("  %-12s %10.1f %10lld\n",name,(double)total / frameCount,max);
+}
+
+int CompareDoubles(void const* a, void const* b){
+	double left = *(double const*)a, right = *(double const*)b;
+	return (left > right) - (left < right);
+}
+
+//Reads the command line into the run settings, returns FALSE if something is wrong with it.
+_Bool ReadArguments(int argc, char* argv[]){
+	for(int i = 1; i < argc; ++i){
+		char const* option = argv[i];
+		if(strcmp(option,"--help") == 0 || strcmp(option,"-h") == 0) return FALSE;
+		if(strcmp(option,"--profile") == 0){
+			showProfile = TRUE;
+			continue;
+		}
+		if(strcmp(option,"--startup") == 0){
+			startup = TRUE;
+			continue;
+		}
+		if(i + 1 >= argc){
+			fprintf(stderr,"Missing value for %s\n",option);
+			return FALSE;
+		}
+		char const* value = argv[++i];
+
+		if(strcmp(option,"--scene") == 0){
+			scene = NULL;
+			for(size_t s = 0; s < sizeof(scenes) / sizeof(scenes[0]); ++s){
+				if(strcmp(value,scenes[s].name) == 0) scene = &scenes[s];
+			}
+			if(!scene){
+				fprintf(stderr,"Unknown scene %s\n",value);
+				return FALSE;
+			}
+		}
+		else if(strcmp(option,"--frames") == 0) frameCount = atoi(value);
+		else if(strcmp(option,"--warmup") == 0) warmupCount = atoi(value);
+		else if(strcmp(option,"--log") == 0) logPath = value;
+		else if(strcmp(option,"--width") == 0) windowWidth = atoi(value);
+		else if(strcmp(option,"--height") == 0) windowHeight = atoi(value);
+		else if(strcmp(option,"--hold") == 0) holdSlot = atoi(value);
+		else if(strcmp(option,"--particles") == 0) particleBurst = atoi(value);
+		else if(strcmp(option,"--budget") == 0) SetParticleBudget(atoi(value));
+		else{
+			fprintf(stderr,"Unknown option %s\n",option);
+			return FALSE;
+		}
+	}
+	if(frameCount <= 0 || warmupCount < 0 || windowWidth <= 0 || windowHeight <= 0){
+		fprintf(stderr,"--frames, --width and --height have to be at least 1\n");
+		return FALSE;
+	}
+	if(holdSlot >= HAND_SIZE || (holdSlot >= 0 && scene->init != gameLevelInit)){
+		fprintf(stderr,"--hold needs a slot below %d and the game scene\n",HAND_SIZE);
+		return FALSE;
+	}
+	if(particleBurst < 0 || (particleBurst > 0 && scene->init != gameLevelInit)){
+		fprintf(stderr,"--particles needs the game scene\n");
+		return FALSE;
+	}
+	return TRUE;
+}
+
+void PrintUsage(void){
+	fprintf(stderr,"Usage: RenderBench [--scene S] [--frames N] [--warmup W] [--log FILE] [--width W] [--height H] [--hold SLOT] [--particles N] [--budget N] [--profile] [--startup]\n");
+	fprintf(stderr,"  --scene    splash, menu, game, credits or options (default game)\n");
+	fprintf(stderr,"  --frames   frames timed and counted (default 600)\n");
+	fprintf(stderr,"  --warmup   frames run before that (default 60)\n");
+	fprintf(stderr,"  --log      writes every call of the last frame to FILE\n");
+	fprintf(stderr,"  --width    window width (default %d)\n",CP_RECORDER_DISPLAY_WIDTH);
+	fprintf(stderr,"  --height   window height (default %d)\n",CP_RECORDER_DISPLAY_HEIGHT);
+	fprintf(stderr,"  --hold     picks up the piece in the slot of the hand (0 is the wall piece) in the game\n");
+	fprintf(stderr,"  --particles  keeps N rainbow particles flying in the game, a burst every second they live\n");
+	fprintf(stderr,"  --budget   most particles alive at once (default %d)\n",PARTICLE_BUDGET);
+	fprintf(stderr,"  --profile  also prints the game level's profiler zones\n");
+	fprintf(stderr,"  --startup  times how long the game takes to get to the menu in real time, instead of a scene\n");
+}
+
+//______________________________________________________________
+// Timing
+
+double GetSeconds(void){
+	struct timespec time;
+	timespec_get(&time,TIME_UTC);
+	return (double)time.tv_sec + (double)time.tv_nsec / 1e9;
+}
@@ -0,0 +1,38 @@
+/*!
+@file	  windows.h
+@date     17/10/2026
+@brief    This header file stands in for windows.h when building the game on Linux with the recording backend
+		  (CPRecorder.c). It only has what cprocessing_common.h and the game use from windows and the MSVC runtime:
+		  the HWND type, TRUE/FALSE, min/max, sprintf_s and _countof.
+
+		  Only on the include path of RenderBench, the game itself is still built with the real windows.h.
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#pragma once // Only include this header file once
+
+#include <stddef.h>
+#include <stdio.h>
+
+typedef void* HWND;
+typedef int BOOL;
+
+#ifndef TRUE
+#define TRUE 1
+#endif
+#ifndef FALSE
+#define FALSE 0
+#endif
+
+#define __declspec(attribute)	// cprocessing_common.h marks the functions dllimport
+
+#ifndef min
+#define min(a,b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef max
+#define max(a,b) (((a) > (b)) ? (a) : (b))
+#endif
+
+#define sprintf_s(buffer, size, ...) snprintf(buffer, size, __VA_ARGS__)
+#define _countof(array) (sizeof(array) / sizeof((array)[0]))
@@ -0,0 +1,175 @@
+/*!
+@file	  ReplayRunner.c
+@date     17/10/2026
+@brief    This source file contains the replay runner. It plays replays back headless as fast as the rules go, spread
+		  over all the cores, and checks every turn against the hash saved in the replay. A replay that plays out
+		  differently means the rules changed what a game does, the first turn it happens on is printed.
+
+		  Replays come from the game (last.replay after every game) or from BalanceRunner --replays, so a change to
+		  the rules can be checked on thousands of games, and timed on the exact same turns before and after.
+
+		  Usage: ReplayRunner [--threads T] [--repeat N] FILE...
+		  Exits with 1 if any replay could not be read or played out differently.
+
+		  Building: ReplayRunner.vcxproj in the solution, or on Linux from the repository root
+		  gcc -O2 -IInc Tools/ReplayRunner/ReplayRunner.c Src/SimCore.c Src/SimRandom.c Src/SimThreads.c
+		      Src/SimReplay.c -lm -lpthread -o ReplayRunner
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "SimCore.h"
+#include "SimReplay.h"
+#include "SimThreads.h"
+
+/*______________________________________________________________
+@brief How playing back one replay file went.
+*/
+typedef struct ReplayCheck{
+	_Bool loaded;
+	int actions;
+	SimReplayResult result;
+} ReplayCheck;
+
+typedef struct ReplayWorker{
+	int index;
+	long long turns;			//Turns played back by this thread, every repeat counted
+} ReplayWorker;
+
+//Settings of the run, read only once the threads start
+int threadCount = 0;			//0 uses every core
+int repeatCount = 1;
+char** files = NULL;
+int fileCount = 0;
+ReplayCheck* checks = NULL;		//One per file
+
+#pragma region
+_Bool ReadArguments(int argc, char* argv[]);
+void PrintUsage(void);
+double GetSeconds(void);
+void CheckReplays(void* worker);
+#pragma endregion Forward Declarations
+
+int main(int argc, char* argv[]){
+	if(!ReadArguments(argc,argv)){
+		PrintUsage();
+		return 1;
+	}
+	if(threadCount <= 0) threadCount = SimGetCoreCount();
+	if(threadCount > SIM_MAX_THREAD_COUNT) threadCount = SIM_MAX_THREAD_COUNT;
+	if(threadCount > fileCount) threadCount = fileCount;
+
+	SimInitEnemyPool();
+	SimInitPieceShapes();
+
+	checks = calloc((size_t)fileCount,sizeof(ReplayCheck));
+	ReplayWorker* workers = calloc((size_t)threadCount,sizeof(ReplayWorker));
+	if(!checks || !workers){
+		fprintf(stderr,"Out of memory\n");
+		return 1;
+	}
+	for(int i = 0; i < threadCount; ++i) workers[i].index = i;
+
+	double start = GetSeconds();
+	SimRunThreads(CheckReplays,workers,sizeof(ReplayWorker),threadCount);
+	double elapsed = GetSeconds() - start;
+
+	long long turns = 0;
+	for(int i = 0; i < threadCount; ++i) turns += workers[i].turns;
+	free(workers);
+
+	int failed = 0;
+	for(int i = 0; i < fileCount; ++i){
+		ReplayCheck const* check = &checks[i];
+		if(!check->loaded){
+			printf("%s: could not be read\n",files[i]);
+			++failed;
+		}
+		else if(check->result.mismatchAction >= 0){
+			printf("%s: %s on turn %d (action %d of %d)\n",files[i],
+				check->result.invalidAction ? "invalid action" : "plays out differently",
+				check->result.turns,check->result.mismatchAction,check->actions);
+			++failed;
+		}
+	}
+	free(checks);
+
+	printf("%d replays, %d failed, %lld turns in %.2fs on %d threads (%.2fM turns/s)\n",
+		fileCount,failed,turns,elapsed,threadCount,elapsed > 0.0 ? turns / elapsed / 1e6 : 0.0);
+	return failed > 0 ? 1 : 0;
+}
+
+//Worker n checks files n, n + threadCount, n + 2*threadCount... Each worker runs on its own thread.
+void CheckReplays(void* worker){
+	ReplayWorker* replayWorker = (ReplayWorker*)worker;
+	SimReplay replay;
+	SimReplayInit(&replay,0);
+	for(int file = replayWorker->index; file < fileCount; file += threadCount){
+		ReplayCheck* check = &checks[file];
+		check->loaded = SimReplayLoad(&replay,files[file]);
+		if(!check->loaded) continue;
+		check->actions = replay.count;
+
+		//Repeats are only for timing, the same replay always plays out the same
+		for(int repeat = 0; repeat < repeatCount; ++repeat){
+			SimState sim;
+			check->result = SimReplayPlay(&replay,&sim,NULL);
+			replayWorker->turns += check->result.turns;
+		}
+	}
+	SimReplayFree(&replay);
+}
+
+//Reads the command line into the run settings, returns FALSE if something is wrong with it.
+_Bool ReadArguments(int argc, char* argv[]){
+	files = calloc((size_t)argc,sizeof(char*));
+	if(!files)return FALSE;
+	for(int i = 1; i < argc; ++i){
+		char const* option = argv[i];
+		if(strcmp(option,"--help") == 0 || strcmp(option,"-h") == 0) return FALSE;
+		if(strncmp(option,"--",2) != 0){
+			files[fileCount++] = argv[i];
+			continue;
+		}
+		if(i + 1 >= argc){
+			fprintf(stderr,"Missing value for %s\n",option);
+			return FALSE;
+		}
+		char const* value = argv[++i];
+
+		if(strcmp(option,"--threads") == 0) threadCount = atoi(value);
+		else if(strcmp(option,"--repeat") == 0) repeatCount = atoi(value);
+		else{
+			fprintf(stderr,"Unknown option %s\n",option);
+			return FALSE;
+		}
+	}
+	if(fileCount == 0){
+		fprintf(stderr,"No replays given\n");
+		return FALSE;
+	}
+	if(repeatCount <= 0){
+		fprintf(stderr,"--repeat has to be at least 1\n");
+		return FALSE;
+	}
+	return TRUE;
+}
+
+void PrintUsage(void){
+	fprintf(stderr,"Usage: ReplayRunner [--threads T] [--repeat N] FILE...\n");
+	fprintf(stderr,"  --threads  threads to play back on (default every core)\n");
+	fprintf(stderr,"  --repeat   times to play back every replay, for timing (default 1)\n");
+}
+
+//______________________________________________________________
+// Timing
+
+double GetSeconds(void){
+	struct timespec time;
+	timespec_get(&time,TIME_UTC);
+	return (double)time.tv_sec + (double)time.tv_nsec / 1e9;
+}
@@ -0,0 +1,310 @@
+/*!
+@file	  SimBench.c
+@date     17/10/2026
+@brief    This source file contains the benchmarks of the game rules. Each one times a part of SimCore headless and
+		  prints how long it takes, so a change to the rules can be checked for speed on the same workload.
+
+		  snapshot - saves and restores a game in the middle of a wave, with one snapshot kept hot in the cache and
+					 with a ring of snapshots too big for it.
+		  events   - calls the turn events of GameLoop, plain functions and ones with user data, subscribes and
+					 unsubscribes by handle, and swaps turns from inside an event.
+		  profiler - times a profiler zone with the profiler off and on, and the update event with it on.
+
+		  Usage: SimBench [--bench NAME] [--iterations N] [--seed S]
+		  Without --bench every benchmark is run.
+
+		  Building: SimBench.vcxproj in the solution, or on Linux from the repository root
+		  gcc -O2 -IInc Tools/SimBench/SimBench.c Src/SimCore.c Src/SimRandom.c Src/GameLoop.c
+		      Src/Profiler.c -lm -o SimBench
+
+@license  Copyright  2026 DigiPen, All rights reserved.
+________________________________________________________________________________________________________*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "SimCore.h"
+#include "GameLoop.h"
+#include "Profiler.h"
+
+#define DEFAULT_ITERATIONS 10000000
+#define DEFAULT_SEED 42069			//Same as DEFAULT_SPAWN_SEED in TManager.h
+#define SETUP_TURNS 40				//Turns played before timing, so the board and the wave queue are not empty
+#define SNAPSHOT_RING_SIZE 4096		//16MB of snapshots, more than the caches hold
+#define EVENTS_PER_UPDATE 32		//Functions subscribed to the update event, a busy level has about 10
+
+typedef struct Benchmark{
+	char const* name;				//What --bench takes
+	char const* description;
+	void (*Run)(void);
+} Benchmark;
+
+#pragma region
+void BenchSnapshot(void);
+void BenchEvents(void);
+void BenchProfiler(void);
+void CountEvent(void);
+void CountEventWithData(void* counter);
+void SwapBackToPlayer(void);
+void PlaySetupGame(SimState* sim);
+_Bool ReadArguments(int argc, char* argv[]);
+void PrintUsage(void);
+double GetSeconds(void);
+#pragma endregion Forward Declarations
+
+static Benchmark const benchmarks[] = {
+	{ "snapshot", "Saves and restores a game, hot in the cache and from a ring too big for it", BenchSnapshot },
+	{ "events", "Calls, subscribes to and swaps the turn events of GameLoop", BenchEvents },
+	{ "profiler", "Times a profiler zone off and on, and the update event with the profiler on", BenchProfiler },
+};
+#define BENCHMARK_COUNT (int)(sizeof(benchmarks) / sizeof(benchmarks[0]))
+
+//Run settings from the command line
+long long iterations = DEFAULT_ITERATIONS;
+uint64_t baseSeed = DEFAULT_SEED;
+char const* benchName = NULL;
+
+volatile int sink;					//Read back from every restored state so none of the copies can be left out
+int eventCalls;						//Counted by the subscribed events
+
+int main(int argc, char* argv[]){
+	if(!ReadArguments(argc,argv)){
+		PrintUsage();
+		return 1;
+	}
+
+	SimInitEnemyPool();
+	SimInitPieceShapes();
+
+	int ran = 0;
+	for(int i = 0; i < BENCHMARK_COUNT; ++i){
+		if(benchName && strcmp(benchName,benchmarks[i].name) != 0) continue;
+		printf("%s: %s\n",benchmarks[i].name,benchmarks[i].description);
+		benchmarks[i].Run();
+		++ran;
+	}
+	if(ran == 0){
+		fprintf(stderr,"Unknown benchmark %s\n",benchName);
+		PrintUsage();
+		return 1;
+	}
+	return 0;
+}
+
+//______________________________________________________________
+// Benchmarks
+
+//Times SimSaveSnapshot and SimRestoreSnapshot on their own, then a clone (save and restore) through a big ring
+void BenchSnapshot(void){
+	SimState sim;
+	PlaySetupGame(&sim);
+	printf("  snapshot size %zu bytes, wave %d, %d objects on the board\n",sizeof(SimSnapshot),sim.currentWave,sim.liveCount);
+
+	SimSnapshot hot;
+	double start = GetSeconds();
+	for(long long i = 0; i < iterations; ++i){
+		SimSaveSnapshot(&sim,&hot);
+		sink = hot.state.waveIndex;
+	}
+	double saveSeconds = GetSeconds() - start;
+
+	start = GetSeconds();
+	for(long long i = 0; i < iterations; ++i){
+		SimRestoreSnapshot(&sim,&hot);
+		sink = sim.waveIndex;
+	}
+	double restoreSeconds = GetSeconds() - start;
+
+	SimSnapshot* ring = malloc(sizeof(SimSnapshot) * SNAPSHOT_RING_SIZE);
+	if(!ring){
+		fprintf(stderr,"Out of memory\n");
+		return;
+	}
+	for(int i = 0; i < SNAPSHOT_RING_SIZE; ++i) SimSaveSnapshot(&sim,&ring[i]);
+
+	//Save into one slot and restore from the one half the ring away, so both sides miss the cache
+	start = GetSeconds();
+	for(long long i = 0; i < iterations; ++i){
+		SimSaveSnapshot(&sim,&ring[i % SNAPSHOT_RING_SIZE]);
+		SimRestoreSnapshot(&sim,&ring[(i + SNAPSHOT_RING_SIZE / 2) % SNAPSHOT_RING_SIZE]);
+		sink = sim.waveIndex;
+	}
+	double cloneSeconds = GetSeconds() - start;
+	free(ring);
+
+	double bytes = (double)sizeof(SimSnapshot) * (double)iterations;
+	printf("  save (hot)       %7.1f ns  %6.2f GB/s\n",saveSeconds / iterations * 1e9,bytes / saveSeconds / 1e9);
+	printf("  restore (hot)    %7.1f ns  %6.2f GB/s\n",restoreSeconds / iterations * 1e9,bytes / restoreSeconds / 1e9);
+	printf("  clone (ring)     %7.1f ns  %6.2fM clones/s\n",cloneSeconds / iterations * 1e9,iterations / cloneSeconds / 1e6);
+}
+
+//Times calling the update event per function subscribed, subscribing and unsubscribing a function by its handle while
+//the event stays full, and a swap to the zombie turn that swaps back from inside ZOMBIE_START
+void BenchEvents(void){
+	ZeroOutAllEvents();
+	for(int i = 0; i < EVENTS_PER_UPDATE; ++i) SubscribeEvent(PLAYER_UPDATE,CountEvent,i % 3);
+	GameLoopInit();
+
+	long long updates = iterations / EVENTS_PER_UPDATE + 1;
+	eventCalls = 0;
+	double start = GetSeconds();
+	for(long long i = 0; i < updates; ++i) GameLoopUpdate();
+	double plainSeconds = GetSeconds() - start;
+	sink = eventCalls;
+	long long plainCalls = eventCalls;
+
+	ZeroOutAllEvents();
+	for(int i = 0; i < EVENTS_PER_UPDATE; ++i) SubscribeEventEx(PLAYER_UPDATE,CountEventWithData,&eventCalls,i % 3);
+	GameLoopInit();
+	eventCalls = 0;
+	start = GetSeconds();
+	for(long long i = 0; i < updates; ++i) GameLoopUpdate();
+	double dataSeconds = GetSeconds() - start;
+	sink = eventCalls;
+	long long dataCalls = eventCalls;
+
+	//Each subscription is taken out and the next one sorted in when the event is next called, so that is timed too.
+	//The update on its own was timed above, it is taken off
+	start = GetSeconds();
+	for(long long i = 0; i < updates; ++i){
+		EventHandle handle = SubscribeEventEx(PLAYER_UPDATE,CountEventWithData,&eventCalls,(int)(i % 5) - 2);
+		UnsubscribeEventHandle(handle);
+		GameLoopUpdate();
+	}
+	double churnSeconds = GetSeconds() - start - dataSeconds;
+	sink = eventCalls;
+
+	ZeroOutAllEvents();
+	SubscribeEvent(ZOMBIE_START,SwapBackToPlayer,DEFAULT_PRIORITY);
+	GameLoopInit();
+	start = GetSeconds();
+	for(long long i = 0; i < iterations; ++i) GameLoopSwitch(TURN_ZOMBIE);
+	double swapSeconds = GetSeconds() - start;
+	UnsubscribeAllEvents();
+
+	printf("  %d functions on the update event, %lld updates\n",EVENTS_PER_UPDATE,updates);
+	printf("  call (plain)       %7.2f ns per function\n",plainSeconds / plainCalls * 1e9);
+	printf("  call (user data)   %7.2f ns per function\n",dataSeconds / dataCalls * 1e9);
+	printf("  subscribe+remove   %7.2f ns per handle\n",churnSeconds > 0.0 ? churnSeconds / updates * 1e9 : 0.0);
+	printf("  turn swap + back   %7.2f ns\n",swapSeconds / iterations * 1e9);
+}
+
+//Times an empty zone with the profiler off (what every stage costs outside debug mode) and on, a frame every 20 zones
+//like the game level, then the update event again with its zone on
+void BenchProfiler(void){
+	ProfilerSetEnabled(FALSE);
+	double start = GetSeconds();
+	for(long long i = 0; i < iterations; ++i){
+		ProfilerBegin(PROFILE_GRID);
+		ProfilerEnd(PROFILE_GRID);
+	}
+	double offSeconds = GetSeconds() - start;
+
+	ProfilerSetEnabled(TRUE);
+	start = GetSeconds();
+	for(long long i = 0; i < iterations; ++i){
+		if(i % 20 == 0) ProfilerBeginFrame();
+		ProfilerBegin(PROFILE_GRID);
+		ProfilerEnd(PROFILE_GRID);
+		if(i % 20 == 19) ProfilerEndFrame();
+	}
+	double onSeconds = GetSeconds() - start;
+
+	ZeroOutAllEvents();
+	for(int i = 0; i < EVENTS_PER_UPDATE; ++i) SubscribeEvent(PLAYER_UPDATE,CountEvent,DEFAULT_PRIORITY);
+	GameLoopInit();
+	long long updates = iterations / EVENTS_PER_UPDATE + 1;
+	eventCalls = 0;
+	start = GetSeconds();
+	for(long long i = 0; i < updates; ++i){
+		ProfilerBeginFrame();
+		GameLoopUpdate();
+		ProfilerEndFrame();
+	}
+	double eventSeconds = GetSeconds() - start;
+	sink = eventCalls;
+	UnsubscribeAllEvents();
+
+	ProfileStats stats;
+	ProfilerGetStats(PROFILE_PLAYER_UPDATE,&stats);
+	ProfilerSetEnabled(FALSE);
+
+	printf("  zone (off)         %7.2f ns\n",offSeconds / iterations * 1e9);
+	printf("  zone (on)          %7.2f ns\n",onSeconds / iterations * 1e9);
+	printf("  update event (on)  %7.2f ns per function, the zone says avg %.4f ms p99 %.4f ms\n",
+		eventSeconds / eventCalls * 1e9,stats.avg,stats.p99);
+}
+
+void CountEvent(void){
+	++eventCalls;
+}
+
+void CountEventWithData(void* counter){
+	++*(int*)counter;
+}
+
+//Swapping from inside an event is queued, so this swap is done right after the one that called it
+void SwapBackToPlayer(void){
+	GameLoopSwitch(TURN_PLAYER);
+}
+
+//Plays a few turns of random placements so the state looks like a game in progress
+void PlaySetupGame(SimState* sim){
+	SimNewGame(sim,NULL,baseSeed);
+	SimRandom random;
+	SimRandomSeed(&random,baseSeed,SIM_RANDOM_STREAM_LENGTH);
+	for(int turn = 0; turn < SETUP_TURNS && !SimIsGameLost(sim) && !SimIsGameWon(sim); ++turn){
+		SimStepTurn(sim,SimRandomRange(&random,0,HAND_SIZE-1),SimRandomRange(&random,0,ROTATION_TYPE_LENGTH-1),
+			SimRandomRange(&random,0,TOTAL_XGRID-2),SimRandomRange(&random,0,TOTAL_YGRID-1));
+	}
+}
+
+//______________________________________________________________
+// Command line
+
+//Reads the command line into the run settings, returns FALSE if something is wrong with it.
+_Bool ReadArguments(int argc, char* argv[]){
+	for(int i = 1; i < argc; ++i){
+		char const* option = argv[i];
+		if(strcmp(option,"--help") == 0 || strcmp(option,"-h") == 0) return FALSE;
+		if(i + 1 >= argc){
+			fprintf(stderr,"Missing value for %s\n",option);
+			return FALSE;
+		}
+		char const* value = argv[++i];
+
+		if(strcmp(option,"--bench") == 0) benchName = value;
+		else if(strcmp(option,"--iterations") == 0) iterations = atoll(value);
+		else if(strcmp(option,"--seed") == 0) baseSeed = strtoull(value,NULL,10);
+		else{
+			fprintf(stderr,"Unknown option %s\n",option);
+			return FALSE;
+		}
+	}
+	if(iterations <= 0){
+		fprintf(stderr,"--iterations has to be at least 1\n");
+		return FALSE;
+	}
+	return TRUE;
+}
+
+void PrintUsage(void){
+	fprintf(stderr,"Usage: SimBench [--bench NAME] [--iterations N] [--seed S]\n");
+	fprintf(stderr,"  --bench       only run this benchmark (default: all of them)\n");
+	fprintf(stderr,"  --iterations  times each timed loop runs (default %d)\n",DEFAULT_ITERATIONS);
+	fprintf(stderr,"  --seed        seed of the game the benchmarks play (default %d)\n",DEFAULT_SEED);
+	fprintf(stderr,"Benchmarks:\n");
+	for(int i = 0; i < BENCHMARK_COUNT; ++i){
+		fprintf(stderr,"  %-10s %s\n",benchmarks[i].name,benchmarks[i].description);
+	}
+}
+
+//______________________________________________________________
+// Timing
+
+double GetSeconds(void){
+	struct timespec time;
+	timespec_get(&time,TIME_UTC);
+	return (double)time.tv_sec + (double)time.tv_nsec / 1e9;
+}